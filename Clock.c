@@ -0,0 +1,119 @@
+// Clock.c
+// Runs on TM4C123 or LM4F120
+// Bus clock service for the labs, see Clock.h.
+// The PLL steps are the ones PLL_Init (Lab11_UART/PLL.c) used to run,
+// PLL_Init now calls Clock_SetFrequency.
+
+#include "tm4c123gh6pm.h"
+#include "Clock.h"
+
+long StartCritical(void);     // previous I bit, disable interrupts
+void EndCritical(long sr);    // restore I bit to previous value
+
+typedef struct{
+  void (*Before)(unsigned long hz);
+  void (*After)(unsigned long hz);
+}ListenerType;
+static ListenerType Listener[CLOCK_LISTENERS];
+static unsigned long Listeners;
+
+//------------Clock_Frequency------------
+// Current bus clock
+// Input: none
+// Output: frequency in Hz
+unsigned long Clock_Frequency(void){ unsigned long rcc2 = SYSCTL_RCC2_R, rcc;
+  if(rcc2&SYSCTL_RCC2_USERCC2){
+    if(rcc2&SYSCTL_RCC2_BYPASS2){
+      return 16000000;                    // crystal or PIOSC
+    }
+    if(rcc2&SYSCTL_RCC2_DIV400){          // SYSDIV2 and SYSDIV2LSB make one 7-bit divisor
+      return 400000000/(((rcc2&(SYSCTL_RCC2_SYSDIV2_M|SYSCTL_RCC2_SYSDIV2LSB))>>22)+1);
+    }
+    return 200000000/(((rcc2&SYSCTL_RCC2_SYSDIV2_M)>>23)+1);
+  }
+  rcc = SYSCTL_RCC_R;
+  if(rcc&SYSCTL_RCC_BYPASS){
+    return 16000000;
+  }
+  if(rcc&SYSCTL_RCC_USESYSDIV){
+    return 200000000/(((rcc&SYSCTL_RCC_SYSDIV_M)>>23)+1);
+  }
+  return 200000000;                       // PLL undivided is not a valid setting
+}
+
+//------------Clock_SetFrequency------------
+// Run the bus from the PLL at the highest frequency not above hz: 400 MHz
+// divided by 5, 6, 8, 9 ... 128 (7 is reserved).  The registered drivers'
+// before functions run with the old clock, then the divider changes,
+// then their after functions run with the new one, all with interrupts
+// disabled.  The PLL is bypassed while the divider changes and only has
+// to lock the first time (or not at all after the fast boot of startup.s).
+// Input: hz, CLOCK_MINHZ to CLOCK_MAXHZ, values outside are clamped
+// Output: frequency set, in Hz
+unsigned long Clock_SetFrequency(unsigned long hz){ unsigned long divisor, i;
+long sr;
+  if(hz < CLOCK_MINHZ){
+    hz = CLOCK_MINHZ;
+  }
+  divisor = (400000000+hz-1)/hz;          // smallest divisor not above hz
+  if(divisor < 5){
+    divisor = 5;
+  }
+  if(divisor == 7){
+    divisor = 8;                          // 57.143 MHz is reserved
+  }
+  hz = 400000000/divisor;
+  sr = StartCritical();
+  for(i = 0; i < Listeners; i++){
+    if(Listener[i].Before){
+      Listener[i].Before(hz);
+    }
+  }
+  // 0) use RCC2 for the 400 MHz PLL and the SYSDIV2LSB half steps
+  SYSCTL_RCC2_R |= SYSCTL_RCC2_USERCC2;
+  // 1) bypass the PLL while the divider changes
+  SYSCTL_RCC2_R |= SYSCTL_RCC2_BYPASS2;
+  // 2) select the crystal value and oscillator source
+  SYSCTL_RCC_R = (SYSCTL_RCC_R&~SYSCTL_RCC_XTAL_M)+SYSCTL_RCC_XTAL_16MHZ;
+  SYSCTL_RCC2_R = (SYSCTL_RCC2_R&~SYSCTL_RCC2_OSCSRC2_M)+SYSCTL_RCC2_OSCSRC2_MO;
+  // 3) divide the 400 MHz PLL by divisor, SYSDIV2:SYSDIV2LSB = divisor-1
+  SYSCTL_RCC2_R = (SYSCTL_RCC2_R&~(SYSCTL_RCC2_SYSDIV2_M|SYSCTL_RCC2_SYSDIV2LSB))
+                  |SYSCTL_RCC2_DIV400|((divisor-1)<<22);
+  // 4) power up the PLL if it is off and wait for it to lock; the fast
+  //    boot of startup.s powers it up early, so it may still be locking
+  if(SYSCTL_RCC2_R&SYSCTL_RCC2_PWRDN2){
+    SYSCTL_RCC2_R &= ~SYSCTL_RCC2_PWRDN2;
+  }
+  while((SYSCTL_PLLSTAT_R&SYSCTL_PLLSTAT_LOCK) == 0){};
+  // 5) run from the PLL again
+  SYSCTL_RCC2_R &= ~SYSCTL_RCC2_BYPASS2;
+  for(i = 0; i < Listeners; i++){
+    if(Listener[i].After){
+      Listener[i].After(hz);
+    }
+  }
+  EndCritical(sr);
+  return hz;
+}
+
+//------------Clock_Register------------
+// Call a driver around every clock change; registering the same pair
+// again does nothing
+// Input: before is called with the new frequency before the change,
+//        after with the new frequency once it runs, either may be 0
+// Output: 1 if registered, 0 if all CLOCK_LISTENERS are taken
+int Clock_Register(void (*before)(unsigned long hz), void (*after)(unsigned long hz)){
+unsigned long i;
+  for(i = 0; i < Listeners; i++){
+    if((Listener[i].Before == before) && (Listener[i].After == after)){
+      return 1;
+    }
+  }
+  if(Listeners == CLOCK_LISTENERS){
+    return 0;
+  }
+  Listener[Listeners].Before = before;
+  Listener[Listeners].After = after;
+  Listeners = Listeners+1;
+  return 1;
+}
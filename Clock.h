@@ -0,0 +1,50 @@
+// Clock.h
+// Runs on TM4C123 or LM4F120
+// Bus clock service for the labs.  Clock_SetFrequency moves the system
+// clock to any of the 400 MHz PLL's divided frequencies (80 MHz down to
+// 3.125 MHz, using the SYSDIV2LSB half steps) while the program runs.
+// Drivers that turn the bus clock into divisors or reload values
+// register with Clock_Register and are called around every change, so
+// UART baud rates, the SysTick tick and timer deadlines stay right.
+// Clock_Frequency reads the clock back from RCC/RCC2, so it is right
+// after TExaS_Init or PLL_Init too; the LaunchPad's 16 MHz crystal and
+// PIOSC are assumed.
+// ClockPlan.c, a host build step, picks the frequency with the least
+// baud rate and reload error for a set of targets (ClockPlan.h).
+
+#ifndef __CLOCK_H__
+#define __CLOCK_H__
+
+// drivers that can be registered at once
+#define CLOCK_LISTENERS 4
+
+// range of Clock_SetFrequency
+#define CLOCK_MAXHZ 80000000
+#define CLOCK_MINHZ 3125000
+
+//------------Clock_Frequency------------
+// Current bus clock
+// Input: none
+// Output: frequency in Hz
+unsigned long Clock_Frequency(void);
+
+//------------Clock_SetFrequency------------
+// Run the bus from the PLL at the highest frequency not above hz: 400 MHz
+// divided by 5, 6, 8, 9 ... 128 (7 is reserved).  The registered drivers'
+// before functions run with the old clock, then the divider changes,
+// then their after functions run with the new one, all with interrupts
+// disabled.  The PLL is bypassed while the divider changes and only has
+// to lock the first time (or not at all after the fast boot of startup.s).
+// Input: hz, CLOCK_MINHZ to CLOCK_MAXHZ, values outside are clamped
+// Output: frequency set, in Hz
+unsigned long Clock_SetFrequency(unsigned long hz);
+
+//------------Clock_Register------------
+// Call a driver around every clock change; registering the same pair
+// again does nothing
+// Input: before is called with the new frequency before the change,
+//        after with the new frequency once it runs, either may be 0
+// Output: 1 if registered, 0 if all CLOCK_LISTENERS are taken
+int Clock_Register(void (*before)(unsigned long hz), void (*after)(unsigned long hz));
+
+#endif // __CLOCK_H__
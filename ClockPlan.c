@@ -0,0 +1,205 @@
+// ClockPlan.c
+// Runs on Linux (x86-64 or any LP64 host), not part of the Keil projects
+// Build step that picks the bus clock for a set of timing targets.  Every
+// frequency Clock_SetFrequency can set (400 MHz PLL divided by 5, 6,
+// 8 ... 128) is tried; for each one the derived constants are computed
+// the way the drivers compute them at run time:
+//   UART baud rates    IBRD/FBRD, 64*BRD = (8*hz/baud+1)/2 as in UART.c
+//   SysTick rates      RELOAD = hz/rate rounded, minus 1, 24 bits, as in
+//                      Timer.c and TuningFork.c
+//   audio sample rates Timer TAILR = hz/rate rounded, minus 1, 32 bits,
+//                      as in Sound.c
+// and their error in ppm.  The clock with the smallest worst error wins,
+// the higher clock on a tie.  The plan goes to stdout as a header with
+// the SYSDIV2/SYSDIV2LSB fields, every constant and its residual error.
+// Build and run from the root folder with
+//   gcc -O2 -o clockplan ClockPlan.c
+//   ./clockplan > ClockPlan.h
+// Options replace the default targets, the ones of the labs:
+//   -baud rate     UART baud rate, default 115200 (UART.c)
+//   -tick rate     SysTick interrupt rate, default 1000 (Timer.c) and
+//                  880 (half periods of the 440 Hz tuning fork)
+//   -sample rate   audio sample rate, default 20000 (Sound.c)
+//   -min hz        lowest bus clock to consider, default CLOCK_MINHZ
+//   -max hz        highest, default CLOCK_MAXHZ
+//   -ppm bound     fail if the chosen plan has an error above bound
+// The exit status is 1 if a target cannot be met or the bound is
+// exceeded, so the step can check a plan as well as make one, e.g.
+//   ./clockplan -min 80000000 -ppm 100 > /dev/null
+// ClockPlanCheck.c runs the drivers at CLOCKPLAN_HZ on the register
+// emulation and compares their divisors with ClockPlan.h.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Clock.h"
+
+#define MAXTARGETS 16
+
+typedef enum t_TargetKind{
+  TARGET_BAUD,
+  TARGET_TICK,
+  TARGET_SAMPLE
+}TargetKind;
+
+typedef struct{
+  TargetKind Kind;
+  unsigned long Rate;       // baud or Hz
+}TargetType;
+
+typedef struct{
+  unsigned long Value;      // 64*BRD for a baud rate, the reload otherwise
+  double Actual;            // baud or Hz it gives
+  double Ppm;               // error of Actual
+}ResultType;
+
+static TargetType Target[MAXTARGETS];
+static int Targets;
+
+static const TargetType DefaultTarget[]={
+  {TARGET_BAUD, 115200},
+  {TARGET_TICK, 1000},
+  {TARGET_TICK, 880},
+  {TARGET_SAMPLE, 20000}
+};
+
+static const char *KindName[]={"BAUD", "TICK", "SAMPLE"};
+
+// constant for one target at bus clock hz
+// returns 0 if the target cannot be met at hz
+static int derive(const TargetType *target, unsigned long hz, ResultType *result){
+unsigned long long value;
+  if(target->Kind == TARGET_BAUD){
+    value = (8ULL*hz/target->Rate+1)/2;          // 64*BRD rounded
+    if((value < 64) || ((value>>6) > 0xFFFF)){    // IBRD 1 to 65535
+      return 0;
+    }
+    result->Actual = 64.0*hz/(16.0*value);
+  } else{
+    value = (hz+target->Rate/2)/target->Rate;      // cycles per period rounded
+    if((value < 2) || (value-1 > ((target->Kind == TARGET_TICK) ? 0x00FFFFFFULL : 0xFFFFFFFFULL))){
+      return 0;
+    }
+    result->Actual = (double)hz/value;
+    value = value-1;                               // reload
+  }
+  result->Value = (unsigned long)value;
+  result->Ppm = (result->Actual-target->Rate)*1e6/target->Rate;
+  return 1;
+}
+
+// worst error of all targets at hz, -1 if one cannot be met
+static double worst(unsigned long hz){ ResultType result;
+double error = 0;
+int i;
+  for(i = 0; i < Targets; i++){
+    if(!derive(&Target[i], hz, &result)){
+      return -1;
+    }
+    if(result.Ppm < 0){
+      result.Ppm = -result.Ppm;
+    }
+    if(result.Ppm > error){
+      error = result.Ppm;
+    }
+  }
+  return error;
+}
+
+static void add(TargetKind kind, const char *rate){
+  if(Targets == MAXTARGETS){
+    fprintf(stderr, "clockplan: more than %d targets\n", MAXTARGETS);
+    exit(1);
+  }
+  Target[Targets].Kind = kind;
+  Target[Targets].Rate = strtoul(rate, 0, 0);
+  if(Target[Targets].Rate == 0){
+    fprintf(stderr, "clockplan: bad rate %s\n", rate);
+    exit(1);
+  }
+  Targets++;
+}
+
+int main(int argc, char *argv[]){ ResultType result;
+unsigned long minHz = CLOCK_MINHZ, maxHz = CLOCK_MAXHZ, hz, bestHz = 0, divisor, bestDivisor = 0;
+double bound = -1, error, bestError = 0;
+int i;
+  for(i = 1; i+1 < argc; i += 2){
+    if(strcmp(argv[i], "-baud") == 0){
+      add(TARGET_BAUD, argv[i+1]);
+    } else if(strcmp(argv[i], "-tick") == 0){
+      add(TARGET_TICK, argv[i+1]);
+    } else if(strcmp(argv[i], "-sample") == 0){
+      add(TARGET_SAMPLE, argv[i+1]);
+    } else if(strcmp(argv[i], "-min") == 0){
+      minHz = strtoul(argv[i+1], 0, 0);
+    } else if(strcmp(argv[i], "-max") == 0){
+      maxHz = strtoul(argv[i+1], 0, 0);
+    } else if(strcmp(argv[i], "-ppm") == 0){
+      bound = strtod(argv[i+1], 0);
+    } else{
+      break;
+    }
+  }
+  if(i < argc){
+    fprintf(stderr, "usage: clockplan [-baud rate] [-tick rate] [-sample rate] [-min hz] [-max hz] [-ppm bound]\n");
+    return 1;
+  }
+  if(Targets == 0){
+    Targets = sizeof(DefaultTarget)/sizeof(DefaultTarget[0]);
+    memcpy(Target, DefaultTarget, sizeof(DefaultTarget));
+  }
+  for(divisor = 5; divisor <= 128; divisor++){  // highest clock first
+    if(divisor == 7){
+      continue;                                 // reserved
+    }
+    hz = 400000000/divisor;
+    if((hz < minHz) || (hz > maxHz) || (hz > CLOCK_MAXHZ)){
+      continue;
+    }
+    error = worst(hz);
+    if((error >= 0) && ((bestHz == 0) || (error < bestError))){
+      bestHz = hz;
+      bestDivisor = divisor;
+      bestError = error;
+    }
+  }
+  if(bestHz == 0){
+    fprintf(stderr, "clockplan: no bus clock from %lu to %lu Hz meets every target\n", minHz, maxHz);
+    return 1;
+  }
+  printf("// ClockPlan.h\n");
+  printf("// Generated by ClockPlan.c, do not edit\n");
+  printf("// Bus clock for");
+  for(i = 0; i < Targets; i++){
+    printf(" %s %lu%s", KindName[Target[i].Kind], Target[i].Rate, (i+1 < Targets) ? "," : "");
+  }
+  printf("\n// from %lu to %lu Hz, worst error %.1f ppm.\n", minHz, maxHz, bestError);
+  printf("// Clock_SetFrequency(CLOCKPLAN_HZ) sets it; UART_Init, Timer_Init and\n");
+  printf("// Sound_Init derive the same divisors at run time (ClockPlanCheck.c\n");
+  printf("// checks that they do), the constants below are for reloads fixed at\n");
+  printf("// compile time.\n\n");
+  printf("#ifndef __CLOCKPLAN_H__\n#define __CLOCKPLAN_H__\n\n");
+  printf("#define CLOCKPLAN_HZ %lu\n", bestHz);
+  printf("// RCC2 fields, 400 MHz/%lu; PLL.h's SYSDIV2 is both, %lu\n", bestDivisor, bestDivisor-1);
+  printf("#define CLOCKPLAN_SYSDIV2 %lu\n", (bestDivisor-1)>>1);
+  printf("#define CLOCKPLAN_SYSDIV2LSB %lu\n", (bestDivisor-1)&1);
+  for(i = 0; i < Targets; i++){
+    derive(&Target[i], bestHz, &result);
+    printf("\n");
+    if(Target[i].Kind == TARGET_BAUD){
+      printf("// %lu baud: %.1f baud, %+.1f ppm\n", Target[i].Rate, result.Actual, result.Ppm);
+      printf("#define CLOCKPLAN_IBRD_%lu %lu\n", Target[i].Rate, result.Value>>6);
+      printf("#define CLOCKPLAN_FBRD_%lu %lu\n", Target[i].Rate, result.Value&0x3F);
+    } else{
+      printf("// %lu Hz: %.3f Hz, %+.1f ppm\n", Target[i].Rate, result.Actual, result.Ppm);
+      printf("#define CLOCKPLAN_%s_RELOAD_%lu %lu\n", KindName[Target[i].Kind], Target[i].Rate, result.Value);
+    }
+  }
+  printf("\n#endif // __CLOCKPLAN_H__\n");
+  if((bound >= 0) && (bestError > bound)){
+    fprintf(stderr, "clockplan: worst error %.1f ppm is above %.1f ppm\n", bestError, bound);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,31 @@
+// ClockPlan.h
+// Generated by ClockPlan.c, do not edit
+// Bus clock for BAUD 115200, TICK 1000, TICK 880, SAMPLE 20000
+// from 3125000 to 80000000 Hz, worst error 64.0 ppm.
+// Clock_SetFrequency(CLOCKPLAN_HZ) sets it; UART_Init, Timer_Init and
+// Sound_Init derive the same divisors at run time (ClockPlanCheck.c
+// checks that they do), the constants below are for reloads fixed at
+// compile time.
+
+#ifndef __CLOCKPLAN_H__
+#define __CLOCKPLAN_H__
+
+#define CLOCKPLAN_HZ 50000000
+// RCC2 fields, 400 MHz/8; PLL.h's SYSDIV2 is both, 7
+#define CLOCKPLAN_SYSDIV2 3
+#define CLOCKPLAN_SYSDIV2LSB 1
+
+// 115200 baud: 115207.4 baud, +64.0 ppm
+#define CLOCKPLAN_IBRD_115200 27
+#define CLOCKPLAN_FBRD_115200 8
+
+// 1000 Hz: 1000.000 Hz, +0.0 ppm
+#define CLOCKPLAN_TICK_RELOAD_1000 49999
+
+// 880 Hz: 880.003 Hz, +3.2 ppm
+#define CLOCKPLAN_TICK_RELOAD_880 56817
+
+// 20000 Hz: 20000.000 Hz, +0.0 ppm
+#define CLOCKPLAN_SAMPLE_RELOAD_20000 2499
+
+#endif // __CLOCKPLAN_H__
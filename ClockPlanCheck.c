@@ -0,0 +1,64 @@
+// ClockPlanCheck.c
+// Runs on Linux (x86-64 or any LP64 host), not part of the Keil projects
+// Check that ClockPlan.h agrees with the drivers: on the register
+// emulation, set the bus clock to CLOCKPLAN_HZ with Clock_SetFrequency,
+// start UART.c, Timer.c and Sound.c, and compare what they wrote to the
+// hardware with the constants of the plan
+//   RCC2 SYSDIV2 and SYSDIV2LSB     CLOCKPLAN_SYSDIV2, CLOCKPLAN_SYSDIV2LSB
+//   UART0_IBRD_R, UART0_FBRD_R      CLOCKPLAN_IBRD_115200, CLOCKPLAN_FBRD_115200
+//   NVIC_ST_RELOAD_R                CLOCKPLAN_TICK_RELOAD_1000
+//   TIMER0_TAILR_R                  CLOCKPLAN_SAMPLE_RELOAD_20000
+// then switch to another clock and back, so the values the drivers
+// recompute in their Clock_Register functions are checked as well.
+// CLOCKPLAN_TICK_RELOAD_880 is TuningFork.c's TONE_RELOAD, computed in
+// the lab's main program, not in a driver the check can run.  The exit
+// status is 1 on any difference.
+// Build and run from the root folder with
+//   gcc -O2 -DHOST_EMULATION -I. -o clockplancheck ClockPlanCheck.c Clock.c Timer.c Gpio.c Lab11_UART/UART.c Lab12_TuningFork/Sound.c Emulator/*.c
+//   ./clockplancheck
+
+#include <stdio.h>
+#include "tm4c123gh6pm.h"
+#include "Clock.h"
+#include "Timer.h"
+#include "ClockPlan.h"
+#include "Lab11_UART/UART.h"
+#include "Lab12_TuningFork/Sound.h"
+
+#if !defined(CLOCKPLAN_IBRD_115200) || !defined(CLOCKPLAN_TICK_RELOAD_1000) || \
+    !defined(CLOCKPLAN_SAMPLE_RELOAD_20000)
+#error "ClockPlan.h was made for other targets than UART.c, Timer.c and Sound.c use"
+#endif
+
+static int Wrong;
+
+static void check(const char *name, unsigned long driver, unsigned long plan){
+  printf("%-22s driver %10lu  plan %10lu  %s\n", name, driver, plan, (driver == plan)? "ok" : "DIFFERENT");
+  if(driver != plan){
+    Wrong++;
+  }
+}
+
+static void checkAll(void){ unsigned long rcc2 = SYSCTL_RCC2_R;
+  check("bus clock", Clock_Frequency(), CLOCKPLAN_HZ);
+  check("RCC2 SYSDIV2", (rcc2&SYSCTL_RCC2_SYSDIV2_M)>>23, CLOCKPLAN_SYSDIV2);
+  check("RCC2 SYSDIV2LSB", (rcc2&SYSCTL_RCC2_SYSDIV2LSB)>>22, CLOCKPLAN_SYSDIV2LSB);
+  check("UART0 IBRD", UART0_IBRD_R, CLOCKPLAN_IBRD_115200);
+  check("UART0 FBRD", UART0_FBRD_R, CLOCKPLAN_FBRD_115200);
+  check("SysTick RELOAD", NVIC_ST_RELOAD_R, CLOCKPLAN_TICK_RELOAD_1000);
+  check("Timer0A TAILR", TIMER0_TAILR_R, CLOCKPLAN_SAMPLE_RELOAD_20000);
+}
+
+int main(void){
+  Clock_SetFrequency(CLOCKPLAN_HZ);
+  UART_Init();
+  Timer_Init();
+  Sound_Init();
+  printf("after Init at %lu Hz\n", (unsigned long)CLOCKPLAN_HZ);
+  checkAll();
+  Clock_SetFrequency((CLOCKPLAN_HZ == CLOCK_MAXHZ)? CLOCK_MINHZ : CLOCK_MAXHZ);
+  Clock_SetFrequency(CLOCKPLAN_HZ);
+  printf("after a clock change and back\n");
+  checkAll();
+  return Wrong != 0;
+}
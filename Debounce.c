@@ -0,0 +1,91 @@
+// Debounce.c
+// Runs on TM4C123 or LM4F120
+// Parallel switch debouncer with vertical counters, see Debounce.h.
+
+#include "tm4c123gh6pm.h"
+#include "Gpio.h"
+#include "Debounce.h"
+
+long StartCritical(void);     // previous I bit, disable interrupts
+void EndCritical(long sr);    // restore I bit to previous value
+
+// A bit's counter is (Count1,Count0), 3 while its sample agrees with
+// State; each disagreeing sample counts it down, 3 2 1 0, and the fourth
+// wraps it back to 3 and flips the bit of State.  An agreeing sample
+// sets it back to 3.
+static unsigned long Port[DEBOUNCE_PORTS];
+static unsigned long Ports;
+static volatile unsigned long State;    // debounced levels
+static unsigned long Count0, Count1;    // vertical counters
+static volatile unsigned long Edges;    // State bits flipped since Debounce_Edges
+static volatile unsigned long Unsettled; // samples that disagree with State
+
+static unsigned long sample(void){ unsigned long i, levels = 0;
+  for(i = 0; i < Ports; i++){
+    levels |= GPIO_PINS(Port[i],0xFF)<<(8*i);
+  }
+  return levels;
+}
+
+//------------Debounce_Init------------
+// Start debouncing every pin of the ports, from their levels now
+// The pins must already be set up as digital inputs
+// Input: ports are GPIO_PORTx from Gpio.h, count is 1 to DEBOUNCE_PORTS
+// Output: none
+void Debounce_Init(const unsigned long ports[], unsigned long count){ unsigned long i;
+  if(count > DEBOUNCE_PORTS){
+    count = DEBOUNCE_PORTS;
+  }
+  for(i = 0; i < count; i++){
+    Port[i] = ports[i];
+  }
+  Ports = count;
+  State = sample();
+  Count0 = Count1 = 0xFFFFFFFF;
+  Edges = Unsettled = 0;
+}
+
+//------------Debounce_Sample------------
+// Sample the ports and count, called from a periodic interrupt handler
+// every DEBOUNCE_MS
+// Input: none
+// Output: none
+void Debounce_Sample(void){ unsigned long levels = sample(), changed;
+  changed = levels^State;
+  Count0 = ~(Count0&changed);         // count down the bits that disagree,
+  Count1 = Count0^(Count1&changed);   // back to 3 the bits that agree
+  changed &= Count0&Count1;           // wrapped to 3: four samples in a row
+  State ^= changed;
+  Edges |= changed;
+  Unsettled = levels^State;
+}
+
+//------------Debounce_Levels------------
+// Debounced levels of all the pins
+// Input: none
+// Output: port k of Debounce_Init in bits 8k+7 to 8k
+unsigned long Debounce_Levels(void){
+  return State;
+}
+
+//------------Debounce_Edges------------
+// Pins whose debounced level changed since the last call; AND with
+// Debounce_Levels for rising edges, with its complement for falling
+// Input: none
+// Output: port k of Debounce_Init in bits 8k+7 to 8k
+unsigned long Debounce_Edges(void){ unsigned long edges;
+long sr = StartCritical();            // Debounce_Sample adds to Edges
+  edges = Edges;
+  Edges = 0;
+  EndCritical(sr);
+  return edges;
+}
+
+//------------Debounce_Settled------------
+// Check for inputs in the middle of a change, so a sampler that runs
+// only after pin edges knows when it can stop
+// Input: none
+// Output: 1 if every pin read its debounced level at the last sample
+int Debounce_Settled(void){
+  return Unsettled == 0;
+}
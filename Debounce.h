@@ -0,0 +1,64 @@
+// Debounce.h
+// Runs on TM4C123 or LM4F120
+// Parallel switch debouncer with vertical counters.  Up to
+// DEBOUNCE_PORTS GPIO ports are sampled into one 32-bit word, port k of
+// Debounce_Init in bits 8k+7 to 8k, and every bit has its own 2-bit
+// counter held across two words: bit i of Count0 and bit i of Count1.
+// One sample updates all 32 counters with a handful of logic
+// instructions; an input's debounced level changes only after 4
+// samples in a row disagree with it, so bounce shorter than about
+// 3*DEBOUNCE_MS never gets through.  Neither does a real pulse: one
+// shorter than 3*DEBOUNCE_MS is always dropped, one longer than
+// 4*DEBOUNCE_MS always taken, and in between it depends on where the
+// samples fall.
+// Debounce_Sample runs from a periodic interrupt every DEBOUNCE_MS; the
+// program reads the debounced levels and the edges between them instead
+// of GPIO_PORTx_DATA_R.
+
+#ifndef __DEBOUNCE_H__
+#define __DEBOUNCE_H__
+
+// ports sampled at most, 8 pins each
+#define DEBOUNCE_PORTS 4
+// sample period, a change is taken after 4 equal samples
+#define DEBOUNCE_MS 4
+
+// pins of the k-th port of Debounce_Init in a word from Debounce_Levels
+// or Debounce_Edges
+#define DEBOUNCE_PORT(word,k) (((word)>>(8*(k)))&0xFF)
+
+//------------Debounce_Init------------
+// Start debouncing every pin of the ports, from their levels now
+// The pins must already be set up as digital inputs
+// Input: ports are GPIO_PORTx from Gpio.h, count is 1 to DEBOUNCE_PORTS
+// Output: none
+void Debounce_Init(const unsigned long ports[], unsigned long count);
+
+//------------Debounce_Sample------------
+// Sample the ports and count, called from a periodic interrupt handler
+// every DEBOUNCE_MS
+// Input: none
+// Output: none
+void Debounce_Sample(void);
+
+//------------Debounce_Levels------------
+// Debounced levels of all the pins
+// Input: none
+// Output: port k of Debounce_Init in bits 8k+7 to 8k
+unsigned long Debounce_Levels(void);
+
+//------------Debounce_Edges------------
+// Pins whose debounced level changed since the last call; AND with
+// Debounce_Levels for rising edges, with its complement for falling
+// Input: none
+// Output: port k of Debounce_Init in bits 8k+7 to 8k
+unsigned long Debounce_Edges(void);
+
+//------------Debounce_Settled------------
+// Check for inputs in the middle of a change, so a sampler that runs
+// only after pin edges knows when it can stop
+// Input: none
+// Output: 1 if every pin read its debounced level at the last sample
+int Debounce_Settled(void);
+
+#endif // __DEBOUNCE_H__
@@ -0,0 +1,167 @@
+// EmuGPIO.c
+// Runs on Linux (x86-64 or any LP64 host)
+// GPIO ports A-F model for the host-side register emulation.
+// DATA reads and writes go through the address mask (bits 9:2 of the
+// address select the pins), inputs read the driven level or the
+// pull-up/pull-down level, and edge or level interrupts are raised
+// through IS, IBE, IEV, IM, RIS, MIS and ICR.  With EMU_TRACE set in the
+// environment every output change goes to stderr as "cycle port level".
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "Emulator.h"
+
+#define NUMPORTS 6
+static const unsigned long PortBase[NUMPORTS]={
+  0x40004000, 0x40005000, 0x40006000, 0x40007000, 0x40024000, 0x40025000
+};
+static const int PortIRQ[NUMPORTS]={
+  EMU_IRQ_GPIOA, EMU_IRQ_GPIOB, EMU_IRQ_GPIOC, EMU_IRQ_GPIOD, EMU_IRQ_GPIOE, EMU_IRQ_GPIOF
+};
+
+// register offsets
+#define DIR   0x400
+#define IS    0x404
+#define IBE   0x408
+#define IEV   0x40C
+#define IM    0x410
+#define RIS   0x414
+#define MIS   0x418
+#define ICR   0x41C
+#define PUR   0x510
+#define PDR   0x514
+#define DEN   0x51C
+#define CR    0x524
+
+typedef struct{
+  unsigned long Reg[0x1000/4];  // control registers, indexed by offset/4
+  unsigned long Out;            // DATA output latch
+  unsigned long Driven;         // pins driven by Emu_GPIOInput
+  unsigned long External;       // level of the driven pins
+  unsigned long Level;          // pin levels at the last update
+  volatile unsigned long Scratch;
+}PortType;
+static PortType Port[NUMPORTS];
+
+void (*Emu_GPIOChanged)(int port, unsigned long before, unsigned long after);
+static int Trace;                       // EMU_TRACE set: log output changes
+
+#define REG(p,offset) (Port[p].Reg[(offset)/4])
+
+// level of every pin: outputs read the latch, inputs the driven or pull level
+static unsigned long pins(int p){ unsigned long dir = REG(p,DIR), in;
+  in = (Port[p].Driven&Port[p].External)|(~Port[p].Driven&REG(p,PUR)&~REG(p,PDR));
+  return ((Port[p].Out&dir)|(in&~dir))&0xFF;
+}
+
+// recompute pin levels, latch edges into RIS and request the interrupt
+static void update(int p){
+unsigned long now = pins(p), old = Port[p].Level, changed = now^old, edge;
+unsigned long is = REG(p,IS), ibe = REG(p,IBE), iev = REG(p,IEV);
+unsigned long outBefore = old&REG(p,DIR), outAfter = now&REG(p,DIR);
+  edge = changed&~is&(ibe|~(now^iev));  // both edges, or the edge that matches IEV
+  REG(p,RIS) |= edge;
+  REG(p,RIS) |= is&~(now^iev)&0xFF;     // level sensitive pins stay set while active
+  Port[p].Level = now;
+  if(REG(p,RIS)&REG(p,IM)){
+    Emu_SetPending(PortIRQ[p]);
+  } else{
+    Emu_ClearPending(PortIRQ[p]);
+  }
+  if(outBefore != outAfter){
+    if(Emu_GPIOChanged){
+      Emu_GPIOChanged(p, outBefore, outAfter);
+    } else if(Trace){
+      fprintf(stderr, "%llu GPIO%c %02lX\n", Emu_Cycles, 'A'+p, outAfter);
+    }
+  }
+}
+
+static int portOf(unsigned long address){ int p;
+  for(p = 0; p < NUMPORTS; p++){
+    if((address-PortBase[p]) < 0x1000){
+      return p;
+    }
+  }
+  return -1;
+}
+
+static volatile unsigned long *gpioAccess(unsigned long address){
+int p = portOf(address);
+unsigned long offset;
+  if(p < 0){
+    return 0;
+  }
+  offset = address-PortBase[p];
+  if(offset < 0x400){                   // DATA, bits 9:2 of the address mask the pins
+    Port[p].Scratch = pins(p)&REG(p,DEN)&(offset>>2);
+    return &Port[p].Scratch;
+  }
+  switch(offset){
+    case MIS:
+      Port[p].Scratch = REG(p,RIS)&REG(p,IM);
+      return &Port[p].Scratch;
+    case ICR:                           // write 1 to clear
+      Port[p].Scratch = 0;
+      return &Port[p].Scratch;
+    case CR:
+      REG(p,CR) = 0xFF;                 // commit always allowed
+      return &REG(p,CR);
+    default:
+      return &Port[p].Reg[offset/4];
+  }
+}
+
+static void gpioCommit(unsigned long address, unsigned long before, unsigned long after){
+int p = portOf(address);
+unsigned long offset = address-PortBase[p], mask;
+  if(offset < 0x400){
+    if(after != before){
+      mask = offset>>2;
+      Port[p].Out = (Port[p].Out&~mask)|(after&mask);
+    }
+  } else if(offset == ICR){
+    REG(p,RIS) &= ~after;
+  } else if(offset == RIS){
+    REG(p,RIS) = before;                // read only
+  }
+  update(p);
+}
+
+//------------Emu_GPIOInput------------
+// Drive input pins from outside the program
+// Pins not driven read their pull-up/pull-down level
+// Input: port 0 (A) to 5 (F)
+//        mask selects the pins driven by this call
+//        level is the value for those pins
+// Output: none
+void Emu_GPIOInput(int port, unsigned long mask, unsigned long level){
+  Port[port].Driven |= mask;
+  Port[port].External = (Port[port].External&~mask)|(level&mask);
+  update(port);
+}
+
+//------------Emu_GPIORelease------------
+// Stop driving input pins, they go back to their pull level
+// Input: port 0 (A) to 5 (F), mask selects the pins
+// Output: none
+void Emu_GPIORelease(int port, unsigned long mask){
+  Port[port].Driven &= ~mask;
+  update(port);
+}
+
+//------------Emu_GPIOOutput------------
+// Current level of a port's output pins
+// Input: port 0 (A) to 5 (F)
+// Output: DATA latch masked by DIR
+unsigned long Emu_GPIOOutput(int port){
+  return Port[port].Out&REG(port,DIR)&0xFF;
+}
+
+__attribute__((constructor)) static void gpioStart(void){ const char *trace = getenv("EMU_TRACE");
+  Trace = trace && (*trace != '0');
+}
+
+const EmuModel Emu_GPIOModel = {
+  "GPIO", 0x40004000, 0x22000, gpioAccess, gpioCommit, 0, 0
+};
@@ -0,0 +1,93 @@
+// EmuSysCtl.c
+// Runs on Linux (x86-64 or any LP64 host)
+// System control model for the host-side register emulation.
+// Clock gating is reflected in the peripheral ready registers at once,
+// the PLL reports lock as soon as it is powered up, and Emu_ClockHz
+// follows the oscillator, bypass and divisor fields of RCC/RCC2.
+// Emu_UDMAClocked follows the uDMA gate in RCGCDMA and RCGC2.
+
+#include "Emulator.h"
+
+#define RIS       0x050
+#define RCC       0x060
+#define RCC2      0x070
+#define RCGC1     0x104
+#define RCGC2     0x108
+#define RCGCTIMER 0x604
+#define RCGCDMA   0x60C
+#define PLLSTAT   0x168
+#define RCGCGPIO  0x608
+#define PRTIMER   0xA04
+#define PRGPIO    0xA08
+
+#define RIS_PLLLRIS     0x00000040
+#define RCC2_USERCC2    0x80000000
+#define RCC2_DIV400     0x40000000
+#define RCC2_PWRDN2     0x00002000
+#define RCC2_BYPASS2    0x00000800
+#define RCGC2_UDMA      0x00002000
+
+static unsigned long Reg[0x1000/4];
+static volatile unsigned long Scratch;
+#define REG(offset) (Reg[(offset)/4])
+
+int Emu_UDMAClocked;
+
+// bus clock from the current RCC2 settings (RCC2 in use, 16 MHz crystal)
+static void clockUpdate(void){ unsigned long rcc2 = REG(RCC2);
+  if(!(rcc2&RCC2_USERCC2) || (rcc2&RCC2_BYPASS2)){
+    Emu_ClockHz = 16000000;             // crystal or PIOSC, both 16 MHz on the LaunchPad
+  } else if(rcc2&RCC2_DIV400){
+    Emu_ClockHz = 400000000/(((rcc2>>22)&0x7F)+1);
+  } else{
+    Emu_ClockHz = 200000000/(((rcc2>>23)&0x3F)+1);
+  }
+}
+
+static volatile unsigned long *sysctlAccess(unsigned long address){
+unsigned long offset = address-0x400FE000;
+  switch(offset){
+    case PRGPIO:                        // ready as soon as the clock is on
+      Scratch = (REG(RCGCGPIO)|REG(RCGC2))&0x3F;
+      return &Scratch;
+    case PRTIMER:
+      Scratch = (REG(RCGCTIMER)|(REG(RCGC1)>>16))&0x3F;
+      return &Scratch;
+    case PLLSTAT:                       // locked whenever powered
+      Scratch = (REG(RCC2)&RCC2_PWRDN2) ? 0 : 1;
+      return &Scratch;
+    default:
+      return &Reg[offset/4];
+  }
+}
+
+static void sysctlCommit(unsigned long address, unsigned long before, unsigned long after){
+  (void)before;
+  switch(address-0x400FE000){
+    case RCC2:
+      if(!(after&RCC2_PWRDN2)){
+        REG(RIS) |= RIS_PLLLRIS;        // PLL locks at once
+      } else{
+        REG(RIS) &= ~RIS_PLLLRIS;
+      }
+      clockUpdate();
+      break;
+    case RCC:
+      clockUpdate();
+      break;
+    case RCGCDMA:
+    case RCGC2:
+      Emu_UDMAClocked = (REG(RCGCDMA)&1) || (REG(RCGC2)&RCGC2_UDMA);
+      break;
+  }
+}
+
+// reset values from the data sheet
+__attribute__((constructor)) static void sysctlReset(void){
+  REG(RCC) = 0x078E3AD1;
+  REG(RCC2) = 0x07C06810;
+}
+
+const EmuModel Emu_SysCtlModel = {
+  "SysCtl", 0x400FE000, 0x1000, sysctlAccess, sysctlCommit, 0, 0
+};
@@ -0,0 +1,104 @@
+// EmuSysTick.c
+// Runs on Linux (x86-64 or any LP64 host)
+// SysTick model for the host-side register emulation.
+// NVIC_ST_CURRENT_R counts down once per core cycle of the virtual clock
+// (Emu_Cycles), reloads on the cycle after reaching 0, and sets COUNT and
+// requests the interrupt on the cycle it reaches 0, as on the chip.  The
+// counter is brought up to date lazily, so a long wait costs nothing.
+// The clock source bit is ignored, the counter always runs at the core
+// clock.
+
+#include "Emulator.h"
+
+#define CTRL_COUNT  0x00010000
+#define CTRL_INTEN  0x00000002
+#define CTRL_ENABLE 0x00000001
+
+static unsigned long Ctrl, Reload, Current;
+static unsigned long long Last;         // Emu_Cycles when Current was right
+static volatile unsigned long Scratch;
+
+// counter reached 0
+static void zero(void){
+  Ctrl |= CTRL_COUNT;
+  if(Ctrl&CTRL_INTEN){
+    Emu_SetPending(EMU_IRQ_SYSTICK);
+  }
+}
+
+// run the counter from Last up to now, wrapping as often as needed
+static void systickAdvance(unsigned long long now){
+unsigned long long elapsed = now-Last, period, phase;
+  Last = now;
+  if(!(Ctrl&CTRL_ENABLE) || (elapsed == 0)){
+    return;
+  }
+  if(Current >= elapsed){
+    Current -= (unsigned long)elapsed;
+    if(Current == 0){
+      zero();
+    }
+    return;
+  }
+  if(Current){                          // reaches 0 on the way
+    elapsed -= Current;
+    Current = 0;
+    zero();
+  }
+  if(Reload == 0){                      // stays at 0, no more counts
+    return;
+  }
+  period = (unsigned long long)Reload+1;// 1 cycle to reload, Reload cycles down to 0
+  phase = elapsed%period;
+  if(elapsed >= period){
+    zero();
+  }
+  Current = (phase == 0)? 0 : Reload-(unsigned long)(phase-1);
+}
+
+static volatile unsigned long *systickAccess(unsigned long address){
+  systickAdvance(Emu_Cycles);
+  switch(address){
+    case 0xE000E010: Scratch = Ctrl;    Emu_Watch(); break;
+    case 0xE000E014: Scratch = Reload;  break;
+    case 0xE000E018: Scratch = Current; Emu_Watch(); break;
+    default:         Scratch = 0;       break; // CALIB reads 0
+  }
+  return &Scratch;
+}
+
+static void systickCommit(unsigned long address, unsigned long before, unsigned long after){
+  (void)before;
+  systickAdvance(Emu_Cycles);
+  switch(address){
+    case 0xE000E010:
+      if(!Emu_Written){
+        Ctrl &= ~CTRL_COUNT;            // reading CTRL clears COUNT
+      } else{
+        Ctrl = after&(CTRL_INTEN|CTRL_ENABLE|0x4);
+      }
+      break;
+    case 0xE000E014:
+      Reload = after&0x00FFFFFF;
+      break;
+    case 0xE000E018:
+      if(Emu_Written){                  // any write clears CURRENT and COUNT
+        Current = 0;
+        Ctrl &= ~CTRL_COUNT;
+      }
+      break;
+  }
+}
+
+// waiting for an interrupt: cycles until the counter next reaches 0
+static unsigned long long systickIdle(int block){
+  (void)block;
+  if((Ctrl&(CTRL_ENABLE|CTRL_INTEN)) != (CTRL_ENABLE|CTRL_INTEN) || (Reload == 0)){
+    return 0;
+  }
+  return Current? Current : (unsigned long long)Reload+1;
+}
+
+const EmuModel Emu_SysTickModel = {
+  "SysTick", 0xE000E010, 0x10, systickAccess, systickCommit, systickAdvance, systickIdle
+};
@@ -0,0 +1,168 @@
+// EmuTimer.c
+// Runs on Linux (x86-64 or any LP64 host)
+// General-purpose timer model for the host-side register emulation.
+// Timer A of Timer0 to Timer2 in 32-bit one-shot or periodic mode:
+// TAV counts down from TAILR once per core cycle, TATORIS is set and
+// the interrupt requested when it reaches 0; a periodic timer reloads on
+// the next cycle and a one-shot timer clears TAEN.  The prescaler,
+// timer B, capture and PWM modes are not modeled.
+
+#include "Emulator.h"
+
+#define NUMTIMERS 3
+
+// register offsets
+#define CFG   0x000
+#define TAMR  0x004
+#define CTL   0x00C
+#define IMR   0x018
+#define RIS   0x01C
+#define MIS   0x020
+#define ICR   0x024
+#define TAILR 0x028
+#define TAR   0x048
+#define TAV   0x050
+
+#define TAMR_MODE    0x03
+#define TAMR_1_SHOT  0x01
+#define CTL_TAEN     0x01
+#define RIS_TATORIS  0x01
+
+static const int TimerIRQ[NUMTIMERS]={
+  EMU_IRQ_TIMER0A, EMU_IRQ_TIMER1A, EMU_IRQ_TIMER2A
+};
+
+typedef struct{
+  unsigned long Reg[0x1000/4];  // control registers, indexed by offset/4
+  unsigned long Value;          // TAV when Last was the time
+  unsigned long long Last;
+  volatile unsigned long Scratch;
+}TimerType;
+static TimerType Timer[NUMTIMERS];
+
+#define REG(t,offset) (Timer[t].Reg[(offset)/4])
+
+static void update(int t){
+  if(REG(t,RIS)&REG(t,IMR)){
+    Emu_SetPending(TimerIRQ[t]);
+  } else{
+    Emu_ClearPending(TimerIRQ[t]);
+  }
+}
+
+// timer A of timer t reached 0, returns 1 if it keeps running
+static int timeout(int t){
+  REG(t,RIS) |= RIS_TATORIS;
+  update(t);
+  if((REG(t,TAMR)&TAMR_MODE) == TAMR_1_SHOT){
+    REG(t,CTL) &= ~CTL_TAEN;            // one-shot: stop at 0
+    return 0;
+  }
+  return 1;
+}
+
+// run timer A of timer t from Last up to now, reloading on the cycle
+// after it reaches 0 as SysTick does, so the period is TAILR+1
+static void run(int t, unsigned long long now){
+unsigned long long elapsed = now-Timer[t].Last, period, phase;
+unsigned long load = REG(t,TAILR);
+  Timer[t].Last = now;
+  if(!(REG(t,CTL)&CTL_TAEN) || (elapsed == 0)){
+    return;
+  }
+  if(Timer[t].Value >= elapsed){
+    Timer[t].Value -= (unsigned long)elapsed;
+    if(Timer[t].Value == 0){
+      timeout(t);
+    }
+    return;
+  }
+  if(Timer[t].Value){                   // reaches 0 on the way
+    elapsed -= Timer[t].Value;
+    Timer[t].Value = 0;
+    if(!timeout(t)){
+      return;
+    }
+  }
+  if(load == 0){
+    return;
+  }
+  period = (unsigned long long)load+1;
+  phase = elapsed%period;
+  if((elapsed >= period) && !timeout(t)){
+    return;                             // a one-shot timer never gets here
+  }
+  Timer[t].Value = (phase == 0)? 0 : load-(unsigned long)(phase-1);
+}
+
+static void timerAdvance(unsigned long long now){ int t;
+  for(t = 0; t < NUMTIMERS; t++){
+    run(t, now);
+  }
+}
+
+static volatile unsigned long *timerAccess(unsigned long address){
+int t = (int)((address-0x40030000)>>12);
+unsigned long offset = address&0xFFF;
+  if(t >= NUMTIMERS){
+    return 0;
+  }
+  run(t, Emu_Cycles);
+  switch(offset){
+    case TAR:
+    case TAV:
+      Timer[t].Scratch = Timer[t].Value;
+      return &Timer[t].Scratch;
+    case MIS:
+      Timer[t].Scratch = REG(t,RIS)&REG(t,IMR);
+      return &Timer[t].Scratch;
+    case ICR:                           // write 1 to clear
+      Timer[t].Scratch = 0;
+      return &Timer[t].Scratch;
+    default:
+      return &Timer[t].Reg[offset/4];
+  }
+}
+
+static void timerCommit(unsigned long address, unsigned long before, unsigned long after){
+int t = (int)((address-0x40030000)>>12);
+  switch(address&0xFFF){
+    case CTL:
+      if((after&CTL_TAEN) && !(before&CTL_TAEN)){
+        Timer[t].Value = REG(t,TAILR);  // starts from the load value
+        Timer[t].Last = Emu_Cycles;
+      }
+      break;
+    case TAILR:
+      if(!(REG(t,CTL)&CTL_TAEN)){
+        Timer[t].Value = after;
+      }
+      break;
+    case ICR:
+      REG(t,RIS) &= ~after;
+      break;
+    case RIS:
+      REG(t,RIS) = before;              // read only
+      break;
+  }
+  update(t);
+}
+
+// waiting for an interrupt: cycles until the first armed timeout
+static unsigned long long timerIdle(int block){ int t;
+unsigned long long next = 0, n;
+  (void)block;
+  for(t = 0; t < NUMTIMERS; t++){
+    if((REG(t,CTL)&CTL_TAEN) && (REG(t,IMR)&RIS_TATORIS)){
+      n = Timer[t].Value? Timer[t].Value : (unsigned long long)REG(t,TAILR)+1;
+      if((next == 0) || (n < next)){
+        next = n;
+      }
+    }
+  }
+  return next;
+}
+
+const EmuModel Emu_TimerModel = {
+  "Timer", 0x40030000, NUMTIMERS*0x1000, timerAccess, timerCommit, timerAdvance, timerIdle
+};
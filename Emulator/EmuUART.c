@@ -0,0 +1,345 @@
+// EmuUART.c
+// Runs on Linux (x86-64 or any LP64 host)
+// UART0 model for the host-side register emulation.
+// Characters written to UART0_DR_R are printed at once but take the
+// line time of the IBRD/FBRD divisor to leave the transmit FIFO (16
+// deep, 1 with LCRH FEN clear): FR reports TXFF, TXFE and BUSY from the
+// FIFO level, and TXRIS is raised when the level drops to the IFLS
+// trigger, as on the chip.  With no divisor set characters leave at
+// once.  Received characters come from Emu_UARTInput or stdin, RXRIS
+// and RTRIS are raised while received data is waiting.
+// The uDMA controller is modeled as far as UART0 TX needs it: channel 9
+// in basic or ping-pong mode moves one byte from the control table into
+// the transmit FIFO whenever DMACTL TXDMAE is set and the FIFO has room,
+// costing the program no cycles, and on finishing a control structure
+// writes its mode back to stop, sets the channel's CHIS bit and raises
+// the UART0 interrupt until CHIS is cleared.  Any uDMA register access
+// with the uDMA clock off stops the program, as the bus fault would on
+// the chip.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <poll.h>
+#include <unistd.h>
+#include "Emulator.h"
+
+#define DR    0x000
+#define FR    0x018
+#define IBRD  0x024
+#define FBRD  0x028
+#define LCRH  0x02C
+#define IFLS  0x034
+#define CTL   0x030
+#define IM    0x038
+#define RIS   0x03C
+#define MIS   0x040
+#define ICR   0x044
+#define DMACTL 0x048
+
+#define FR_TXFE   0x80
+#define FR_TXFF   0x20
+#define FR_RXFE   0x10
+#define FR_BUSY   0x08
+#define LCRH_FEN  0x10
+#define CTL_UARTEN 0x01
+#define RIS_RTRIS 0x40
+#define RIS_TXRIS 0x20
+#define RIS_RXRIS 0x10
+#define DMACTL_TXDMAE 0x02
+
+// uDMA register offsets, the set/clear pairs from USEBURSTSET to PRIOCLR
+// are 8 bytes apart with the set register first
+#define DMA_CFG      0x004
+#define DMA_CTLBASE  0x008
+#define DMA_PAIRS    0x018
+#define DMA_REQMASK  0x020
+#define DMA_ENA      0x028
+#define DMA_ALT      0x030
+#define DMA_PRIOCLR  0x03C
+#define DMA_CHIS     0x504
+#define DMA_CHMAP1   0x514
+#define DMA_TXCH     9                  // UART0 TX, encoding 0
+#define DMA_TXBIT    (1UL<<DMA_TXCH)
+#define CHCTL_XFERSIZE_S 4
+#define CHCTL_XFERMODE_M 0x7
+#define XFERMODE_STOP     0
+#define XFERMODE_BASIC    1
+#define XFERMODE_PINGPONG 3
+
+#define RXSIZE 1024
+static unsigned char Rx[RXSIZE];
+static unsigned long RxPutI, RxGetI;
+static int StdinEnd;                    // 1 once stdin reaches end of file
+static int Unflushed;                   // characters sent since the last fflush
+static unsigned long TxLevel;           // characters in the transmit FIFO
+static unsigned long long TxDone;       // Emu_Cycles when the one on the line is sent
+
+static unsigned long Reg[0x1000/4];
+static volatile unsigned long Scratch;
+#define REG(offset) (Reg[(offset)/4])
+
+static unsigned long DmaReg[0x1000/4];  // uDMA registers without a set/clear pair
+static unsigned long DmaPair[5];        // USEBURST, REQMASK, ENA, ALT and PRIO states
+static unsigned long DmaChis;
+#define DMAREG(offset) (DmaReg[(offset)/4])
+#define DMAPAIR(offset) (DmaPair[((offset)-DMA_PAIRS)/8])
+
+void (*Emu_UARTOutput)(unsigned char data);
+int Emu_UARTEndExits = 1;
+
+//------------Emu_UARTInput------------
+// Queue characters for the program to receive on UART0
+// Input: data and count of the characters
+// Output: none
+void Emu_UARTInput(const char *data, unsigned long count){
+  while(count && ((RxPutI-RxGetI) < RXSIZE)){
+    Rx[RxPutI%RXSIZE] = (unsigned char)*data++;
+    RxPutI++;
+    count--;
+  }
+}
+
+// move whatever stdin has into the receive queue, waiting up to timeout ms
+static void readStdin(int timeout){
+struct pollfd fd;
+char buffer[64];
+ssize_t n;
+  if(StdinEnd || (RxPutI != RxGetI)){
+    return;
+  }
+  fd.fd = 0;
+  fd.events = POLLIN;
+  if(poll(&fd, 1, timeout) > 0){
+    n = read(0, buffer, sizeof(buffer));
+    if(n > 0){
+      Emu_UARTInput(buffer, (unsigned long)n);
+    } else{
+      StdinEnd = 1;
+    }
+  }
+}
+
+// cycles for one character, 10 bits of 16 samples of IBRD+FBRD/64 cycles
+static unsigned long long characterCycles(void){
+  return (5*(64*(unsigned long long)REG(IBRD)+(REG(FBRD)&0x3F))+1)/2;
+}
+static unsigned long txDepth(void){
+  return (REG(LCRH)&LCRH_FEN)? 16 : 1;
+}
+// FIFO level at or below which TXRIS is raised, from IFLS TXIFLSEL
+static unsigned long txTrigger(void){
+  if(!(REG(LCRH)&LCRH_FEN)){
+    return 0;
+  }
+  switch(REG(IFLS)&0x7){
+    case 0:  return 2;
+    case 1:  return 4;
+    case 3:  return 12;
+    case 4:  return 14;
+    default: return 8;
+  }
+}
+
+static void update(void){
+  if(RxPutI != RxGetI){
+    REG(RIS) |= RIS_RXRIS|RIS_RTRIS;
+  }
+  if(((REG(CTL)&CTL_UARTEN) && (REG(RIS)&REG(IM))) || (DmaChis&DMA_TXBIT)){
+    Emu_SetPending(EMU_IRQ_UART0);      // uDMA completion comes on the UART vector
+  } else{
+    Emu_ClearPending(EMU_IRQ_UART0);
+  }
+}
+
+// a character written to DR by the program or the uDMA
+static void txPut(unsigned char data){
+  if(TxLevel >= txDepth()){
+    return;                             // FIFO full, the character is lost
+  }
+  if(REG(IBRD) == 0){                   // no divisor, no line time
+    REG(RIS) |= RIS_TXRIS;
+  } else if(TxLevel++ == 0){
+    TxDone = Emu_Cycles+characterCycles();
+  }
+  if(Emu_UARTOutput){
+    Emu_UARTOutput(data);
+  } else{
+    putchar(data);
+    Unflushed = 1;
+  }
+}
+
+// the uDMA channel is done with one control structure: mark it stopped,
+// ask for the interrupt, and go on with the other one in ping-pong mode
+static void dmaDone(unsigned long *control, unsigned long mode){
+  control[2] &= ~(unsigned long)CHCTL_XFERMODE_M; // XFERSIZE is 0 already
+  DmaChis |= DMA_TXBIT;
+  DMAPAIR(DMA_ENA) &= ~DMA_TXBIT;
+  if(mode == XFERMODE_PINGPONG){
+    DMAPAIR(DMA_ALT) ^= DMA_TXBIT;
+    control = (unsigned long *)DMAREG(DMA_CTLBASE)+
+              ((DMAPAIR(DMA_ALT)&DMA_TXBIT)? 128 : 0)+4*DMA_TXCH;
+    if((control[2]&CHCTL_XFERMODE_M) != XFERMODE_STOP){
+      DMAPAIR(DMA_ENA) |= DMA_TXBIT;    // the other structure is ready
+    }
+  }
+}
+
+// move bytes from the uDMA into the transmit FIFO while the UART asks
+static void dmaService(void){ unsigned long *control;
+unsigned long ctl, mode, left;
+  while((REG(DMACTL)&DMACTL_TXDMAE) && (DMAREG(DMA_CFG)&1) &&
+        (DMAPAIR(DMA_ENA)&DMA_TXBIT) && !(DMAPAIR(DMA_REQMASK)&DMA_TXBIT) &&
+        !(DMAREG(DMA_CHMAP1)&0xF0) && (TxLevel < txDepth())){
+    control = (unsigned long *)DMAREG(DMA_CTLBASE)+
+              ((DMAPAIR(DMA_ALT)&DMA_TXBIT)? 128 : 0)+4*DMA_TXCH;
+    ctl = control[2];
+    mode = ctl&CHCTL_XFERMODE_M;
+    if((mode != XFERMODE_BASIC) && (mode != XFERMODE_PINGPONG)){
+      fprintf(stderr, "Emulator: uDMA channel %d enabled with transfer mode %lu\n", DMA_TXCH, mode);
+      exit(1);
+    }
+    if(control[1] != 0x4000C000){
+      fprintf(stderr, "Emulator: uDMA channel %d destination is not UART0_DR_R\n", DMA_TXCH);
+      exit(1);
+    }
+    left = (ctl>>CHCTL_XFERSIZE_S)&0x3FF; // transfers left after this one
+    txPut(*((const unsigned char *)control[0]-left)); // byte source, incrementing
+    if(left){
+      control[2] = ctl-(1UL<<CHCTL_XFERSIZE_S);
+    } else{
+      dmaDone(control, mode);
+    }
+  }
+}
+
+// send the characters whose line time is over
+static void uartAdvance(unsigned long long now){
+  while(TxLevel && (now >= TxDone)){
+    TxLevel--;
+    if(TxLevel == txTrigger()){
+      REG(RIS) |= RIS_TXRIS;            // dropped to the trigger level
+    }
+    TxDone += characterCycles();
+    dmaService();
+    update();
+  }
+}
+
+static volatile unsigned long *uartAccess(unsigned long address){
+unsigned long offset = address-0x4000C000;
+  switch(offset){
+    case DR:
+      Emu_Watch();
+      readStdin(0);
+      Scratch = (RxPutI != RxGetI)?Rx[RxGetI%RXSIZE]:0;
+      return &Scratch;
+    case FR:
+      readStdin(0);
+      Scratch = ((TxLevel == 0)?FR_TXFE:FR_BUSY)|((TxLevel >= txDepth())?FR_TXFF:0)|
+                ((RxPutI == RxGetI)?FR_RXFE:0);
+      return &Scratch;
+    case MIS:
+      Scratch = REG(RIS)&REG(IM);
+      return &Scratch;
+    case ICR:
+      Scratch = 0;
+      return &Scratch;
+    default:
+      return &Reg[offset/4];
+  }
+}
+
+static void uartCommit(unsigned long address, unsigned long before, unsigned long after){
+  switch(address-0x4000C000){
+    case DR:
+      if(Emu_Written){                  // write: send
+        txPut((unsigned char)after);
+      } else if(RxPutI != RxGetI){      // read: take the character
+        RxGetI++;
+      }
+      break;
+    case ICR:
+      REG(RIS) &= ~after;
+      break;
+    case RIS:
+      REG(RIS) = before;                // read only
+      break;
+  }
+  dmaService();                         // DMACTL or the divisor may have changed
+  update();
+}
+
+// waiting for an interrupt: the next character sent, input already
+// there, or wait for stdin; a program waiting for input after stdin has
+// ended is finished, unless Emu_UARTEndExits says it only polls the
+// UART between other interrupts
+static unsigned long long uartIdle(int block){
+  if(Unflushed){
+    fflush(stdout);
+    Unflushed = 0;
+  }
+  if(TxLevel){
+    return (TxDone > Emu_Cycles)? TxDone-Emu_Cycles : 1;
+  }
+  if(!(REG(CTL)&CTL_UARTEN) || !(REG(IM)&(RIS_RXRIS|RIS_RTRIS))){
+    return 0;
+  }
+  if(!block){
+    readStdin(0);
+    update();
+    if(StdinEnd && (RxPutI == RxGetI) && Emu_UARTEndExits){
+      fprintf(stderr, "Emulator: waiting for UART0 input after the end of stdin\n");
+      exit(0);
+    }
+    return RxPutI != RxGetI;            // the next cycle sees it
+  }
+  readStdin(-1);
+  update();
+  return !StdinEnd || (RxPutI != RxGetI);
+}
+
+const EmuModel Emu_UARTModel = {
+  "UART0", 0x4000C000, 0x1000, uartAccess, uartCommit, uartAdvance, uartIdle
+};
+
+static volatile unsigned long *udmaAccess(unsigned long address){
+unsigned long offset = address-0x400FF000;
+  if(!Emu_UDMAClocked){
+    fprintf(stderr, "Emulator: uDMA register 0x%08lX accessed with the uDMA clock off\n", address);
+    exit(1);
+  }
+  if((offset >= DMA_PAIRS) && (offset <= DMA_PRIOCLR)){
+    Emu_Watch();                        // write 1 to set or clear
+    Scratch = DMAPAIR(offset&~4UL);
+    return &Scratch;
+  }
+  if(offset == DMA_CHIS){
+    Emu_Watch();                        // write 1 to clear
+    Scratch = DmaChis;
+    return &Scratch;
+  }
+  return &DmaReg[offset/4];
+}
+
+static void udmaCommit(unsigned long address, unsigned long before, unsigned long after){
+unsigned long offset = address-0x400FF000;
+  (void)before;
+  if(Emu_Written){
+    if((offset >= DMA_PAIRS) && (offset <= DMA_PRIOCLR)){
+      if(offset&4){
+        DMAPAIR(offset&~4UL) &= ~after;
+      } else{
+        DMAPAIR(offset) |= after;
+      }
+    } else if(offset == DMA_CHIS){
+      DmaChis &= ~after;
+    }
+  }
+  dmaService();
+  update();
+}
+
+const EmuModel Emu_UDMAModel = {
+  "uDMA", 0x400FF000, 0x1000, udmaAccess, udmaCommit, 0, 0
+};
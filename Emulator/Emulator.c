@@ -0,0 +1,554 @@
+// Emulator.c
+// Runs on Linux (x86-64 or any LP64 host)
+// Core of the host-side register emulation: dispatches register
+// accesses to the peripheral models, keeps plain memory for addresses
+// no model claims, models the NVIC, delivers interrupts, and stands in
+// for startup.s and the TExaS grader.
+
+#define _GNU_SOURCE                     // memfd_create
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include "Emulator.h"
+
+#if !defined(__LP64__)
+#error "the register models need a 64-bit unsigned long (LP64 host)"
+#endif
+
+#define MAXMODELS 16
+static const EmuModel *Models[MAXMODELS];
+static int NumModels;
+
+unsigned long long Emu_Cycles;
+unsigned long Emu_AccessCycles = 1;
+unsigned long Emu_ClockHz = 16000000;   // PIOSC until the PLL is started
+static unsigned long long CycleLimit;   // 0 for no limit
+
+// the access in progress, finished by Emu_Sync
+static const EmuModel *LastModel;
+static unsigned long LastAddress;
+static volatile unsigned long *LastStorage;
+static unsigned long LastBefore;
+int Emu_Written;
+
+// watched registers: the program gets a slot in pages it can only read,
+// the emulator fills the slot through a second, writable mapping of the
+// same pages; a store faults once, the fault handler marks the access
+// written and opens the page, and Emu_Sync closes it again, so a store
+// of the value just read is told apart from a read.  The fault and the
+// two mprotect calls cost microseconds, so only the registers whose
+// Access calls Emu_Watch get a slot, the rest return model storage.
+#define SLOTS 1024                      // distinct watched registers, 2 pages
+static int Watch;                       // set by Emu_Watch during an Access
+static volatile unsigned long *SlotView;// the program's read-only view
+static unsigned long *SlotAlias;        // the emulator's writable view
+static unsigned long SlotAddress[SLOTS];
+static char SlotUsed[SLOTS];
+static volatile unsigned long *LastSlot;// slot of the access in progress
+static void *OpenPage;                  // page opened by a store, 0 if none
+static unsigned long PageSize;
+
+//------------Emu_Watch------------
+// Called from a model's Access for a register whose writes act even
+// when they store the value just read, so Emu_Written is right for it
+// Input: none
+// Output: none
+void Emu_Watch(void){
+  Watch = 1;
+}
+
+// the same slot for every access to address, so REG = (REG&x)|y works
+// whichever Emu_Register call the compiler makes first
+static unsigned long slotOf(unsigned long address){
+unsigned long i = (address>>2)%SLOTS, n;
+  for(n = 0; n < SLOTS; n++){
+    if(!SlotUsed[i]){
+      SlotUsed[i] = 1;
+      SlotAddress[i] = address;
+      return i;
+    }
+    if(SlotAddress[i] == address){
+      return i;
+    }
+    i = (i+1)%SLOTS;
+  }
+  fprintf(stderr, "Emulator: out of register slots at 0x%08lX\n", address);
+  exit(1);
+}
+
+// SIGSEGV on a store to the slot of the access in progress, synchronous,
+// so the run stays deterministic; any other fault is a real crash
+static void stored(int number, siginfo_t *info, void *context){
+char *at = info->si_addr;
+  (void)number;
+  (void)context;
+  if(LastModel && (at >= (char *)LastSlot) && (at < (char *)(LastSlot+1))){
+    Emu_Written = 1;                    // the first store of this access
+    OpenPage = (void *)((unsigned long)at&~(PageSize-1));
+    mprotect(OpenPage, PageSize, PROT_READ|PROT_WRITE);
+    return;                             // the store runs again and goes through
+  }
+  if((at >= (char *)SlotView) && (at < (char *)(SlotView+SLOTS))){
+    static const char late[] = "Emulator: register stored after the next register access\n";
+    if(write(2, late, sizeof(late)-1)){};
+    _exit(1);
+  }
+  sigaction(SIGSEGV, &(struct sigaction){ .sa_handler = SIG_DFL }, 0);
+}
+
+static void watchStart(void){ int fd;
+struct sigaction action = { .sa_sigaction = stored, .sa_flags = SA_SIGINFO };
+  PageSize = (unsigned long)sysconf(_SC_PAGESIZE);
+  fd = memfd_create("registers", 0);
+  if((fd < 0) || (ftruncate(fd, SLOTS*sizeof(unsigned long)) != 0)){
+    perror("Emulator: memfd_create");
+    exit(1);
+  }
+  SlotAlias = mmap(0, SLOTS*sizeof(unsigned long), PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+  SlotView = mmap(0, SLOTS*sizeof(unsigned long), PROT_READ, MAP_SHARED, fd, 0);
+  if((SlotAlias == MAP_FAILED) || (SlotView == MAP_FAILED)){
+    perror("Emulator: mmap");
+    exit(1);
+  }
+  close(fd);
+  sigaction(SIGSEGV, &action, 0);
+}
+
+// plain memory for addresses no model claims, open addressing on the word address
+#define MEMORYSIZE 4096
+static struct{
+  unsigned long Address;
+  unsigned long Value;
+  int Used;
+} Memory[MEMORYSIZE];
+
+static volatile unsigned long *memoryWord(unsigned long address){
+unsigned long i = (address>>2)%MEMORYSIZE, n;
+  for(n = 0; n < MEMORYSIZE; n++){
+    if(!Memory[i].Used){
+      Memory[i].Used = 1;
+      Memory[i].Address = address;
+      Memory[i].Value = 0;              // registers the models do not know reset to 0
+      return &Memory[i].Value;
+    }
+    if(Memory[i].Address == address){
+      return &Memory[i].Value;
+    }
+    i = (i+1)%MEMORYSIZE;
+  }
+  fprintf(stderr, "Emulator: out of register memory at 0x%08lX\n", address);
+  exit(1);
+}
+
+//------------Emu_AddModel------------
+// Install a peripheral model, later models take precedence
+// Input: model, must stay valid while the program runs
+// Output: none
+void Emu_AddModel(const EmuModel *model){
+  if(NumModels == MAXMODELS){
+    fprintf(stderr, "Emulator: too many models, %s not added\n", model->Name);
+    exit(1);
+  }
+  Models[NumModels++] = model;
+}
+
+//------------Emu_Sync------------
+// Finish the last register access now instead of at the next one
+// Input: none
+// Output: none
+void Emu_Sync(void){ const EmuModel *model = LastModel;
+unsigned long after;
+  if(model){
+    LastModel = 0;
+    after = *LastStorage;
+    if(LastSlot){
+      after = *LastSlot;
+      if(Emu_Written){
+        *LastStorage = after;
+        mprotect(OpenPage, PageSize, PROT_READ);
+        OpenPage = 0;
+      }
+      LastSlot = 0;
+    }
+    if(model->Commit){
+      model->Commit(LastAddress, LastBefore, after);
+    }
+    Emu_Written = 0;
+  }
+}
+
+//********** NVIC and interrupt delivery **********
+static unsigned long Enabled;           // NVIC_EN0_R
+static unsigned long Pending;           // IRQs 0 to 31 requested
+static int SysTickPending;
+static int PriMask;                     // 1 when interrupts are disabled
+static int InHandler;                   // handlers do not nest here
+
+// handler statistics, index 0 is SysTick and irq+1 the IRQs
+static int Stats;                       // EMU_STATS set: print them at exit
+static unsigned long long Runs[33], Busy[33], Longest[33];
+
+static void unhandled(const char *name){
+  fprintf(stderr, "Emulator: %s has no handler\n", name);
+  exit(1);
+}
+// the labs override the handlers they use, as with the [WEAK] exports in startup.s
+void __attribute__((weak)) GPIOPortA_Handler(void){ unhandled("GPIOPortA_Handler"); }
+void __attribute__((weak)) GPIOPortB_Handler(void){ unhandled("GPIOPortB_Handler"); }
+void __attribute__((weak)) GPIOPortC_Handler(void){ unhandled("GPIOPortC_Handler"); }
+void __attribute__((weak)) GPIOPortD_Handler(void){ unhandled("GPIOPortD_Handler"); }
+void __attribute__((weak)) GPIOPortE_Handler(void){ unhandled("GPIOPortE_Handler"); }
+void __attribute__((weak)) UART0_Handler(void){ unhandled("UART0_Handler"); }
+void __attribute__((weak)) Timer0A_Handler(void){ unhandled("Timer0A_Handler"); }
+void __attribute__((weak)) Timer1A_Handler(void){ unhandled("Timer1A_Handler"); }
+void __attribute__((weak)) Timer2A_Handler(void){ unhandled("Timer2A_Handler"); }
+void __attribute__((weak)) GPIOPortF_Handler(void){ unhandled("GPIOPortF_Handler"); }
+void __attribute__((weak)) SysTick_Handler(void){ unhandled("SysTick_Handler"); }
+
+static void (*handler(int irq))(void){
+  switch(irq){
+    case EMU_IRQ_GPIOA:   return GPIOPortA_Handler;
+    case EMU_IRQ_GPIOB:   return GPIOPortB_Handler;
+    case EMU_IRQ_GPIOC:   return GPIOPortC_Handler;
+    case EMU_IRQ_GPIOD:   return GPIOPortD_Handler;
+    case EMU_IRQ_GPIOE:   return GPIOPortE_Handler;
+    case EMU_IRQ_UART0:   return UART0_Handler;
+    case EMU_IRQ_TIMER0A: return Timer0A_Handler;
+    case EMU_IRQ_TIMER1A: return Timer1A_Handler;
+    case EMU_IRQ_TIMER2A: return Timer2A_Handler;
+    case EMU_IRQ_GPIOF:   return GPIOPortF_Handler;
+    default:              return 0;
+  }
+}
+
+//------------Emu_SetPending------------
+// Request an interrupt, it runs at the next register access if
+// enabled in the NVIC (or in NVIC_ST_CTRL_R for SysTick) and
+// interrupts are not disabled
+// Input: irq is EMU_IRQ_xxx
+// Output: none
+void Emu_SetPending(int irq){
+  if(irq == EMU_IRQ_SYSTICK){
+    SysTickPending = 1;
+  } else{
+    Pending |= 1UL<<irq;
+  }
+}
+
+//------------Emu_ClearPending------------
+// Withdraw an interrupt request
+// Input: irq is EMU_IRQ_xxx
+// Output: none
+void Emu_ClearPending(int irq){
+  if(irq == EMU_IRQ_SYSTICK){
+    SysTickPending = 0;
+  } else{
+    Pending &= ~(1UL<<irq);
+  }
+}
+
+// 1 if an interrupt would be taken with interrupts enabled
+static int deliverable(void){
+  return SysTickPending || (Pending&Enabled);
+}
+
+// run pending interrupts, SysTick first, then IRQs in number order
+static void deliver(void){ int irq, index; void (*isr)(void);
+unsigned long long start, cycles;
+  while(!PriMask && !InHandler && deliverable()){
+    if(SysTickPending){
+      SysTickPending = 0;
+      isr = SysTick_Handler;
+      index = 0;
+    } else{
+      for(irq = 0; ((Pending&Enabled)&(1UL<<irq)) == 0; irq++){};
+      Pending &= ~(1UL<<irq);           // cleared on entry, the model asks again if still active
+      isr = handler(irq);
+      if(isr == 0){
+        fprintf(stderr, "Emulator: IRQ %d has no handler\n", irq);
+        exit(1);
+      }
+      index = irq+1;
+    }
+    InHandler = 1;
+    start = Emu_Cycles;
+    isr();
+    Emu_Sync();                         // finish the handler's last access before returning
+    InHandler = 0;
+    cycles = Emu_Cycles-start;
+    Runs[index]++;
+    Busy[index] += cycles;
+    if(cycles > Longest[index]){
+      Longest[index] = cycles;
+    }
+  }
+}
+
+// NVIC_EN0_R, NVIC_DIS0_R, NVIC_PEND0_R, NVIC_UNPEND0_R and the SysTick
+// bits of NVIC_INT_CTRL_R, the priority registers are plain memory
+static volatile unsigned long NVICStorage;
+static volatile unsigned long *nvicAccess(unsigned long address){
+  switch(address){
+    case 0xE000E100:                    // EN0, write 1 to enable
+    case 0xE000E180:                    // DIS0, write 1 to disable
+      Emu_Watch();
+      NVICStorage = Enabled;
+      return &NVICStorage;
+    case 0xE000E200:                    // PEND0, write 1 to request
+    case 0xE000E280:                    // UNPEND0, write 1 to withdraw
+      Emu_Watch();
+      NVICStorage = Pending;
+      return &NVICStorage;
+    case 0xE000ED04:                    // INT_CTRL, only the SysTick pending bits
+      Emu_Watch();
+      NVICStorage = SysTickPending? 0x04000000 : 0;
+      return &NVICStorage;
+    default:
+      return 0;
+  }
+}
+static void nvicCommit(unsigned long address, unsigned long before, unsigned long after){
+  (void)before;
+  if(!Emu_Written){
+    return;                             // read
+  }
+  switch(address){
+    case 0xE000E100: Enabled |= after;  break;
+    case 0xE000E180: Enabled &= ~after; break;
+    case 0xE000E200: Pending |= after;  break;
+    case 0xE000E280: Pending &= ~after; break;
+    case 0xE000ED04:
+      if(after&0x04000000){             // PENDSTSET
+        SysTickPending = 1;
+      }
+      if(after&0x02000000){             // PENDSTCLR
+        SysTickPending = 0;
+      }
+      break;
+  }
+}
+const EmuModel Emu_NVICModel = {
+  "NVIC", 0xE000E100, 0xC08, nvicAccess, nvicCommit, 0, 0
+};
+
+// move the clock and let the models catch up
+static void advance(unsigned long long cycles){ int i;
+  Emu_Cycles += cycles;
+  for(i = 0; i < NumModels; i++){
+    if(Models[i]->Advance){
+      Models[i]->Advance(Emu_Cycles);
+    }
+  }
+  if(CycleLimit && (Emu_Cycles >= CycleLimit)){
+    exit(0);
+  }
+}
+
+//------------Emu_Tick------------
+// Move the virtual clock forward, for code the emulator cannot see
+// such as a software delay loop; due interrupts run before returning
+// Input: cycles is the number of core clock cycles
+// Output: none
+void Emu_Tick(unsigned long long cycles){
+  Emu_Sync();
+  advance(cycles);
+  deliver();
+}
+
+// storage for address from the model that claims it, or plain memory
+// with *owner 0; the access is finished by the owner's Commit
+static volatile unsigned long *claim(unsigned long address, const EmuModel **owner){
+volatile unsigned long *storage;
+int i;
+  for(i = NumModels-1; i >= 0; i--){
+    if((address-Models[i]->Base) < Models[i]->Size){
+      storage = Models[i]->Access(address);
+      if(storage){
+        *owner = Models[i];
+        return storage;
+      }
+    }
+  }
+  *owner = 0;
+  return memoryWord(address);
+}
+
+// peripheral bit-band region: word n of 0x42000000 is bit n%32 of the
+// word at 0x40000000+4*(n/32); a read gives the bit, a write of a new
+// value is a read-modify-write of the word that the program cannot see
+// half done, a write that leaves the bit as it was changes nothing
+static volatile unsigned long BitBandStorage;
+static unsigned long bitBandWord(unsigned long address){
+  return 0x40000000+(((address-0x42000000)>>5)&~3UL);
+}
+static volatile unsigned long *bitBandAccess(unsigned long address){
+const EmuModel *owner;
+volatile unsigned long *storage = claim(bitBandWord(address), &owner);
+unsigned long value = *storage;
+  Watch = 0;                            // the alias is not watched
+  if(owner && owner->Commit){
+    owner->Commit(bitBandWord(address), value, value); // a read, Emu_Written is 0
+  }
+  BitBandStorage = (value>>((address>>2)&31))&1;
+  return &BitBandStorage;
+}
+static void bitBandCommit(unsigned long address, unsigned long before, unsigned long after){
+const EmuModel *owner;
+volatile unsigned long *storage;
+unsigned long bit = 1UL<<((address>>2)&31), value;
+  if(((after^before)&1) == 0){
+    return;
+  }
+  storage = claim(bitBandWord(address), &owner);
+  value = *storage;
+  *storage = (after&1)? (value|bit) : (value&~bit);
+  if(owner && owner->Commit){           // a write, Emu_Written is 1
+    owner->Commit(bitBandWord(address), value, *storage);
+  }
+}
+static const EmuModel BitBandModel = {
+  "BitBand", 0x42000000, 0x02000000, bitBandAccess, bitBandCommit, 0, 0
+};
+
+//------------Emu_Register------------
+// Storage for one register access, called through HWREG
+// Finishes the previous access, lets pending interrupts run, then
+// asks the model that owns address for the storage
+// Input: address of a 32-bit register
+// Output: pointer valid until the next Emu_Register call
+volatile unsigned long *Emu_Register(unsigned long address){
+volatile unsigned long *storage;
+const EmuModel *owner;
+unsigned long slot;
+  Emu_Sync();
+  deliver();
+  advance(Emu_AccessCycles);
+  Watch = 0;
+  storage = claim(address, &owner);
+  if(!owner){
+    return storage;                     // plain memory needs no commit
+  }
+  LastModel = owner;
+  LastAddress = address;
+  LastStorage = storage;
+  LastBefore = *storage;
+  if(!Watch){
+    return storage;
+  }
+  slot = slotOf(address);
+  LastSlot = &SlotView[slot];
+  SlotAlias[slot] = LastBefore;
+  return LastSlot;
+}
+
+//********** stand-ins for the functions at the end of startup.s **********
+void DisableInterrupts(void){
+  Emu_Sync();
+  PriMask = 1;
+}
+void EnableInterrupts(void){
+  Emu_Sync();
+  PriMask = 0;
+  deliver();
+}
+long StartCritical(void){ long sr = PriMask;
+  Emu_Sync();
+  PriMask = 1;
+  return sr;
+}
+void EndCritical(long sr){
+  Emu_Sync();
+  PriMask = (int)sr;
+  deliver();
+}
+// skip the clock ahead to the next event until an interrupt is pending,
+// only waiting for outside input when no timed event is left
+static void idle(void){ int i, alive;
+unsigned long long next, n;
+  while(!deliverable()){
+    next = 0;
+    for(i = 0; i < NumModels; i++){
+      if(Models[i]->Idle){
+        n = Models[i]->Idle(0);
+        if(n && (next == 0 || n < next)){
+          next = n;
+        }
+      }
+    }
+    if(next){
+      advance(next);
+      continue;
+    }
+    alive = 0;
+    for(i = 0; i < NumModels; i++){
+      if(Models[i]->Idle && Models[i]->Idle(1)){
+        alive = 1;
+      }
+    }
+    if(!alive && !deliverable()){
+      fflush(stdout);
+      fprintf(stderr, "Emulator: waiting for an interrupt with no interrupt source left\n");
+      _exit(0);
+    }
+  }
+}
+// wakes on any pending interrupt, even with interrupts disabled, as WFI does
+void WaitForInterrupt(void){
+  Emu_Sync();
+  idle();
+  deliver();
+}
+
+//********** stand-ins for the TExaS grader **********
+// the labs declare TExaS_Init with different parameters, none are used here
+void TExaS_Init(){                      // the grader starts the PLL at 80 MHz
+  *Emu_Register(0x400FE070) = 0xC1000000; // RCC2: USERCC2, DIV400, 400 MHz/5
+  Emu_Sync();                           // so Clock_Frequency reads it back
+}
+void TExaS_Stop(void){
+}
+
+static void finish(void){ int i;
+  fflush(stdout);
+  if(!Stats){
+    return;
+  }
+  fprintf(stderr, "Emulator: %llu cycles\n", Emu_Cycles);
+  for(i = 0; i < 33; i++){
+    if(Runs[i]){
+      if(i == 0){
+        fprintf(stderr, "  SysTick");
+      } else{
+        fprintf(stderr, "  IRQ %2d ", i-1);
+      }
+      fprintf(stderr, " runs %llu, longest %llu cycles, busy %llu cycles\n",
+        Runs[i], Longest[i], Busy[i]);
+    }
+  }
+}
+
+// install the standard models before main runs
+__attribute__((constructor)) static void emulatorStart(void){ const char *limit;
+  watchStart();
+  Emu_AddModel(&Emu_NVICModel);
+  Emu_AddModel(&BitBandModel);
+  Emu_AddModel(&Emu_SysCtlModel);
+  Emu_AddModel(&Emu_GPIOModel);
+  Emu_AddModel(&Emu_SysTickModel);
+  Emu_AddModel(&Emu_TimerModel);
+  Emu_AddModel(&Emu_UARTModel);
+  Emu_AddModel(&Emu_UDMAModel);
+  limit = getenv("EMU_CYCLES");
+  if(limit){
+    CycleLimit = strtoull(limit, 0, 0);
+  }
+  limit = getenv("EMU_STATS");
+  Stats = limit && (*limit != '0');
+  limit = getenv("EMU_ACCESSCYCLES");
+  if(limit){
+    Emu_AccessCycles = strtoul(limit, 0, 0);
+  }
+  atexit(finish);
+}
@@ -0,0 +1,198 @@
+// Emulator.h
+// Runs on Linux (x86-64 or any LP64 host)
+// Host-side register emulation for the TM4C123 labs.
+// tm4c123gh6pm.h includes this file when HOST_EMULATION is defined, so
+// every register name resolves to Emu_Register() instead of an absolute
+// address.  Peripheral models plug in with Emu_AddModel; the standard
+// models are GPIO ports A-F, SysTick, timer A of Timer0-2, UART0 with
+// its uDMA transmit channel, the NVIC and the system control block
+// (clock gating and the PLL lock flag).  Addresses no model claims behave as plain memory.  The
+// peripheral bit-band aliases (0x42000000-0x43FFFFFF) work for every model.
+
+// Build a lab as a Linux executable from the lab folder with all of its
+// sources and the shared ones it uses, for example Lab 10:
+//   gcc -DHOST_EMULATION -I.. -I. -o lab10 TableTrafficLight.c Intersection.c Dwell.c ../Lab11_UART/UART.c ../Clock.c ../Gpio.c ../Debounce.c ../Emulator/*.c
+// The build line at the top of each bench (UARTBench.c, SensorBench.c ...)
+// lists the sources for its lab.
+// The grader (texas.o) and startup.s are replaced by stand-ins here.
+// The program runs until main returns, EMU_CYCLES cycles have elapsed
+// (environment variable), or it waits for an interrupt that can never come.
+// UART0 output goes to stdout, UART0 input comes from stdin.
+// The clock only moves on register accesses, Emu_Tick and
+// WaitForInterrupt, so every run of a program with the same input takes
+// the same cycles.  A loop waiting on memory an interrupt changes must
+// sleep in WaitForInterrupt (or touch a register, or call Emu_Tick):
+// one that spins on memory alone never lets the interrupt come.
+// EMU_TRACE=1 prints every output pin change with its cycle, EMU_STATS=1
+// prints the runs and longest run of each handler at exit.
+// Handler cycles count register accesses only (Emu_AccessCycles each),
+// not the instructions in between.
+
+#ifndef __EMULATOR_H__
+#define __EMULATOR_H__
+
+#define HWREG(x)      (*Emu_Register(x))
+
+// Keil compiler keywords used by the labs
+#define __align(n)    __attribute__((aligned(n)))
+// ARMCC DSP intrinsics, with the saturating results of QADD and SSAT
+static inline int __qadd(int a, int b){ long long s = (long long)a+b;
+  return (s > 0x7FFFFFFFLL)? 0x7FFFFFFF : (s < -0x80000000LL)? (int)-0x80000000LL : (int)s;
+}
+static inline int __ssat(int x, unsigned int n){ int max = (1<<(n-1))-1;
+  return (x > max)? max : (x < -max-1)? -max-1 : x;
+}
+
+// interrupt numbers, the same as the IRQ bit positions in NVIC_EN0_R
+#define EMU_IRQ_GPIOA   0
+#define EMU_IRQ_GPIOB   1
+#define EMU_IRQ_GPIOC   2
+#define EMU_IRQ_GPIOD   3
+#define EMU_IRQ_GPIOE   4
+#define EMU_IRQ_UART0   5
+#define EMU_IRQ_TIMER0A 19
+#define EMU_IRQ_TIMER1A 21
+#define EMU_IRQ_TIMER2A 23
+#define EMU_IRQ_GPIOF   30
+#define EMU_IRQ_SYSTICK (-1)  // SysTick is a system exception, not an IRQ
+
+typedef struct t_EmuModel{
+  const char *Name;
+  unsigned long Base;       // first address claimed by the model
+  unsigned long Size;       // bytes claimed
+  // return the storage the program reads or writes for address,
+  // already holding the value a read should see, or 0 to treat the
+  // address as plain memory
+  volatile unsigned long *(*Access)(unsigned long address);
+  // called after the program is done with the storage from Access,
+  // before is what Access put there and after is what is there now;
+  // for a register whose Access called Emu_Watch, Emu_Written tells a
+  // store of an unchanged value from a read
+  void (*Commit)(unsigned long address, unsigned long before, unsigned long after);
+  // the virtual clock has moved to now (in core cycles), catch up and
+  // request any interrupt that became due on the way
+  void (*Advance)(unsigned long long now);
+  // the program is waiting for an interrupt: return the cycles until the
+  // model's next event, 0 if it has none; when block is 1 a model fed
+  // from outside the program may wait for input in real time and returns
+  // nonzero if more input can still come
+  unsigned long long (*Idle)(int block);
+}EmuModel;
+
+//------------Emu_Register------------
+// Storage for one register access, called through HWREG
+// Finishes the previous access, lets pending interrupts run, then
+// asks the model that owns address for the storage
+// Input: address of a 32-bit register
+// Output: pointer valid until the next Emu_Register call
+volatile unsigned long *Emu_Register(unsigned long address);
+
+//------------Emu_AddModel------------
+// Install a peripheral model, later models take precedence
+// Input: model, must stay valid while the program runs
+// Output: none
+void Emu_AddModel(const EmuModel *model);
+
+//------------Emu_Watch------------
+// Called from a model's Access for a register whose writes act even
+// when they store the value just read, so Emu_Written is right for it
+// Input: none
+// Output: none
+void Emu_Watch(void);
+
+//------------Emu_Sync------------
+// Finish the last register access now instead of at the next one
+// Input: none
+// Output: none
+void Emu_Sync(void);
+
+//------------Emu_SetPending------------
+// Request an interrupt, it runs at the next register access if
+// enabled in the NVIC (or in NVIC_ST_CTRL_R for SysTick) and
+// interrupts are not disabled
+// Input: irq is EMU_IRQ_xxx
+// Output: none
+void Emu_SetPending(int irq);
+
+//------------Emu_ClearPending------------
+// Withdraw an interrupt request
+// Input: irq is EMU_IRQ_xxx
+// Output: none
+void Emu_ClearPending(int irq);
+
+//------------Emu_Tick------------
+// Move the virtual clock forward, for code the emulator cannot see
+// such as a software delay loop; due interrupts run before returning
+// Input: cycles is the number of core clock cycles
+// Output: none
+void Emu_Tick(unsigned long long cycles);
+
+// virtual clock in core cycles, advanced Emu_AccessCycles per register
+// access, by Emu_Tick, and up to the next event while waiting for an
+// interrupt; it depends only on the program and its input, so timing
+// measured against it is the same on every run
+extern unsigned long long Emu_Cycles;
+// cycles charged for one register access, 1 unless changed here or by
+// the EMU_ACCESSCYCLES environment variable
+extern unsigned long Emu_AccessCycles;
+// core clock in Hz, follows the PLL settings in the system control model
+extern unsigned long Emu_ClockHz;
+// 1 while a Commit runs if the program stored to a watched register,
+// even the value it read (as NVIC_EN0_R |= bit does), 0 for a read
+// only or a register that is not watched; the store is caught by a
+// page fault, not by marking the value
+extern int Emu_Written;
+
+//------------Emu_GPIOInput------------
+// Drive input pins from outside the program
+// Pins not driven read their pull-up/pull-down level
+// Input: port 0 (A) to 5 (F)
+//        mask selects the pins driven by this call
+//        level is the value for those pins
+// Output: none
+void Emu_GPIOInput(int port, unsigned long mask, unsigned long level);
+
+//------------Emu_GPIORelease------------
+// Stop driving input pins, they go back to their pull level
+// Input: port 0 (A) to 5 (F), mask selects the pins
+// Output: none
+void Emu_GPIORelease(int port, unsigned long mask);
+
+//------------Emu_GPIOOutput------------
+// Current level of a port's output pins
+// Input: port 0 (A) to 5 (F)
+// Output: DATA latch masked by DIR
+unsigned long Emu_GPIOOutput(int port);
+
+// called whenever output pins change, 0 for none
+extern void (*Emu_GPIOChanged)(int port, unsigned long before, unsigned long after);
+
+//------------Emu_UARTInput------------
+// Queue characters for the program to receive on UART0
+// Input: data and count of the characters
+// Output: none
+void Emu_UARTInput(const char *data, unsigned long count);
+
+// called with every character the program sends on UART0,
+// 0 (the default) writes it to stdout
+extern void (*Emu_UARTOutput)(unsigned char data);
+// 1 (the default): a program that waits for an interrupt with UART0
+// receive interrupts armed, stdin ended and nothing left to receive is
+// finished; 0 for a program that only checks the UART between other
+// interrupts, such as a timer, and runs on without input
+extern int Emu_UARTEndExits;
+
+// 1 while the uDMA has its clock (RCGCDMA or RCGC2), a uDMA register
+// access without it stops the program
+extern int Emu_UDMAClocked;
+
+// the standard models, installed before main runs
+extern const EmuModel Emu_GPIOModel;
+extern const EmuModel Emu_SysTickModel;
+extern const EmuModel Emu_UARTModel;
+extern const EmuModel Emu_SysCtlModel;
+extern const EmuModel Emu_NVICModel;
+extern const EmuModel Emu_TimerModel;
+extern const EmuModel Emu_UDMAModel;
+
+#endif // __EMULATOR_H__
@@ -0,0 +1,90 @@
+// Gpio.c
+// Runs on TM4C123 or LM4F120
+// Table-driven GPIO setup for the labs, see Gpio.h.
+
+#include "tm4c123gh6pm.h"
+#include "Gpio.h"
+
+#define PORTS 6
+
+// register offsets from a port's base address
+#define DIR   0x400
+#define AFSEL 0x420
+#define PUR   0x510
+#define PDR   0x514
+#define DEN   0x51C
+#define LOCK  0x520
+#define CR    0x524
+#define AMSEL 0x528
+#define PCTL  0x52C
+
+static const unsigned long Base[PORTS]={
+  GPIO_PORTA, GPIO_PORTB, GPIO_PORTC, GPIO_PORTD, GPIO_PORTE, GPIO_PORTF
+};
+// pins that stay locked until unlocked, PD7 and PF0 (NMI)
+static const unsigned char Locked[PORTS]={0x00, 0x00, 0x00, 0x80, 0x00, 0x01};
+
+// RCGCGPIO/PRGPIO bit of a port, 0 to 5
+static unsigned long portIndex(unsigned long port){
+  if(port >= GPIO_PORTE){
+    return 4+((port-GPIO_PORTE)>>12);
+  }
+  return (port-GPIO_PORTA)>>12;
+}
+
+//------------Gpio_ConfigureAll------------
+// Set up the pins of a table as plain digital GPIO: the clocks of all its
+// ports are turned on together through RCGCGPIO and PRGPIO is polled
+// once, then for each port LOCK/CR (PF0 and PD7 only), AMSEL, PCTL,
+// DIR, AFSEL, PUR, PDR and DEN are each written once.  Pins not in the
+// table keep their configuration, so modules can call it for their own
+// pins; a pin listed twice gets the last mode.  Interrupts and
+// alternate functions are left to the drivers.
+// Input: table of pins and its number of entries
+// Output: none
+void Gpio_ConfigureAll(const GpioConfig table[], unsigned long count){
+unsigned char used[PORTS] = {0}, out[PORTS] = {0}, up[PORTS] = {0}, down[PORTS] = {0};
+unsigned long i, p, clocks = 0, port, pins, pctl;
+  for(i = 0; i < count; i++){         // masks of every port first, no bus access
+    p = portIndex(table[i].Port);
+    pins = table[i].Pins;
+    used[p] |= pins;
+    out[p] &= ~pins;
+    up[p] &= ~pins;
+    down[p] &= ~pins;
+    if(table[i].Mode&GPIO_OUT){
+      out[p] |= pins;
+    } else if(table[i].Mode&GPIO_PULLUP){
+      up[p] |= pins;
+    } else if(table[i].Mode&GPIO_PULLDOWN){
+      down[p] |= pins;
+    }
+    clocks |= 1<<p;
+  }
+  SYSCTL_RCGCGPIO_R |= clocks;        // 1) all the clocks at once
+  while((SYSCTL_PRGPIO_R&clocks) != clocks){}; // and wait for them together
+  for(p = 0; p < PORTS; p++){
+    if(used[p] == 0){
+      continue;
+    }
+    port = Base[p];
+    pins = used[p];
+    if(pins&Locked[p]){               // 2) unlock, the other pins' CR bits are always 1
+      HWREG(port+LOCK) = 0x4C4F434B;
+      HWREG(port+CR) = 0xFF;
+    }
+    pctl = 0;
+    for(i = 0; i < 8; i++){
+      if(pins&(1<<i)){
+        pctl |= 0xFUL<<(4*i);
+      }
+    }
+    HWREG(port+AMSEL) &= ~pins;       // 3) disable analog
+    HWREG(port+PCTL) &= ~pctl;        // 4) GPIO function
+    HWREG(port+DIR) = (HWREG(port+DIR)&~pins)|out[p]; // 5) direction
+    HWREG(port+AFSEL) &= ~pins;       // 6) no alternate function
+    HWREG(port+PUR) = (HWREG(port+PUR)&~pins)|up[p];
+    HWREG(port+PDR) = (HWREG(port+PDR)&~pins)|down[p];
+    HWREG(port+DEN) |= pins;          // 7) enable digital I/O
+  }
+}
@@ -0,0 +1,70 @@
+// Gpio.h
+// Runs on TM4C123 or LM4F120
+// Single-store access to GPIO pins, for the labs.
+// GPIO_PORTx_DATA_R is the DATA alias with all eight pins unmasked, so
+// "GPIO_PORTF_DATA_R |= 0x08" is a read, an OR and a write: it is three
+// instructions, and an interrupt that changes another pin of the port
+// between the read and the write has its change undone.
+// The GPIO hardware offers two aliases that avoid the read entirely:
+//  - address masking: bits 9:2 of a DATA address select the pins the
+//    access reads or writes, the others are unchanged and read as 0;
+//    GPIO_PINS(GPIO_PORTF,0x0A) = 0x08 sets PF3 and clears PF1 in one store
+//  - bit-banding: every bit of the peripheral region 0x40000000-0x400FFFFF
+//    has a word in 0x42000000-0x43FFFFFF, writing 0 or 1 there clears or
+//    sets that bit alone, in one store the bus makes atomic
+// Both compile to a single STR to a constant address.  The pin masks
+// must be constants and the port must be on the APB bus (the default).
+// Gpio_ConfigureAll (Gpio.c) sets up the pins of a whole board from one
+// const table: each port's clock, unlock and configuration registers are
+// written once, with the masks of every entry for that port combined.
+
+#ifndef __GPIO_H__
+#define __GPIO_H__
+
+#include "tm4c123gh6pm.h"
+
+// APB base address of each port
+#define GPIO_PORTA 0x40004000
+#define GPIO_PORTB 0x40005000
+#define GPIO_PORTC 0x40006000
+#define GPIO_PORTD 0x40007000
+#define GPIO_PORTE 0x40024000
+#define GPIO_PORTF 0x40025000
+
+// DATA of the pins in mask (0x01 to 0xFF); a read gives the pins in
+// mask and 0 for the others, a write changes the pins in mask only
+#define GPIO_PINS(port,mask) HWREG((port)+((mask)<<2))
+
+// bit-band alias of one bit of a peripheral register; reads 0 or 1,
+// writing 0 or 1 clears or sets the bit without touching the others
+#define BITBAND(address,bit) HWREG(0x42000000+(((address)-0x40000000)<<5)+((bit)<<2))
+
+// one pin (0 to 7) through the bit-band alias of the full DATA register
+#define GPIO_PIN(port,pin) BITBAND((port)+0x3FC,pin)
+
+// pin modes of a GpioConfig entry, digital GPIO only
+#define GPIO_IN       0x00              // input, no pull resistor
+#define GPIO_OUT      0x01              // output
+#define GPIO_PULLUP   0x02              // input with pull-up, a switch to ground
+#define GPIO_PULLDOWN 0x04              // input with pull-down, a switch to 3.3 V
+
+// one line of a board's pin table
+typedef struct t_GpioConfig{
+	unsigned long Port;               // GPIO_PORTx
+	unsigned char Pins;               // mask, 0x01 to 0xFF
+	unsigned char Mode;               // GPIO_IN, GPIO_OUT, GPIO_PULLUP or GPIO_PULLDOWN
+}GpioConfig;
+
+//------------Gpio_ConfigureAll------------
+// Set up the pins of a table as plain digital GPIO: the clocks of all its
+// ports are turned on together through RCGCGPIO and PRGPIO is polled
+// once, then for each port LOCK/CR (PF0 and PD7 only), AMSEL, PCTL,
+// DIR, AFSEL, PUR, PDR and DEN are each written once.  Pins not in the
+// table keep their configuration, so modules can call it for their own
+// pins; a pin listed twice gets the last mode.  Interrupts and
+// alternate functions are left to the drivers.
+// Input: table of pins and its number of entries
+// Output: none
+void Gpio_ConfigureAll(const GpioConfig table[], unsigned long count);
+
+#endif // __GPIO_H__
@@ -0,0 +1,169 @@
+// Dwell.c
+// Runs on LM4F120/TM4C123
+// Tickless dwell timer on Timer1A, see Dwell.h.
+
+#include "tm4c123gh6pm.h"
+#include "Dwell.h"
+#include "..//Clock.h"
+
+void DisableInterrupts(void); // Disable interrupts
+void EnableInterrupts(void);  // Enable interrupts
+void WaitForInterrupt(void);  // low power mode, in startup.s
+
+// Time is kept in us so deadlines survive a clock change.  Timer2A
+// counts bus cycles since the epoch, and us = (cycles*1000000+EpochRest)/Hz
+// from there, exactly: the remainder carries over when the epoch moves.
+static unsigned long Hz;                // bus clock
+static unsigned long EpochUs;           // Dwell_Now at the epoch
+static unsigned long EpochRest;         // fraction of a us past EpochUs, in us*Hz units
+static unsigned long EpochCount;        // Timer2A count at the epoch
+static unsigned long Deadline;          // of the dwell in progress, to retime it after a clock change
+static volatile unsigned long Expired;  // set by Timer1A_Handler
+static unsigned long Wakeups;           // WFI returns since the last Dwell_Wakeups
+
+// time since the epoch at Timer2A count, in us*Hz units
+static unsigned long long since(unsigned long count){
+  return (unsigned long long)((EpochCount-count)&0xFFFFFFFF)*1000000+EpochRest;
+}
+
+// move the epoch to Timer2A count, keeping the time it stands for
+static void rebase(unsigned long count){ unsigned long long time = since(count);
+  EpochUs = (EpochUs+(unsigned long)(time/Hz))&0xFFFFFFFF;
+  EpochRest = (unsigned long)(time%Hz);
+  EpochCount = count;
+}
+
+// Clock_SetFrequency calls these with interrupts disabled: close the
+// epoch at the old clock, open a new one at the new clock and retime the
+// dwell in progress; the few cycles of the switch itself are not counted
+static void clockBefore(unsigned long hz){
+  (void)hz;                         // the epoch closes at the old clock
+  rebase(TIMER2_TAV_R&0xFFFFFFFF);
+}
+static void clockAfter(unsigned long hz){
+  EpochCount = TIMER2_TAV_R&0xFFFFFFFF;
+  EpochRest = (unsigned long)((unsigned long long)EpochRest*hz/Hz);
+  Hz = hz;
+  if(!Expired){
+    Dwell_Until(Deadline);
+  }
+}
+
+//------------Dwell_Init------------
+// Start the Timer2A time base at the current bus clock and set up
+// Timer1A as a one-shot timer
+// Input: none
+// Output: none
+void Dwell_Init(void){
+  Hz = Clock_Frequency();
+  EpochUs = EpochRest = 0;
+  Expired = 1;
+  Wakeups = 0;
+  SYSCTL_RCGCTIMER_R |= 0x06;       // activate Timer1 and Timer2
+  while((SYSCTL_PRTIMER_R&0x06) != 0x06){};
+  TIMER2_CTL_R = 0x00000000;        // disable Timer2A during setup
+  TIMER2_CFG_R = 0x00000000;        // 32-bit mode
+  TIMER2_TAMR_R = 0x00000002;       // periodic mode, default down-count
+  TIMER2_TAILR_R = 0xFFFFFFFF;      // full range, Dwell_Cycles is ~TIMER2_TAV_R
+  TIMER2_TAPR_R = 0;                // no prescale
+  TIMER2_IMR_R = 0x00000000;        // no interrupts, it only keeps time
+  TIMER2_CTL_R = 0x00000001;        // enable Timer2A
+  TIMER1_CTL_R = 0x00000000;        // disable Timer1A during setup
+  TIMER1_CFG_R = 0x00000000;        // 32-bit mode
+  TIMER1_TAMR_R = 0x00000001;       // one-shot mode, default down-count
+  TIMER1_TAPR_R = 0;                // no prescale
+  TIMER1_ICR_R = 0x00000001;        // clear timeout flag
+  TIMER1_IMR_R = 0x00000001;        // arm timeout interrupt
+  NVIC_PRI5_R = (NVIC_PRI5_R&0xFFFF00FF)|0x00004000; // IRQ 21 priority 2
+  NVIC_EN0_R = 1<<21;               // enable IRQ 21 in NVIC
+  EpochCount = TIMER2_TAV_R&0xFFFFFFFF;
+  Clock_Register(clockBefore, clockAfter);
+}
+
+//------------Dwell_Now------------
+// Microseconds since Dwell_Init, wraps after 2^32 us (71.6 minutes)
+// Must be called at least every 2^32 bus cycles (53.7 s at 80 MHz),
+// Dwell_Until does
+// Input: none
+// Output: time, the starting point for Dwell_After
+unsigned long Dwell_Now(void){ unsigned long count = TIMER2_TAV_R&0xFFFFFFFF;
+  if(((EpochCount-count)&0xFFFFFFFF) >= 0x80000000){
+    rebase(count);                  // before Timer2A comes round to the epoch again
+  }
+  return (EpochUs+(unsigned long)(since(count)/Hz))&0xFFFFFFFF;
+}
+
+//------------Dwell_Cycles------------
+// Bus cycles, free-running, for timing short stretches of code
+// Input: none
+// Output: cycle count, wraps after 2^32 cycles
+unsigned long Dwell_Cycles(void){
+  return (~TIMER2_TAV_R)&0xFFFFFFFF;  // Timer2A counts down from 0xFFFFFFFF
+}
+
+//------------Dwell_After------------
+// Deadline a number of ticks after another one
+// Input: deadline from Dwell_Now or Dwell_After
+//        ticks is 1 to DWELL_MAXTICKS
+// Output: deadline for Dwell_Until
+unsigned long Dwell_After(unsigned long deadline, unsigned long ticks){
+  return (deadline+ticks*(1000000/DWELL_TICKHZ))&0xFFFFFFFF;
+}
+
+//------------Dwell_Until------------
+// Start timing a dwell up to an absolute deadline, replacing any dwell
+// in progress; a deadline already passed ends the dwell at once
+// Input: deadline from Dwell_After
+// Output: none
+void Dwell_Until(unsigned long deadline){ unsigned long left;
+  Deadline = deadline;
+  TIMER1_CTL_R = 0x00000000;        // stop the dwell in progress
+  TIMER1_ICR_R = 0x00000001;        // and forget its timeout
+  left = (deadline-Dwell_Now())&0xFFFFFFFF;
+  if((left == 0) || (left >= 0x80000000)){
+    Expired = 1;                    // passed: the difference is negative as a 32-bit signed number
+    return;
+  }
+  Expired = 0;                      // reload value, the timeout comes one cycle after 0
+  TIMER1_TAILR_R = (unsigned long)((unsigned long long)left*Hz/1000000)-1;
+  TIMER1_CTL_R = 0x00000001;        // count down once
+}
+
+// the dwell is over, Timer1A stopped by itself
+void Timer1A_Handler(void){
+  TIMER1_ICR_R = 0x00000001;        // acknowledge timeout
+  Expired = 1;
+}
+
+//------------Dwell_Expired------------
+// Check the dwell without waiting
+// Input: none
+// Output: 1 if the dwell from Dwell_Until is over, 0 if not
+int Dwell_Expired(void){
+  return Expired;
+}
+
+//------------Dwell_Wait------------
+// Sleep until the dwell from Dwell_Until is over; other interrupts
+// run their handlers and the CPU goes back to sleep
+// Input: none
+// Output: none
+void Dwell_Wait(void){
+  DisableInterrupts();              // no interrupt between the check and the sleep
+  while(!Expired){
+    WaitForInterrupt();             // wakes on a pending interrupt even with I=1
+    Wakeups = Wakeups+1;
+    EnableInterrupts();             // the handler runs now
+    DisableInterrupts();
+  }
+  EnableInterrupts();
+}
+
+//------------Dwell_Wakeups------------
+// Times Dwell_Wait woke up since Dwell_Init or the last call
+// Input: none
+// Output: wakeup count
+unsigned long Dwell_Wakeups(void){ unsigned long wakeups = Wakeups;
+  Wakeups = 0;
+  return wakeups;
+}
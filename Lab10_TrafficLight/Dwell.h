@@ -0,0 +1,78 @@
+// Dwell.h
+// Runs on LM4F120/TM4C123
+// Tickless waiting for the traffic light.  Timer2A runs free at the bus
+// clock as the time base; Timer1A runs once, in one-shot mode, up to the
+// absolute deadline of the current state and the CPU sleeps (WFI) until
+// it expires.  Deadlines are computed from the previous deadline, not
+// from the time the program got round to it, so interrupt latency and
+// the work at each transition never add up over a cycle of states.
+// Nothing runs at a fixed rate: a dwell costs one wakeup at its end,
+// plus one for each other interrupt on the way.
+// Deadlines are in microseconds, not bus cycles, and Dwell registers
+// with Clock_SetFrequency (Clock.c must be in the project): a clock
+// change rescales the time base and retimes the dwell in progress.
+// Interrupts must be enabled except inside Dwell_Wait.
+
+#ifndef __DWELL_H__
+#define __DWELL_H__
+
+// dwell ticks per second, dwell times are given in ticks (ms)
+#define DWELL_TICKHZ 1000
+// longest dwell, a dwell must stay within 2^32 bus cycles (53.7 s at 80 MHz)
+#define DWELL_MAXTICKS 20000
+
+//------------Dwell_Init------------
+// Start the Timer2A time base at the current bus clock and set up
+// Timer1A as a one-shot timer
+// Input: none
+// Output: none
+void Dwell_Init(void);
+
+//------------Dwell_Now------------
+// Microseconds since Dwell_Init, wraps after 2^32 us (71.6 minutes)
+// Must be called at least every 2^32 bus cycles (53.7 s at 80 MHz),
+// Dwell_Until does
+// Input: none
+// Output: time, the starting point for Dwell_After
+unsigned long Dwell_Now(void);
+
+//------------Dwell_Cycles------------
+// Bus cycles, free-running, for timing short stretches of code
+// Input: none
+// Output: cycle count, wraps after 2^32 cycles
+unsigned long Dwell_Cycles(void);
+
+//------------Dwell_After------------
+// Deadline a number of ticks after another one
+// Input: deadline from Dwell_Now or Dwell_After
+//        ticks is 1 to DWELL_MAXTICKS
+// Output: deadline for Dwell_Until
+unsigned long Dwell_After(unsigned long deadline, unsigned long ticks);
+
+//------------Dwell_Until------------
+// Start timing a dwell up to an absolute deadline, replacing any dwell
+// in progress; a deadline already passed ends the dwell at once
+// Input: deadline from Dwell_After
+// Output: none
+void Dwell_Until(unsigned long deadline);
+
+//------------Dwell_Expired------------
+// Check the dwell without waiting
+// Input: none
+// Output: 1 if the dwell from Dwell_Until is over, 0 if not
+int Dwell_Expired(void);
+
+//------------Dwell_Wait------------
+// Sleep until the dwell from Dwell_Until is over; other interrupts
+// run their handlers and the CPU goes back to sleep
+// Input: none
+// Output: none
+void Dwell_Wait(void);
+
+//------------Dwell_Wakeups------------
+// Times Dwell_Wait woke up since Dwell_Init or the last call
+// Input: none
+// Output: wakeup count
+unsigned long Dwell_Wakeups(void);
+
+#endif // __DWELL_H__
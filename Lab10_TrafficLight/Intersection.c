@@ -0,0 +1,329 @@
+// Intersection.c
+// Runs on LM4F120/TM4C123
+// The traffic light's Moore machine and the engine that runs it for any
+// number of intersections, see Intersection.h.
+// Daniel Valvano, Jonathan Valvano
+// November 7, 2013
+
+#include "tm4c123gh6pm.h"
+#include "Dwell.h"
+#include "Intersection.h"
+
+long StartCritical(void);     // previous I bit, disable interrupts
+void EndCritical(long sr);    // restore I bit to previous value
+
+typedef enum t_StreetSemaphoroState{
+	STREET_SEMAPHORO_OFF,
+	STREET_SEMAPHORO_RED,	
+	STREET_SEMAPHORO_GREEN,
+	STREET_SEMAPHORO_YELLOW
+}StreetSemaphoroState;
+
+typedef enum t_WalkSemaphoroState{
+	WALK_SEMAPHORO_OFF,
+	WALK_SEMAPHORO_RED,
+	WALK_SEMAPHORO_GREEN
+}WalkSemaphoroState;
+	
+
+//Fist letter is walk semaphoro current output, second south semaphoro, third west semaphoro
+// N = Semaphoro off, R = Semaphoro Red, G = Semaphoro Green, Y = Semaphoro Yellow, B = second blink
+// The machine is described once, in INTERSECTION_STATES, by each state's lights and a
+// next-state rule; the enum, the table and the build-time checks below are expanded from it.
+// To change the machine edit the rules, the checks then fail to compile if a change breaks it.
+
+/*Rules: 1) Walkers have priority 2) South have priority over West 3) Semaphoro cant go from green to yellow and then back to green*/
+
+// the sensor bits, xxx_REQUEST in Intersection.h, are the table index
+
+// rules 1) and 2): green for the first request in order walk, south, west, ignoring
+// the requests in skip; all red when none is left
+#define SERVE(in,skip) ((((in)&~(skip))&WALK_REQUEST)? N_GRR : \
+                        (((in)&~(skip))&SOUTH_REQUEST)? N_RGR : \
+                        (((in)&~(skip))&WEST_REQUEST)? N_RRG : N_RRR)
+// a green stays green until someone else is waiting
+#define HOLD(in,mine,green,next) (((in)&~(mine))? (next) : (green))
+
+// next state from each state for sensor input in
+#define NEXT_N_RRR(in) SERVE(in,0)
+#define NEXT_N_RRG(in) HOLD(in,WEST_REQUEST,N_RRG,N_RRY)
+#define NEXT_N_RRY(in) SERVE(in,WEST_REQUEST)          // rule 3), west waits its turn
+#define NEXT_N_RGR(in) HOLD(in,SOUTH_REQUEST,N_RGR,N_RYR)
+#define NEXT_N_RYR(in) SERVE(in,SOUTH_REQUEST)         // rule 3), south waits its turn
+#define NEXT_N_GRR(in) HOLD(in,WALK_REQUEST,N_GRR,B_NRR)
+#define NEXT_B_NRR(in) B_RRR                           // hurry up: "don't walk" blinks
+#define NEXT_B_RRR(in) N_NRR
+#define NEXT_N_NRR(in) SERVE(in,WALK_REQUEST)          // cars go before walkers again
+
+// X(a, state, west, south, walk, normal, rush, night) for every state, a is passed through
+// to X; the last three are the dwell in each timing profile, in ticks (ms): normal is the
+// lab's 500 ms everywhere, rush hour gives south, the main road, the long greens and night
+// lets each green run a little longer, as a request rarely waits behind another
+#define INTERSECTION_STATES(X,a) \
+	X(a, N_NRR, STREET_SEMAPHORO_RED   , STREET_SEMAPHORO_RED   , WALK_SEMAPHORO_OFF  ,  500,  500,  500) \
+	X(a, N_RRR, STREET_SEMAPHORO_RED   , STREET_SEMAPHORO_RED   , WALK_SEMAPHORO_RED  ,  500,  500,  500) \
+	X(a, N_RRG, STREET_SEMAPHORO_GREEN , STREET_SEMAPHORO_RED   , WALK_SEMAPHORO_RED  ,  500, 1000, 1000) \
+	X(a, N_RRY, STREET_SEMAPHORO_YELLOW, STREET_SEMAPHORO_RED   , WALK_SEMAPHORO_RED  ,  500,  500,  500) \
+	X(a, N_RGR, STREET_SEMAPHORO_RED   , STREET_SEMAPHORO_GREEN , WALK_SEMAPHORO_RED  ,  500, 3000, 1000) \
+	X(a, N_RYR, STREET_SEMAPHORO_RED   , STREET_SEMAPHORO_YELLOW, WALK_SEMAPHORO_RED  ,  500,  500,  500) \
+	X(a, N_GRR, STREET_SEMAPHORO_RED   , STREET_SEMAPHORO_RED   , WALK_SEMAPHORO_GREEN,  500, 1000, 1000) \
+	X(a, B_NRR, STREET_SEMAPHORO_RED   , STREET_SEMAPHORO_RED   , WALK_SEMAPHORO_OFF  ,  500,  500,  500) \
+	X(a, B_RRR, STREET_SEMAPHORO_RED   , STREET_SEMAPHORO_RED   , WALK_SEMAPHORO_RED  ,  500,  500,  500)
+
+#define YELLOW_MINTICKS 500              // no profile may shorten a yellow below this
+
+#define INITIAL_STATE N_RRR
+
+#define STATE_NAME(a,state,west,south,walk,normal,rush,night) state,
+typedef enum t_IntersectionState{
+	INTERSECTION_STATES(STATE_NAME,0)
+	MAX_INTERSECTION_STATES //<= must to be always the last enum value
+}IntersectionState;
+
+// 11 bytes per state, all of it precomputed: entering a state is two loads, two shifts
+// and two stores
+typedef struct t_IntersectionStateInfo{
+	unsigned char Lights;             // west lights on bits 5-3, south on bits 2-0
+	unsigned char Walk;               // walk on bit 3, don't walk on bit 1
+	unsigned char Serves;             // requests the state's green answers, xxx_REQUEST bits
+	unsigned char NextState[8];       // IntersectionState for each sensor input
+}IntersectionStateInfo;
+
+// output bits of a light
+#define STREET_LEDS(light) (((light) == STREET_SEMAPHORO_RED)? 0x04 : \
+                            ((light) == STREET_SEMAPHORO_YELLOW)? 0x02 : \
+                            ((light) == STREET_SEMAPHORO_GREEN)? 0x01 : 0x00)
+#define WALK_LEDS(light) (((light) == WALK_SEMAPHORO_GREEN)? 0x08 : \
+                          ((light) == WALK_SEMAPHORO_RED)? 0x02 : 0x00)
+
+#define SERVES(west,south,walk) ((((west) == STREET_SEMAPHORO_GREEN)? WEST_REQUEST : 0)| \
+                                 (((south) == STREET_SEMAPHORO_GREEN)? SOUTH_REQUEST : 0)| \
+                                 (((walk) == WALK_SEMAPHORO_GREEN)? WALK_REQUEST : 0))
+
+#define NEXT_STATES(rule) {rule(0), rule(1), rule(2), rule(3), rule(4), rule(5), rule(6), rule(7)}
+#define STATE_ROW(a,state,west,south,walk,normal,rush,night) \
+	{(STREET_LEDS(west)<<3)|STREET_LEDS(south), WALK_LEDS(walk), SERVES(west,south,walk), NEXT_STATES(NEXT_##state)},
+const IntersectionStateInfo IntersectionMachine[MAX_INTERSECTION_STATES]={
+	INTERSECTION_STATES(STATE_ROW,0)
+};
+
+// dwell of each state in each profile, in ticks
+#define NORMAL_DWELL(a,state,west,south,walk,normal,rush,night) normal,
+#define RUSH_DWELL(a,state,west,south,walk,normal,rush,night)   rush,
+#define NIGHT_DWELL(a,state,west,south,walk,normal,rush,night)  night,
+const unsigned short DwellTicks[TIMING_PROFILES][MAX_INTERSECTION_STATES]={
+	{INTERSECTION_STATES(NORMAL_DWELL,0)},
+	{INTERSECTION_STATES(RUSH_DWELL,0)},
+	{INTERSECTION_STATES(NIGHT_DWELL,0)}
+};
+
+// ***** Build-time checks of the machine *****
+// Each check is an array type whose size is negative when the check fails, so
+// the compiler stops with the check and the state in the error message.
+// Sets of states are bit masks, bit n for state n.
+
+// states one rule can lead to
+#define SUCCESSORS(rule) ((1<<rule(0))|(1<<rule(1))|(1<<rule(2))|(1<<rule(3))| \
+                          (1<<rule(4))|(1<<rule(5))|(1<<rule(6))|(1<<rule(7)))
+#define STATE_SUCCESSORS(a,state,west,south,walk,normal,rush,night) SUCCESSORS_##state = SUCCESSORS(NEXT_##state),
+enum{ INTERSECTION_STATES(STATE_SUCCESSORS,0) SUCCESSORS_END };
+
+// states showing a light
+#define WEST_IS(light,state,west,south,walk,normal,rush,night)  |(((west) == (light))? 1<<state : 0)
+#define SOUTH_IS(light,state,west,south,walk,normal,rush,night) |(((south) == (light))? 1<<state : 0)
+#define WALK_IS(light,state,west,south,walk,normal,rush,night)  |(((walk) == (light))? 1<<state : 0)
+enum{
+	WEST_RED      = 0 INTERSECTION_STATES(WEST_IS,STREET_SEMAPHORO_RED),
+	WEST_GREEN    = 0 INTERSECTION_STATES(WEST_IS,STREET_SEMAPHORO_GREEN),
+	WEST_YELLOW   = 0 INTERSECTION_STATES(WEST_IS,STREET_SEMAPHORO_YELLOW),
+	SOUTH_RED     = 0 INTERSECTION_STATES(SOUTH_IS,STREET_SEMAPHORO_RED),
+	SOUTH_GREEN   = 0 INTERSECTION_STATES(SOUTH_IS,STREET_SEMAPHORO_GREEN),
+	SOUTH_YELLOW  = 0 INTERSECTION_STATES(SOUTH_IS,STREET_SEMAPHORO_YELLOW),
+	WALK_GREEN    = 0 INTERSECTION_STATES(WALK_IS,WALK_SEMAPHORO_GREEN),
+	WALK_BLINKING = 0 INTERSECTION_STATES(WALK_IS,WALK_SEMAPHORO_OFF)
+};
+
+// states reachable from INITIAL_STATE, one more step each time; MAX_INTERSECTION_STATES-1
+// steps reach every state that can be reached
+#define REACH_FROM(reached,state,west,south,walk,normal,rush,night) |((((reached)>>state)&1)? SUCCESSORS_##state : 0)
+#define REACH_STEP(reached) ((reached) INTERSECTION_STATES(REACH_FROM,reached))
+enum{
+	REACHED_0 = 1<<INITIAL_STATE,
+	REACHED_1 = REACH_STEP(REACHED_0),
+	REACHED_2 = REACH_STEP(REACHED_1),
+	REACHED_3 = REACH_STEP(REACHED_2),
+	REACHED_4 = REACH_STEP(REACHED_3),
+	REACHED_5 = REACH_STEP(REACHED_4),
+	REACHED_6 = REACH_STEP(REACHED_5),
+	REACHED_7 = REACH_STEP(REACHED_6),
+	REACHED_8 = REACH_STEP(REACHED_7),
+	REACHED = REACHED_8
+};
+typedef char add_REACH_STEPs_for_more_states[(MAX_INTERSECTION_STATES <= 9)? 1 : -1];
+typedef char state_does_not_fit_a_byte[(MAX_INTERSECTION_STATES <= 256)? 1 : -1];
+
+// per state: reachable; at most one street moving and walkers only when both stopped;
+// green only to green or yellow; yellow only to red (no green->yellow->green);
+// walk green only to walk green or blinking; every dwell 1 to DWELL_MAXTICKS, yellows
+// at least YELLOW_MINTICKS
+#define DWELL_IN_RANGE(ticks,light) (((ticks) >= 1) && ((ticks) <= DWELL_MAXTICKS) && \
+	(((light) != STREET_SEMAPHORO_YELLOW) || ((ticks) >= YELLOW_MINTICKS)))
+#define STATE_CHECKS(a,state,west,south,walk,normal,rush,night) \
+	typedef char unreachable_##state[((REACHED>>state)&1)? 1 : -1]; \
+	typedef char crossing_traffic_##state[(((west) == STREET_SEMAPHORO_RED) || ((south) == STREET_SEMAPHORO_RED))? 1 : -1]; \
+	typedef char walk_into_traffic_##state[(((walk) == WALK_SEMAPHORO_RED) || \
+		(((west) == STREET_SEMAPHORO_RED) && ((south) == STREET_SEMAPHORO_RED)))? 1 : -1]; \
+	typedef char west_green_not_to_yellow_##state[(((west) != STREET_SEMAPHORO_GREEN) || \
+		!(SUCCESSORS_##state&~(WEST_GREEN|WEST_YELLOW)))? 1 : -1]; \
+	typedef char south_green_not_to_yellow_##state[(((south) != STREET_SEMAPHORO_GREEN) || \
+		!(SUCCESSORS_##state&~(SOUTH_GREEN|SOUTH_YELLOW)))? 1 : -1]; \
+	typedef char west_yellow_not_to_red_##state[(((west) != STREET_SEMAPHORO_YELLOW) || \
+		!(SUCCESSORS_##state&~WEST_RED))? 1 : -1]; \
+	typedef char south_yellow_not_to_red_##state[(((south) != STREET_SEMAPHORO_YELLOW) || \
+		!(SUCCESSORS_##state&~SOUTH_RED))? 1 : -1]; \
+	typedef char walk_not_to_blinking_##state[(((walk) != WALK_SEMAPHORO_GREEN) || \
+		!(SUCCESSORS_##state&~(WALK_GREEN|WALK_BLINKING)))? 1 : -1]; \
+	typedef char dwell_out_of_range_##state[(DWELL_IN_RANGE(normal,west) && DWELL_IN_RANGE(normal,south) && \
+		DWELL_IN_RANGE(rush,west) && DWELL_IN_RANGE(rush,south) && \
+		DWELL_IN_RANGE(night,west) && DWELL_IN_RANGE(night,south))? 1 : -1];
+INTERSECTION_STATES(STATE_CHECKS,0)
+
+//------------Intersection_Init------------
+// Bind an intersection to its pins and show its initial state
+// Input: intersection to set up
+//        pins of the intersection
+//        now is Dwell_Now(), the initial state dwells from there
+// Output: none
+void Intersection_Init(Intersection *intersection, const IntersectionPins *pins, unsigned long now){
+	const IntersectionStateInfo *state = &IntersectionMachine[INITIAL_STATE];
+	intersection->Lights = pins->LightsPort+((0x3F<<pins->LightsShift)<<2);
+	intersection->Walk = pins->WalkPort+((0x0A<<pins->WalkShift)<<2);
+	intersection->SensorPort = pins->SensorPort;
+	intersection->LightsShift = pins->LightsShift;
+	intersection->WalkShift = pins->WalkShift;
+	intersection->SensorShift = pins->SensorShift;
+	intersection->State = INITIAL_STATE;
+	intersection->Profile = PROFILE_NORMAL;
+	intersection->Levels = 0;
+	intersection->Requests = 0;
+	intersection->Provisional = 0;
+	HWREG(intersection->Lights) = state->Lights<<intersection->LightsShift;
+	HWREG(intersection->Walk) = state->Walk<<intersection->WalkShift;
+	intersection->Deadline = Dwell_After(now, DwellTicks[PROFILE_NORMAL][INITIAL_STATE]);
+}
+
+//------------Intersection_Service------------
+// The dispatcher: move every intersection whose deadline has passed to
+// its next state, chosen by its sensors and latched requests, and start
+// timing that state from the old deadline so no error accumulates
+// Input: intersections and their count, at least 1
+// Output: earliest deadline of all of them, for Dwell_Until
+unsigned long Intersection_Service(Intersection intersections[], unsigned long count){
+	Intersection *intersection;
+	const IntersectionStateInfo *state;
+	unsigned long now = Dwell_Now();
+	unsigned long left, soonest = 0xFFFFFFFF;
+	unsigned long sensors;
+	long sr;
+	for(intersection = intersections; intersection < &intersections[count]; intersection++){
+		left = (intersection->Deadline-now)&0xFFFFFFFF;
+		if((left == 0) || (left >= 0x80000000)){   // passed, negative as a 32-bit signed number
+			sensors = intersection->Levels|intersection->Requests;
+			state = &IntersectionMachine[IntersectionMachine[intersection->State].NextState[sensors]];
+			sr = StartCritical();                      // Requests and State are shared with Intersection_Sense
+			intersection->State = state-IntersectionMachine;
+			intersection->Requests &= ~state->Serves;  // the others stay latched
+			intersection->Provisional &= ~state->Serves;
+			EndCritical(sr);                           // callers may already have interrupts off
+			HWREG(intersection->Lights) = state->Lights<<intersection->LightsShift;
+			HWREG(intersection->Walk) = state->Walk<<intersection->WalkShift;
+			intersection->Deadline = Dwell_After(intersection->Deadline,
+				DwellTicks[intersection->Profile][intersection->State]);
+			left = (intersection->Deadline-now)&0xFFFFFFFF;
+			if(left >= 0x80000000){
+				left = 0;                                // still behind, Dwell_Until ends at once
+			}
+		}
+		if(left < soonest){
+			soonest = left;
+		}
+	}
+	return (now+soonest)&0xFFFFFFFF;
+}
+
+//------------Intersection_Sense------------
+// Hand in the sensor levels of port and latch its rising edges until a
+// green answers them, called whenever the debounced levels may change;
+// an edge during the green that answers it is not latched
+// Input: intersections and their count
+//        port is the GPIO_PORTx of the sensors
+//        levels of its pins, bit n for pin n
+//        rising has a bit set for each pin that went from 0 to 1
+// Output: none
+void Intersection_Sense(Intersection intersections[], unsigned long count,
+                        unsigned long port, unsigned long levels, unsigned long rising){
+	Intersection *intersection;
+	unsigned long serving;              // requests the green showing answers
+	for(intersection = intersections; intersection < &intersections[count]; intersection++){
+		if(intersection->SensorPort == port){
+			intersection->Levels = (levels>>intersection->SensorShift)&0x07;
+			serving = IntersectionMachine[intersection->State].Serves;
+			intersection->Requests |= ((rising>>intersection->SensorShift)&0x07)&~serving;
+		}
+	}
+}
+
+//------------Intersection_Latch------------
+// Latch the requests of raw rising edges of port provisionally, before
+// the debouncer has seen them; a pin already requested, or whose green
+// is showing, is left as it is
+// Input: intersections and their count
+//        port is the GPIO_PORTx of the sensors
+//        rising has a bit set for each pin that went from 0 to 1
+// Output: none
+void Intersection_Latch(Intersection intersections[], unsigned long count,
+                        unsigned long port, unsigned long rising){
+	Intersection *intersection;
+	unsigned long latched, serving;
+	for(intersection = intersections; intersection < &intersections[count]; intersection++){
+		if(intersection->SensorPort == port){
+			serving = IntersectionMachine[intersection->State].Serves;
+			latched = ((rising>>intersection->SensorShift)&0x07)&~(intersection->Requests|serving);
+			intersection->Provisional |= latched;
+			intersection->Requests |= latched;
+		}
+	}
+}
+
+//------------Intersection_Confirm------------
+// Decide the provisional requests of pins of port: keep the ones whose
+// pin is still high, drop the others as glitches
+// Input: intersections and their count
+//        port is the GPIO_PORTx of the sensors
+//        levels of its pins now, raw, bit n for pin n
+//        pins to decide, bit n for pin n
+// Output: none
+void Intersection_Confirm(Intersection intersections[], unsigned long count,
+                          unsigned long port, unsigned long levels, unsigned long pins){
+	Intersection *intersection;
+	unsigned long decided;
+	for(intersection = intersections; intersection < &intersections[count]; intersection++){
+		if(intersection->SensorPort == port){
+			decided = intersection->Provisional&(pins>>intersection->SensorShift);
+			intersection->Requests &= ~(decided&~(levels>>intersection->SensorShift));
+			intersection->Provisional &= ~decided;
+		}
+	}
+}
+
+//------------Intersection_SetProfile------------
+// Change the timing profile, it applies from the next state on
+// Input: intersections and their count
+//        profile for all of them
+// Output: none
+void Intersection_SetProfile(Intersection intersections[], unsigned long count, TimingProfile profile){
+	unsigned long i;
+	for(i = 0; i < count; i++){
+		intersections[i].Profile = profile;
+	}
+}
@@ -0,0 +1,125 @@
+// Intersection.h
+// Runs on LM4F120/TM4C123
+// Traffic light engine for any number of intersections on one board.
+// Every intersection runs the state machine of Intersection.c, which is
+// const and shared; an Intersection record holds what is its own: the
+// state, the timing profile, the deadline of the state, its debounced
+// sensor levels, the requests latched since their last green and where
+// its pins are.
+// One dispatcher, Intersection_Service, steps every intersection whose
+// deadline has come and returns the next deadline of all of them, the
+// caller sleeps on Dwell_Until/Dwell_Wait until then.  Each state of an
+// intersection costs two single-store pin writes; the sensors are not
+// read there but handed in, debounced, through Intersection_Sense.
+// A raw rising edge can be latched at once with Intersection_Latch, as a
+// provisional request that Intersection_Confirm drops again if the pin
+// was back at 0 when checked, so a detection need not last through the
+// whole debounce to be served.
+// Requirement on the sensors: a detection high for longer than
+// INTERSECTION_MINPULSE_MS, without bouncing low, always gets its green.
+// One shorter may be taken for a glitch; TableTrafficLight.c checks it
+// within 2*DEBOUNCE_MS of the edge and SensorBench.c tests the bound.
+
+#ifndef __INTERSECTION_H__
+#define __INTERSECTION_H__
+
+// timing profiles, each state of the machine has a dwell for each
+typedef enum t_TimingProfile{
+	PROFILE_NORMAL,
+	PROFILE_RUSH,
+	PROFILE_NIGHT
+}TimingProfile;
+#define TIMING_PROFILES (1+PROFILE_NIGHT) //<= must to be always the last enum value
+
+// a detection at least this long is always served, see above
+#define INTERSECTION_MINPULSE_MS 8
+
+// sensor bits, [walk,south,west]
+#define WALK_REQUEST  0x04
+#define SOUTH_REQUEST 0x02
+#define WEST_REQUEST  0x01
+
+// where an intersection's lights and sensors are; a port is GPIO_PORTx
+// from Gpio.h and the pins must already be set up as GPIO
+typedef struct t_IntersectionPins{
+	unsigned long LightsPort;         // west red, yellow, green, south red, yellow, green
+	unsigned char LightsShift;        // on pins LightsShift+5 down to LightsShift
+	unsigned long WalkPort;           // walk on pin WalkShift+3, don't walk on WalkShift+1
+	unsigned char WalkShift;
+	unsigned long SensorPort;         // west, south, walk on pins SensorShift to SensorShift+2
+	unsigned char SensorShift;
+}IntersectionPins;
+
+typedef struct t_Intersection{
+	unsigned long Lights;             // masked DATA address of the six lights
+	unsigned long Walk;               // masked DATA address of the walk lights
+	unsigned long SensorPort;         // GPIO_PORTx of the sensors, for Intersection_Sense
+	unsigned long Deadline;           // end of the current state, from Dwell_After
+	unsigned char LightsShift;
+	unsigned char WalkShift;
+	unsigned char SensorShift;
+	unsigned char State;              // IntersectionState of Intersection.c
+	unsigned char Profile;            // TimingProfile
+	volatile unsigned char Levels;    // debounced sensors, xxx_REQUEST bits
+	volatile unsigned char Requests;  // sensor edges not served yet, xxx_REQUEST bits
+	volatile unsigned char Provisional; // Requests from raw edges, not confirmed yet
+}Intersection;
+
+//------------Intersection_Init------------
+// Bind an intersection to its pins and show its initial state
+// Input: intersection to set up
+//        pins of the intersection
+//        now is Dwell_Now(), the initial state dwells from there
+// Output: none
+void Intersection_Init(Intersection *intersection, const IntersectionPins *pins, unsigned long now);
+
+//------------Intersection_Service------------
+// The dispatcher: move every intersection whose deadline has passed to
+// its next state, chosen by its sensors and latched requests, and start
+// timing that state from the old deadline so no error accumulates
+// Input: intersections and their count, at least 1
+// Output: earliest deadline of all of them, for Dwell_Until
+unsigned long Intersection_Service(Intersection intersections[], unsigned long count);
+
+//------------Intersection_Sense------------
+// Hand in the sensor levels of port and latch its rising edges until a
+// green answers them, called whenever the debounced levels may change;
+// an edge during the green that answers it is not latched
+// Input: intersections and their count
+//        port is the GPIO_PORTx of the sensors
+//        levels of its pins, bit n for pin n
+//        rising has a bit set for each pin that went from 0 to 1
+// Output: none
+void Intersection_Sense(Intersection intersections[], unsigned long count,
+                        unsigned long port, unsigned long levels, unsigned long rising);
+
+//------------Intersection_Latch------------
+// Latch the requests of raw rising edges of port provisionally, before
+// the debouncer has seen them; a pin already requested, or whose green
+// is showing, is left as it is
+// Input: intersections and their count
+//        port is the GPIO_PORTx of the sensors
+//        rising has a bit set for each pin that went from 0 to 1
+// Output: none
+void Intersection_Latch(Intersection intersections[], unsigned long count,
+                        unsigned long port, unsigned long rising);
+
+//------------Intersection_Confirm------------
+// Decide the provisional requests of pins of port: keep the ones whose
+// pin is still high, drop the others as glitches
+// Input: intersections and their count
+//        port is the GPIO_PORTx of the sensors
+//        levels of its pins now, raw, bit n for pin n
+//        pins to decide, bit n for pin n
+// Output: none
+void Intersection_Confirm(Intersection intersections[], unsigned long count,
+                          unsigned long port, unsigned long levels, unsigned long pins);
+
+//------------Intersection_SetProfile------------
+// Change the timing profile, it applies from the next state on
+// Input: intersections and their count
+//        profile for all of them
+// Output: none
+void Intersection_SetProfile(Intersection intersections[], unsigned long count, TimingProfile profile);
+
+#endif // __INTERSECTION_H__
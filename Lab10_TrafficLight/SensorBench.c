@@ -0,0 +1,184 @@
+// SensorBench.c
+// Runs on Linux (x86-64 or any LP64 host), not part of the Keil project
+// Host benchmark of the traffic light's reaction to its sensors, run on
+// the register emulation.  It drives PE2-0 with short detections (a
+// pedestrian pressing the button, a car rolling over a loop) at
+// pseudo-random times and measures, for each one, the time until the
+// green that answers it: walk on PF3, south green on PB0, west green on
+// PB3.  A detection that gets no green within MISSEDMS counts as missed.
+// A second run drives pulses of 2 to 24 ms, each on its own more than
+// MISSEDMS after the last, and counts the ones that got their green: the
+// interrupt build drops a pulse that is back at 0 when its provisional
+// request is checked, DEBOUNCE_MS after the edge, the polling build one
+// that is not high at the end of a dwell.  A pulse whose green was
+// already showing tells nothing and is counted apart.  The interrupt
+// build exits with 1 if it missed a pulse longer than
+// INTERSECTION_MINPULSE_MS, the requirement of Intersection.h.
+// The same seed gives the same detections in both builds, from this folder
+//   gcc -O2 -DHOST_EMULATION -I.. -I. -o sensorbench SensorBench.c TableTrafficLight.c Intersection.c Dwell.c ../Lab11_UART/UART.c ../Clock.c ../Gpio.c ../Debounce.c ../Emulator/*.c
+//   gcc -O2 -DHOST_EMULATION -DSENSOR_POLLING -I.. -I. -o pollingbench SensorBench.c TableTrafficLight.c Intersection.c Dwell.c ../Lab11_UART/UART.c ../Clock.c ../Gpio.c ../Debounce.c ../Emulator/*.c
+// and run ./sensorbench and ./pollingbench.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "..//Emulator/Emulator.h"
+#include "Intersection.h"
+
+#define CYCLESPERMS 80000ULL    // 80 MHz bus clock after TExaS_Init
+#define DETECTIONS 300          // per run
+#define MISSEDMS 10000          // no green within this: missed
+#define SENSORS 3               // PE0 west, PE1 south, PE2 walk
+#define PULSEWIDTHS 12          // short pulses of 2, 4, ... 24 ms
+#define PULSEEACH 6             // of each width, over the sensors in turn
+#define PULSES (PULSEWIDTHS*PULSEEACH)
+#define TOTAL (DETECTIONS+PULSES)
+
+static const char * const Name[SENSORS]={"west", "south", "walk"};
+
+static unsigned long long Start[TOTAL]; // cycle the detection began
+static int Sensor[TOTAL];
+static unsigned long long Latency[TOTAL]; // cycles to the green, 0 until served
+static int Served[TOTAL];
+static int Already[TOTAL];              // its green was showing when it began
+static int Next;                        // next detection to start
+static unsigned long long ReleaseAt;    // end of the detection in progress, 0 for none
+static unsigned long long NextAt;       // start of the next detection
+static unsigned long Seed = 12345;
+static int Green[SENSORS];              // green showing now
+
+static unsigned long pick(unsigned long n){
+  Seed = Seed*1664525+1013904223;
+  return ((Seed&0xFFFFFFFF)>>8)%n;
+}
+
+// a green started for sensor s: it answers every detection still waiting
+static void green(int s, unsigned long long now){ int i;
+  for(i = 0; i < Next; i++){
+    if((Sensor[i] == s) && !Served[i] && ((now-Start[i]) < MISSEDMS*CYCLESPERMS)){
+      Served[i] = 1;
+      Latency[i] = now-Start[i];
+    }
+  }
+}
+
+static void changed(int port, unsigned long before, unsigned long after){
+int s, was[SENSORS], on[SENSORS];
+  (void)before;
+  if((port != 1) && (port != 5)){
+    return;
+  }
+  for(s = 0; s < SENSORS; s++){
+    was[s] = on[s] = Green[s];
+  }
+  if(port == 1){                        // PB3 west green, PB0 south green
+    on[0] = (after&0x08) != 0;
+    on[1] = (after&0x01) != 0;
+  } else{                               // PF3 walk
+    on[2] = (after&0x08) != 0;
+  }
+  for(s = 0; s < SENSORS; s++){
+    Green[s] = on[s];
+    if(on[s] && !was[s]){
+      green(s, Emu_Cycles);
+    }
+  }
+}
+
+static void report(void){ int s, i, n, served;
+unsigned long long total, longest;
+  printf("%-6s %10s %7s %7s %12s %12s\n", "sensor", "detections", "served", "missed", "mean ms", "max ms");
+  for(s = 0; s < SENSORS; s++){
+    n = served = 0;
+    total = longest = 0;
+    for(i = 0; i < DETECTIONS; i++){
+      if(Sensor[i] == s){
+        n++;
+        if(Served[i]){
+          served++;
+          total += Latency[i];
+          if(Latency[i] > longest){
+            longest = Latency[i];
+          }
+        }
+      }
+    }
+    printf("%-6s %10d %7d %7d %12.1f %12.1f\n", Name[s], n, served, n-served,
+      served? (double)total/served/CYCLESPERMS : 0.0, (double)longest/CYCLESPERMS);
+  }
+}
+
+// 1 if a pulse longer than INTERSECTION_MINPULSE_MS got no green
+static int reportPulses(void){ int w, i, n, served, already, failed = 0;
+  printf("%-8s %6s %7s %7s %14s\n", "pulse ms", "pulses", "served", "missed", "already green");
+  for(w = 0; w < PULSEWIDTHS; w++){
+    n = served = already = 0;
+    for(i = DETECTIONS+w*PULSEEACH; i < DETECTIONS+(w+1)*PULSEEACH; i++){
+      if(Already[i]){
+        already++;
+      } else{
+        n++;
+        served += Served[i];
+      }
+    }
+    printf("%8d %6d %7d %7d %14d\n", 2*(w+1), n, served, n-served, already);
+#ifndef SENSOR_POLLING
+    if((2*(w+1) > INTERSECTION_MINPULSE_MS) && (served < n)){
+      failed = 1;
+    }
+#endif
+  }
+  if(failed){
+    printf("a pulse longer than %d ms was missed\n", INTERSECTION_MINPULSE_MS);
+  }
+  return failed;
+}
+
+// drive the next detection when its time comes
+static void benchAdvance(unsigned long long now){
+  if(ReleaseAt && (now >= ReleaseAt)){
+    Emu_GPIOInput(4, 0x07, 0x00);
+    ReleaseAt = 0;
+  }
+  if(now < NextAt){
+    return;
+  }
+  if(Next == TOTAL){
+    report();
+    exit(reportPulses());
+  }
+  if(Next < DETECTIONS){
+    Sensor[Next] = (int)pick(SENSORS);
+    ReleaseAt = now+(20+pick(80))*CYCLESPERMS; // 20 to 100 ms
+    NextAt = now+(1000+pick(2000))*CYCLESPERMS; // 1 to 3 s apart
+  } else{                               // one short pulse at a time
+    Sensor[Next] = (Next-DETECTIONS)%SENSORS;
+    ReleaseAt = now+2*(1+(Next-DETECTIONS)/PULSEEACH)*CYCLESPERMS;
+    NextAt = now+(MISSEDMS+1000)*CYCLESPERMS;
+  }
+  Start[Next] = now;
+  if(Green[Sensor[Next]]){              // its green is already showing
+    Served[Next] = Already[Next] = 1;
+  }
+  Emu_GPIOInput(4, 0x07, 1UL<<Sensor[Next]);
+  Next++;
+  if(Next == DETECTIONS){
+    NextAt = now+MISSEDMS*CYCLESPERMS;  // give the last one its time
+  }
+}
+
+static unsigned long long benchIdle(int block){
+unsigned long long at = ReleaseAt? ReleaseAt : NextAt;
+  (void)block;
+  return (at > Emu_Cycles)? at-Emu_Cycles : 1;
+}
+
+static const EmuModel BenchModel = {
+  "SensorBench", 0, 0, 0, 0, benchAdvance, benchIdle
+};
+
+__attribute__((constructor(300))) static void benchStart(void){
+  Emu_GPIOChanged = changed;
+  Emu_UARTEndExits = 0;                 // the light polls UART0 for profile commands
+  NextAt = 1000*CYCLESPERMS;
+  Emu_AddModel(&BenchModel);
+}
@@ -16,63 +16,53 @@
 // east/west car detector connected to PE0 (1=car present)
 // "walk" light connected to PF3 (built-in green LED)
 // "don't walk" light connected to PF1 (built-in red LED)
+// The machine itself is in Intersection.c, which can run any number of
+// intersections; this file binds the lab's one to its pins and runs the
+// dispatcher.  For more intersections add their pins to Pins and Board
+// and their sensor ports to SensorPorts and SysTick_Handler.
+// The sensors are debounced (Debounce.c): an edge on PE2-0 starts SysTick
+// sampling them every DEBOUNCE_MS, and it stops again once they have
+// settled, so the light stays tickless while nothing moves.  A rising
+// edge latches its request at once, provisionally, so a detection in the
+// middle of a dwell is kept until a state serves it.  The request is
+// checked at the first sample at least DEBOUNCE_MS after the edge, so at
+// most 2*DEBOUNCE_MS after it, and dropped as a glitch if the pin is back
+// at 0; otherwise it stands even if the pulse ends before the debouncer
+// takes it.  This meets INTERSECTION_MINPULSE_MS of Intersection.h, and
+// SensorBench.c fails if a pulse that long is missed.
+// Build with SENSOR_POLLING defined for the old behavior, the sensors read
+// raw only at the end of each dwell.
+// Each state dwells a number of 1 ms ticks set per timing profile; every
+// deadline is the previous one plus the dwell, so the cycle does not drift.
+// The profile is switched at run time on UART0 (115200 baud): 'd' day
+// (normal), 'r' rush hour, 'n' night.  It takes effect at the next state.
+// Build with INTERSECTION_BENCH defined to measure, instead of running the
+// light, how many intersections one dispatcher serves in a 1 ms control
+// period; the results go out on UART0.  On the host emulator the cycles
+// count register accesses only, the real figures come from the board.
+// startup.s can start the PLL early and set up memory itself with
+// FAST_BOOT (see Reset_Handler); the project leaves it off until
+// BOOT_BENCH figures from the board show what it saves.  Build with
+// BOOT_BENCH defined, in C and as --pd "BOOT_BENCH SETL {TRUE}" for
+// startup.s, to print the core cycles from reset to main and to the
+// first lights, then again adding "FAST_BOOT SETL {TRUE}" to the --pd and
+// --datacompressor=off to the linker.  These come from the board only,
+// the host emulator does not run startup.s.
 
 // ***** 1. Pre-processor Directives Section *****
 #include "TExaS.h"
 #include "tm4c123gh6pm.h"
+#include "Dwell.h"
+#include "Gpio.h"
+#include "Intersection.h"
+#include "..//Debounce.h"
+#include "..//Lab11_UART/UART.h"
+#include "..//Clock.h"
 
-typedef enum t_StreetSemaphoroState{
-	STREET_SEMAPHORO_OFF,
-	STREET_SEMAPHORO_RED,	
-	STREET_SEMAPHORO_GREEN,
-	STREET_SEMAPHORO_YELLOW
-}StreetSemaphoroState;
-
-typedef enum t_WalkSemaphoroState{
-	WALK_SEMAPHORO_OFF,
-	WALK_SEMAPHORO_RED,
-	WALK_SEMAPHORO_GREEN
-}WalkSemaphoroState;
-	
-
-//Fist letter is walk semaphoro current output, second south semaphoro, third west semaphoro
-// N = Semaphoro off, R = Semaphoro Red, G = Semaphoro Green, Y = Semaphoro Yellow 
-typedef enum t_IntersectionState{
-	N_NRR,
-	N_RRR,
-	N_RRG,
-	N_RRY,
-	N_RGR,
-	N_RYR,
-	N_GRR,
-	B_NRR,
-	B_RRR
-}IntersectionState;
-#define MAX_INTERSECTION_STATES (1+B_RRR) //<= must to be always the last enum value
-
-typedef struct t_IntersectionStateInfo{
-	StreetSemaphoroState WestStreetSemaphoro:3;
-	StreetSemaphoroState SouthStreetSemaphoro:3;
-	WalkSemaphoroState walkSemaphoro:3;
-	unsigned long TrasintionDelaySecs;
-	IntersectionState NextState[8];
-}IntersectionStateInfo;
-
-#define TRANSACTION_DELAY_SECS 50
-
-/*Rules: 1) Walkers have priority 2) South have priority over West 3) Semaphoro cant go from green to yellow and then back to green*/
-const IntersectionStateInfo IntersectionMachine[MAX_INTERSECTION_STATES]={
-// West     								South										 Walk		 	      															[  000    001    010    011    100    101    110    111] <= Possible inputs:[walk,south,west]	
-	{STREET_SEMAPHORO_RED		 ,STREET_SEMAPHORO_RED		,WALK_SEMAPHORO_OFF		,TRANSACTION_DELAY_SECS,{N_RRR, N_RRG, N_RGR, N_RRG, N_GRR, N_GRR, N_GRR, B_RRR}}, //State N_NRR
-	{STREET_SEMAPHORO_RED		 ,STREET_SEMAPHORO_RED		,WALK_SEMAPHORO_RED		,TRANSACTION_DELAY_SECS,{N_RRR, N_RRG, N_RGR, N_RRG, N_GRR, N_GRR, N_GRR, N_NRR}}, //State N_RRR P1
-	{STREET_SEMAPHORO_GREEN  ,STREET_SEMAPHORO_RED		,WALK_SEMAPHORO_RED		,TRANSACTION_DELAY_SECS,{N_RRG, N_RRG, N_RRY, N_RRY, N_RRY, N_RRY, N_RRY, N_RRY}}, //State N_RRG P2
-	{STREET_SEMAPHORO_YELLOW ,STREET_SEMAPHORO_RED		,WALK_SEMAPHORO_RED		,TRANSACTION_DELAY_SECS,{N_RRY, N_RRR, N_RGR, N_RGR, N_GRR, N_GRR, N_GRR, N_RGR}}, //State N_RRY
-	{STREET_SEMAPHORO_RED    ,STREET_SEMAPHORO_GREEN	,WALK_SEMAPHORO_RED		,TRANSACTION_DELAY_SECS,{N_RGR, N_RYR, N_RGR, N_RYR, N_RYR, N_RYR, N_RYR, N_RYR}}, //State N_RGR
-	{STREET_SEMAPHORO_RED    ,STREET_SEMAPHORO_YELLOW	,WALK_SEMAPHORO_RED		,TRANSACTION_DELAY_SECS,{N_RYR, N_RRG, N_RRR, N_RRG, N_GRR, N_GRR, N_GRR, N_GRR}}, //State N_RYR	
-	{STREET_SEMAPHORO_RED    ,STREET_SEMAPHORO_RED		,WALK_SEMAPHORO_GREEN	,TRANSACTION_DELAY_SECS,{N_GRR, N_RRR, N_RRR, N_RRR, N_GRR, N_RRR, N_RRR, N_RRR}}, //State N_GRR
-	{STREET_SEMAPHORO_RED    ,STREET_SEMAPHORO_RED		,WALK_SEMAPHORO_OFF		,TRANSACTION_DELAY_SECS,{B_NRR, N_RRG, N_RGR, N_RRG, N_GRR, N_GRR, N_GRR, N_RRG}}, //State B_NRR
-	{STREET_SEMAPHORO_RED		 ,STREET_SEMAPHORO_RED		,WALK_SEMAPHORO_RED		,TRANSACTION_DELAY_SECS,{B_RRR, N_RRG, N_RGR, N_RRG, N_GRR, N_GRR, N_GRR, B_NRR}}  //State B_RRR
-};
+#define INTERSECTIONS 1
+#define BENCH_INTERSECTIONS 256         // 24 bytes each
+#define BENCH_PERIOD 80000              // bus cycles in the 1 ms control period at 80 MHz
+#define DWT_CYCCNT_R HWREG(0xE0001004)  // started at reset by startup.s with BOOT_BENCH
 
 // ***** 2. Global Declarations Section *****
 
@@ -80,159 +70,207 @@ const IntersectionStateInfo IntersectionMachine[MAX_INTERSECTION_STATES]={
 void DisableInterrupts(void); // Disable interrupts
 void EnableInterrupts(void);  // Enable interrupts
 void Port_Init(void);
-void SysTick_Init(void);
-void SysTick_Wait10ms(unsigned long delay);
-void UpdateSemaphoros(IntersectionStateInfo stateInfo);
-unsigned long ReadSensors(void);
+void Sensors_Init(void);
+void SelectProfile(void);
+void Bench(void);
+void OutNumber(unsigned long n, unsigned long width);
+
+const IntersectionPins Pins[INTERSECTIONS]={
+	{GPIO_PORTB, 0, GPIO_PORTF, 0, GPIO_PORTE, 0}   // lights PB5-0, walk PF3 and PF1, sensors PE2-0
+};
+Intersection Intersections[INTERSECTIONS];
+const unsigned long SensorPorts[]={GPIO_PORTE};   // byte 0 of the debounced words
+static unsigned long Checking;      // PE2-0 latched on a raw edge, decided at the next sample
+static unsigned long Arriving;      // the same, decided at the sample after it
+typedef char provisional_window_longer_than_minimum_pulse[(2*DEBOUNCE_MS <= INTERSECTION_MINPULSE_MS)? 1 : -1];
+
+// the board's pins, one table for Gpio_ConfigureAll
+const GpioConfig Board[]={
+	{GPIO_PORTB, 0x3F, GPIO_OUT},     // lights
+	{GPIO_PORTE, 0x07, GPIO_IN},      // sensors, positive logic
+	{GPIO_PORTF, 0x0A, GPIO_OUT}      // walk lights
+};
 
 // ***** 3. Subroutines Section *****
 
 int main(void){ 
-	IntersectionState currentIntersectionState;
+	unsigned long i, now;
+#ifdef BOOT_BENCH
+	unsigned long toMain = DWT_CYCCNT_R, toOutput;
+#endif
 	TExaS_Init(SW_PIN_PE210, LED_PIN_PB543210); // activate grader and set system clock to 80 MHz
 	Port_Init();
-	SysTick_Init();
+	Dwell_Init();
+	UART_Init();
+	now = Dwell_Now();
+	for(i = 0; i < INTERSECTIONS; i++){
+		Intersection_Init(&Intersections[i], &Pins[i], now);
+	}
+	Sensors_Init();
+#ifdef BOOT_BENCH
+	toOutput = DWT_CYCCNT_R;            // the lights show the first state
+	UART_OutString((unsigned char *)"boot to main:   ");
+	OutNumber(toMain, 10);
+	UART_OutString((unsigned char *)"cycles\r\nboot to lights: ");
+	OutNumber(toOutput, 10);
+	UART_OutString((unsigned char *)"cycles\r\n");
+#endif
 	EnableInterrupts();
-	currentIntersectionState = N_RRR;
+#ifdef INTERSECTION_BENCH
+	Bench();
+#endif
 	while(1){
-		UpdateSemaphoros(IntersectionMachine[currentIntersectionState]);
-	  SysTick_Wait10ms(IntersectionMachine[currentIntersectionState].TrasintionDelaySecs);
-		currentIntersectionState = IntersectionMachine[currentIntersectionState].NextState[ReadSensors()];
+#ifdef SENSOR_POLLING
+		Intersection_Sense(Intersections, INTERSECTIONS, GPIO_PORTE, GPIO_PINS(GPIO_PORTE,0x07), 0);
+#endif
+		Dwell_Until(Intersection_Service(Intersections, INTERSECTIONS));
+		Dwell_Wait();                   // sleeps, sensor edges are latched meanwhile
+		SelectProfile();
   }
 }
 
-unsigned long ReadSensors(){
-	return GPIO_PORTE_DATA_R & 0x07;
+#if defined(INTERSECTION_BENCH) || defined(BOOT_BENCH)
+//------------OutNumber------------
+// Output a 32-bit number right justified and a space, all its digits
+// however wide (UART_OutUDec stops at 9999)
+// Input: n to output, width of the field
+// Output: none
+void OutNumber(unsigned long n, unsigned long width){
+	char field[12];
+	UART_FormatU32(field, n, width, 0);
+	UART_OutString((unsigned char *)field);
+	UART_OutChar(' ');
 }
+#endif
 
-void UpdateStreetSemaphoro(StreetSemaphoroState westSemaphoroState,StreetSemaphoroState southSemaphoroState){
-	unsigned long semaphoroMask = 0x00;
-		
-	switch(westSemaphoroState){
-			case STREET_SEMAPHORO_OFF:
-				break;
-			case STREET_SEMAPHORO_RED:
-				semaphoroMask = 0x04;
-				break;
-			case STREET_SEMAPHORO_YELLOW:
-				semaphoroMask = 0x02;
-				break;
-			case STREET_SEMAPHORO_GREEN:
-			default:
-				semaphoroMask = 0x01;//for security by defaulf semaphoro is red
+#ifdef INTERSECTION_BENCH
+Intersection BenchIntersections[BENCH_INTERSECTIONS];
+
+//------------Bench------------
+// Time Intersection_Service with 1, 2, 4 ... BENCH_INTERSECTIONS
+// intersections all due at once, the worst case of a control period;
+// prints the bus cycles of each count, then the intersections that fit in
+// BENCH_PERIOD from the cost per intersection and the fixed cost
+// Input: none
+// Output: none
+void Bench(void){
+	unsigned long n, i, now, cycles, first = 0, each, fixed;
+	UART_OutString((unsigned char *)"   n     cycles     each\r\n");
+	for(n = 1; n <= BENCH_INTERSECTIONS; n = 2*n){
+		now = Dwell_Now();
+		for(i = 0; i < n; i++){           // all on the lab's pins, only the time matters
+			Intersection_Init(&BenchIntersections[i], &Pins[0], now);
+			BenchIntersections[i].Deadline = now;
 		}
-		semaphoroMask <<= 3;
-		
-		switch(southSemaphoroState){
-			case STREET_SEMAPHORO_OFF:
-				break;
-			case STREET_SEMAPHORO_RED:
-				semaphoroMask |= 0x04;
-				break;
-			case STREET_SEMAPHORO_YELLOW:
-				semaphoroMask |= 0x02;
-				break;
-			case STREET_SEMAPHORO_GREEN:
-			default:
-				semaphoroMask |= 0x01;//for security by defaulf semaphoro is red
+		now = Dwell_Cycles();
+		Intersection_Service(BenchIntersections, n);
+		cycles = (Dwell_Cycles()-now)&0xFFFFFFFF;
+		if(n == 1){
+			first = cycles;
 		}
-		
-		GPIO_PORTB_DATA_R = semaphoroMask;
-}
-
-void UpdateWalkSemaphoro(WalkSemaphoroState walkSemaphoroState ){
-	switch(walkSemaphoroState){
-		case WALK_SEMAPHORO_OFF:
-			GPIO_PORTF_DATA_R = 0x00;
-			break;
-		case WALK_SEMAPHORO_GREEN:
-			GPIO_PORTF_DATA_R = 0x08;
-			break;
-		case WALK_SEMAPHORO_RED:
-		default:
-			GPIO_PORTF_DATA_R = 0x02;
-	}		
-}
-
-void UpdateSemaphoros(IntersectionStateInfo stateInfo){
-	UpdateStreetSemaphoro(stateInfo.WestStreetSemaphoro,stateInfo.SouthStreetSemaphoro);
-	UpdateWalkSemaphoro(stateInfo.walkSemaphoro);
-}
-	
-void SysTick_Init(void){
-  NVIC_ST_CTRL_R = 0;                   // disable SysTick during setup
-  NVIC_ST_RELOAD_R = 0x00FFFFFF;        // maximum reload value
-  NVIC_ST_CURRENT_R = 0;                // any write to current clears it             
-  NVIC_ST_CTRL_R = 0x00000005;          // enable SysTick with core clock
+		OutNumber(n, 4);
+		OutNumber(cycles, 10);
+		OutNumber(cycles/n, 8);
+		UART_OutString((unsigned char *)"\r\n");
+	}
+	each = (cycles-first)/(BENCH_INTERSECTIONS-1);  // the fixed cost cancels out
+	if(each == 0){
+		each = 1;
+	}
+	fixed = (first > each)? first-each : 0;         // one intersection costs more than each alone
+	if(fixed > BENCH_PERIOD){
+		fixed = BENCH_PERIOD;
+	}
+	UART_OutString((unsigned char *)"in 1 ms: ");
+	OutNumber((BENCH_PERIOD-fixed)/each, 0);
+	UART_OutString((unsigned char *)"intersections\r\n");
 }
+#endif
 
-// The delay parameter is in units of the 80 MHz core clock. (12.5 ns)
-void SysTick_Wait(unsigned long delay){
-  NVIC_ST_RELOAD_R = delay-1;  // number of counts to wait
-  NVIC_ST_CURRENT_R = 0;       // any value written to CURRENT clears
-  while((NVIC_ST_CTRL_R&0x00010000)==0){ // wait for count flag
-  }
-}
-// 800000*12.5ns equals 10ms
-void SysTick_Wait10ms(unsigned long delay){
-  unsigned long i;
-  for(i=0; i<delay; i++){
-    SysTick_Wait(800000);  // wait 10ms
-  }
+//------------SelectProfile------------
+// Apply the profile commands received on UART0 to every intersection,
+// each answered with the profile's name, or '?' if it is not a command
+// Input: none
+// Output: none
+void SelectProfile(void){
+	unsigned char command;
+	while((command = UART_InCharNonBlocking()) != 0){
+		if((command == 'd') || (command == 'D')){
+			Intersection_SetProfile(Intersections, INTERSECTIONS, PROFILE_NORMAL);
+			UART_OutString((unsigned char *)"day\r\n");
+		} else if((command == 'r') || (command == 'R')){
+			Intersection_SetProfile(Intersections, INTERSECTIONS, PROFILE_RUSH);
+			UART_OutString((unsigned char *)"rush\r\n");
+		} else if((command == 'n') || (command == 'N')){
+			Intersection_SetProfile(Intersections, INTERSECTIONS, PROFILE_NIGHT);
+			UART_OutString((unsigned char *)"night\r\n");
+		} else if((command != '\r') && (command != '\n')){
+			UART_OutString((unsigned char *)"?\r\n");
+		}
+	}
 }
 
-//PortE will be used to read the 3 sensors input:
-void PortE_Init(void)
-{
-	//1) Enable Port clock was already done on function Port_Init
-	//2) unlock GPIO is unnecessary for Port E
-  GPIO_PORTE_AMSEL_R &= ~0x07;         //3)All pins set as digital signal.
-  GPIO_PORTE_PCTL_R  &= ~0x00000FFF;	//4)PE0, PE1, PE2 Pins set as standard GPIO
-  GPIO_PORTE_DIR_R   &= ~0x07;      	//5)PE0, PE1, PE2 are inputs
-  GPIO_PORTE_AFSEL_R &= ~0x07;        //6)PE0, PE1, PE2 don't use alernative function
-  GPIO_PORTE_PUR_R   &= ~0x07;        //7)Disable pull-up on PE0, PE1, PE2
-	GPIO_PORTE_PDR_R   &= ~0x07;        //8)Disable pull-down on PE0, PE1, PE2
-  GPIO_PORTE_DEN_R   |=  0x07;        //9)Enable digital I/O on PE0, PE1, PE2
+//------------Sensors_Init------------
+// Hand the sensors' levels now to the intersections and start debouncing
+// them, unless SENSOR_POLLING
+// Input: none
+// Output: none
+void Sensors_Init(void){
+#ifndef SENSOR_POLLING
+	Debounce_Init(SensorPorts, 1);
+	Intersection_Sense(Intersections, INTERSECTIONS, GPIO_PORTE,
+	                   DEBOUNCE_PORT(Debounce_Levels(),0), 0);
+	NVIC_ST_CTRL_R = 0;               // SysTick off until an edge
+	NVIC_SYS_PRI3_R = (NVIC_SYS_PRI3_R&0x00FFFFFF)|0x40000000; // priority 2, as GPIOPortE_Handler
+#endif
 }
 
-//PortB will be used to output the 3 LED values for each semaphoro:
-void PortB_Init(void)
-{
-	//1) Enable Port clock was already done on function Port_Init
-	//2) unlock GPIO is unnecessary for Port B
-  GPIO_PORTB_AMSEL_R &= ~0x3F;      		//3) All pins set as digital signal.
-  GPIO_PORTB_PCTL_R  &= ~0x00FFFFFF;	//4) PB0, PB1, PB2, PB3, PB4, PB5 Pins set as standard GPIO
-  GPIO_PORTB_DIR_R	 |=  0x3F;       	//5) PB0, PB1, PB2, PB3, PB4, PB5 are outputs
-  GPIO_PORTB_AFSEL_R &= ~0x3F;        //6) PB0, PB1, PB2, PB3, PB4, PB5 don't use alternative function
-  GPIO_PORTB_PUR_R   &= ~0x3F;        //7) Disable pull-up on PB0, PB1, PB2, PB3, PB4, PB5
-	GPIO_PORTB_PDR_R   &= ~0x3F;        //8) Disable pull-down on PB0, PB1, PB2, PB3, PB4, PB5
-  GPIO_PORTB_DEN_R   |=  0x3F;        //9) Enable digital I/O on PB0, PB1, PB2, PB3, PB4, PB5
+//any edge on PE2-0: latch the requests of the pins that went high,
+//provisionally, and sample them until they settle
+void GPIOPortE_Handler(void){
+	unsigned long edges = GPIO_PORTE_RIS_R&0x07, rising;
+	GPIO_PORTE_ICR_R = edges;           // acknowledge
+	rising = edges&GPIO_PINS(GPIO_PORTE,0x07)&~DEBOUNCE_PORT(Debounce_Levels(),0);
+	Intersection_Latch(Intersections, INTERSECTIONS, GPIO_PORTE, rising);
+	if((NVIC_ST_CTRL_R&0x01) == 0){
+		NVIC_ST_RELOAD_R = Clock_Frequency()/1000*DEBOUNCE_MS-1;
+		NVIC_ST_CURRENT_R = 0;          // any write to current clears it
+		NVIC_ST_CTRL_R = 0x00000007;    // enable SysTick with core clock and interrupts
+		Checking |= rising;             // the next sample is DEBOUNCE_MS away
+	} else{
+		Arriving |= rising;             // the next one may be any moment
+	}
 }
 
-void PortF_Init(void)
-{
-	GPIO_PORTF_LOCK_R = 0x4C4F434B;   	// 2.1) unlock GPIO Port F
-  GPIO_PORTF_CR_R = 0x1F;           	// 2.2)allow changes to PF4-0
-  // only PF0 needs to be unlocked, other bits can't be locked
-  GPIO_PORTF_AMSEL_R &=  0x0A;      	//3) disable analog on PB
-  GPIO_PORTF_PCTL_R  &= ~0x0000F0F0;	//4)All Pins set as standard GPIO
-  GPIO_PORTF_DIR_R 	 |=  0x0A;       	//5)PF1 and PF3 will be outputs
-  GPIO_PORTF_AFSEL_R &= ~0x0A;      	//6)PF1 and PF3 dont use alternative function
-  GPIO_PORTF_PUR_R   &= ~0x0A;      	//7)Disable pull-up on PF1 and PF3
-	GPIO_PORTF_PDR_R   &= ~0x0A;      	//8)Disable pull-down on PF1 and PF3
-  GPIO_PORTF_DEN_R   |=  0x0A;      	//Enable digital I/O on PF1 and PF3
+//every DEBOUNCE_MS while PE2-0 move: decide the provisional requests,
+//debounce, latch the requests of the rising edges and stop when nothing
+//is left to settle or decide
+void SysTick_Handler(void){
+	unsigned long levels;
+	Intersection_Confirm(Intersections, INTERSECTIONS, GPIO_PORTE,
+	                     GPIO_PINS(GPIO_PORTE,0x07), Checking);
+	Checking = Arriving;
+	Arriving = 0;
+	Debounce_Sample();
+	levels = DEBOUNCE_PORT(Debounce_Levels(),0);
+	Intersection_Sense(Intersections, INTERSECTIONS, GPIO_PORTE, levels,
+	                   DEBOUNCE_PORT(Debounce_Edges(),0)&levels);
+	if(Debounce_Settled() && (Checking == 0)){
+		NVIC_ST_CTRL_R = 0;             // an edge starts it again
+	}
 }
 
+// Lights PB5-0, sensors PE2-0, walk PF3 and don't walk PF1; the sensor
+// edges, both ways, interrupt unless SENSOR_POLLING
 void Port_Init(void)
 {
-	volatile unsigned long delay;
-	//Start clock for Ports F, E and B = 0b110010= 0x32
-	SYSCTL_RCGC2_R |= 0x0000032;     // 1) activate clock for Port F
-  delay = SYSCTL_RCGC2_R;           // allow time for clock to start
-  
-	PortB_Init();
-	PortE_Init();
-	PortF_Init();
+	Gpio_ConfigureAll(Board, sizeof(Board)/sizeof(Board[0]));
+#ifndef SENSOR_POLLING
+  GPIO_PORTE_IS_R    &= ~0x07;        //PE2-0 are edge-sensitive
+  GPIO_PORTE_IBE_R   |=  0x07;        //   both edges, Debounce_Sample tells them apart
+  GPIO_PORTE_ICR_R    =  0x07;        //clear flags
+  GPIO_PORTE_IM_R    |=  0x07;        //arm interrupts on PE2-0
+  NVIC_PRI1_R = (NVIC_PRI1_R&0xFFFFFF00)|0x00000040; //IRQ 4 priority 2
+  NVIC_EN0_R = 0x00000010;            //enable IRQ 4 in NVIC
+#endif
 }
-
-
@@ -0,0 +1,155 @@
+// FormatBench.c
+// Runs on Linux (x86-64 or any LP64 host), not part of the Keil project
+// Host benchmark for the decimal conversion in UART.c.  It times
+//   UART_ConvertUDec, two lookups in the digit pair table, against the
+//     digit at a time %10 and /10 loop it replaced, on 0 to 9999,
+//   UART_FormatU32 against the same loop widened to 10 digits and
+//     against sprintf, on the full 32-bit range,
+// and checks every result against sprintf on the way, FormatU32 also
+// with field widths and each flag.
+// These are host nanoseconds per call, best of several runs: the
+// register emulation counts register accesses only and a conversion
+// has none, so it has no cycles to give.  The host compiler turns the
+// constant divides of the old loop into multiplies, as ARMCC does at
+// -O2 and above, so the ratio shows what the two digits per step and
+// the pair table save, not a UDIV against UMULL difference.  Typical
+// here: ConvertUDec 1.7x faster, FormatU32 1.5x faster, sprintf 7x
+// slower than FormatU32.
+// Build and run from this folder with
+//   gcc -O2 -DHOST_EMULATION -I.. -o formatbench FormatBench.c UART.c ../Clock.c ../Emulator/*.c
+//   ./formatbench
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "UART.h"
+
+#define VALUES 4096
+#define CALLS 4000000
+#define TIMINGRUNS 15
+
+extern unsigned char String[10];
+static unsigned long Small[VALUES], Large[VALUES];
+static char Buffer[16];
+static volatile unsigned long Sink;
+
+// UART_ConvertUDec before UART_FormatU32
+static void divideConvertUDec(unsigned long n){
+	unsigned long c;
+	unsigned long i;
+	if(n>=10000){
+		for(c=0;c<4;c++){
+			String[c]='*';
+		}
+	}else{
+		if(n != 0){
+			i = 4;
+			while(n != 0){
+				i--;
+				String[i] = (n%10)+'0';
+				n = n/10;
+			}
+		}else{
+			String[3] = '0';
+			i=3;
+		}
+		for(c=0;c<i;c++){
+			String[c] = ' ';
+		}
+	}
+	String[4] = ' ';
+	String[5] = 0;
+}
+
+// the same loop for 10 digits, unpadded
+static unsigned long divideFormatU32(char *dst, unsigned long n){
+char digits[10], *p = digits+10;
+unsigned long i = 0;
+  do{
+    *--p = (char)('0'+n%10);
+    n = n/10;
+  } while(n);
+  while(p < digits+10){
+    dst[i++] = *p++;
+  }
+  dst[i] = 0;
+  return i;
+}
+
+static void convertUDec(unsigned long n){
+  UART_ConvertUDec(n);
+}
+static void divideConvert(unsigned long n){
+  divideConvertUDec(n);
+}
+static void formatU32(unsigned long n){
+  Sink += UART_FormatU32(Buffer, n, 0, 0);
+}
+static void divideFormat(unsigned long n){
+  Sink += divideFormatU32(Buffer, n);
+}
+static void printfFormat(unsigned long n){
+  Sink += (unsigned long)sprintf(Buffer, "%lu", n);
+}
+
+// fastest of several runs of CALLS conversions, ns per call
+static double timeCalls(void (*convert)(unsigned long), const unsigned long *value){
+double best = 0, seconds;
+clock_t start;
+int run;
+long i;
+  for(run = 0; run < TIMINGRUNS; run++){
+    start = clock();
+    for(i = 0; i < CALLS; i++){
+      convert(value[i&(VALUES-1)]);
+    }
+    seconds = (double)(clock()-start)/CLOCKS_PER_SEC;
+    if((run == 0) || (seconds < best)){
+      best = seconds;
+    }
+  }
+  return 1e9*best/CALLS;
+}
+
+int main(void){ unsigned long i, seed = 12345, wrong = 0;
+char expect[16];
+double old, now, libc;
+  for(i = 0; i < VALUES; i++){
+    seed = (seed*1103515245+12345)&0xFFFFFFFF;
+    Large[i] = seed>>(seed&31);         // every digit count turns up
+    Small[i] = seed%10000;
+  }
+  for(i = 0; i < VALUES; i++){
+    UART_ConvertUDec(Small[i]);
+    sprintf(expect, "%4lu ", Small[i]);
+    wrong += strcmp((char *)String, expect) != 0;
+    UART_FormatU32(Buffer, Large[i], 0, 0);
+    sprintf(expect, "%lu", Large[i]);
+    wrong += strcmp(Buffer, expect) != 0;
+    UART_FormatU32(Buffer, Large[i], i%13, 0);
+    sprintf(expect, "%*lu", (int)(i%13), Large[i]);
+    wrong += strcmp(Buffer, expect) != 0;
+    UART_FormatU32(Buffer, Large[i], i%13, UART_FMT_ZEROPAD);
+    sprintf(expect, "%0*lu", (int)(i%13), Large[i]);
+    wrong += strcmp(Buffer, expect) != 0;
+    UART_FormatU32(Buffer, Large[i], i%13, UART_FMT_LEFT);
+    sprintf(expect, "%-*lu", (int)(i%13), Large[i]);
+    wrong += strcmp(Buffer, expect) != 0;
+  }
+  UART_FormatU32(Buffer, 0xFFFFFFFF, 0, 0);
+  wrong += strcmp(Buffer, "4294967295") != 0;
+  if(wrong){
+    printf("%lu conversions differ from sprintf\n", wrong);
+    return 1;
+  }
+  old = timeCalls(divideConvert, Small);
+  now = timeCalls(convertUDec, Small);
+  printf("conversion                  old ns    new ns   speedup\n");
+  printf("ConvertUDec 0-9999        %8.2f  %8.2f  %7.2fx\n", old, now, old/now);
+  old = timeCalls(divideFormat, Large);
+  now = timeCalls(formatU32, Large);
+  libc = timeCalls(printfFormat, Large);
+  printf("FormatU32 32-bit          %8.2f  %8.2f  %7.2fx\n", old, now, old/now);
+  printf("sprintf %%lu 32-bit        %8.2f\n", libc);
+  return 0;
+}
@@ -0,0 +1,148 @@
+// Tokenizer.c
+// Runs on TM4C123 or LM4F120
+// Incremental, non-blocking tokenizer for line-oriented UART0 input.
+// Characters are taken from the UART RX FIFO only while there is room
+// to echo them, so a slow terminal holds input back instead of losing echo.
+
+#include "UART.h"
+#include "Tokenizer.h"
+
+#define STATE_IDLE     0  // between tokens
+#define STATE_NUMBER   1  // typing digits
+#define STATE_WORD     2  // typing a word
+#define STATE_OVERFLOW 3  // typing digits past 4294967295
+
+//------------Tokenizer_Init------------
+// Start a tokenizer with no partial token
+// Input: t is the tokenizer
+// Output: none
+void Tokenizer_Init(Tokenizer *t){
+  t->State = STATE_IDLE;
+  t->EndPending = 0;
+  t->Length = 0;
+  t->Number = 0;
+  t->InputI = t->InputN = 0;
+}
+
+// close the token being typed, if any
+static TokenType finishToken(Tokenizer *t, Token *token){
+TokenType type;
+  switch(t->State){
+    case STATE_NUMBER:
+      type = TOKEN_NUMBER;
+      token->Number = t->Number;
+      break;
+    case STATE_WORD:
+      type = TOKEN_WORD;
+      t->Word[(t->Length<TOKENIZER_MAXWORD)?t->Length:TOKENIZER_MAXWORD] = 0;
+      token->Word = t->Word;
+      break;
+    case STATE_OVERFLOW:
+      type = TOKEN_OVERFLOW;
+      break;
+    default:
+      return TOKEN_NONE;
+  }
+  token->Type = type;
+  t->State = STATE_IDLE;
+  t->Length = 0;
+  return type;
+}
+
+//------------Tokenizer_Poll------------
+// Scan available UART input and return at most one token
+// Never waits: returns TOKEN_NONE when no token is complete yet
+// Echo for all characters scanned in this call goes out in one UART_Write
+// Input: t is the tokenizer
+//        token receives the token, unchanged when TOKEN_NONE is returned
+// Output: type of the token returned
+TokenType Tokenizer_Poll(Tokenizer *t, Token *token){
+unsigned char echo[TOKENIZER_CHUNK], c;
+unsigned long echoN=0, room;
+TokenType type = TOKEN_NONE;
+  if(t->EndPending){
+    t->EndPending = 0;
+    token->Type = TOKEN_END;
+    return TOKEN_END;
+  }
+  room = UART_TxFree();                 // never scan more than can be echoed
+  if(room > TOKENIZER_CHUNK){
+    room = TOKENIZER_CHUNK;
+  }
+  if(t->InputI == t->InputN){
+    t->InputI = 0;
+    t->InputN = (unsigned char)UART_Read(t->Input, room);
+  }
+  while((type == TOKEN_NONE) && (t->InputI < t->InputN) && (echoN < room)){
+    c = t->Input[t->InputI++];
+    if((c>='0') && (c<='9') && (t->State != STATE_WORD)){
+      if(t->State == STATE_IDLE){
+        t->State = STATE_NUMBER;
+        t->Number = 0;
+      }
+      if(t->State == STATE_NUMBER){     // 4294967295 = 10*429496729+5
+        if((t->Number > 429496729) || ((t->Number == 429496729) && (c > '5'))){
+          t->State = STATE_OVERFLOW;
+        } else{
+          t->Number = 10*t->Number+(c-'0');
+        }
+      }
+      t->Length++;
+      echo[echoN++] = c;
+    }
+    else if((c==BS) || (c==DEL)){
+      if(t->Length){
+        t->Length--;
+        if(t->State == STATE_NUMBER){
+          t->Number /= 10;
+        }
+        if(t->Length == 0){
+          t->State = STATE_IDLE;        // an overflowed number can only be erased entirely
+        }
+        echo[echoN++] = BS;
+      }
+    }
+    else if((c==SP) || (c==',') || (c==CR)){
+      type = finishToken(t, token);
+      if(c == CR){
+        if(type == TOKEN_NONE){
+          type = TOKEN_END;
+          token->Type = TOKEN_END;
+        } else{
+          t->EndPending = 1;
+        }
+      } else{
+        echo[echoN++] = c;
+      }
+    }
+    else if((c>SP) && (c<DEL) && ((t->State == STATE_IDLE) || (t->State == STATE_WORD))){
+      if(t->State == STATE_IDLE){
+        t->State = STATE_WORD;
+      }
+      if(t->Length < TOKENIZER_MAXWORD){
+        t->Word[t->Length] = (char)c;
+      }
+      t->Length++;
+      echo[echoN++] = c;
+    }                                   // other characters are ignored and not echoed
+  }
+  if(echoN){
+    UART_Write(echo, echoN);
+  }
+  return type;
+}
+
+//------------Tokenizer_Idle------------
+// Check whether Tokenizer_Poll has anything to do before the next
+// UART interrupt; call with interrupts disabled before sleeping
+// Input: t is the tokenizer
+// Output: 1 if waiting for input or for room to echo, 0 if not
+int Tokenizer_Idle(const Tokenizer *t){
+  if(t->EndPending){
+    return 0;
+  }
+  if(UART_TxFree() == 0){               // TX interrupt makes room
+    return 1;
+  }
+  return (t->InputI == t->InputN) && (UART_RxAvailable() == 0);
+}
@@ -0,0 +1,61 @@
+// Tokenizer.h
+// Runs on TM4C123 or LM4F120
+// Incremental, non-blocking tokenizer for line-oriented UART0 input.
+// Characters are taken from the UART RX FIFO only while there is room
+// to echo them, so a slow terminal holds input back instead of losing echo.
+
+// Tokens are separated by spaces or commas, a line ends with CR
+//   number: decimal digits, 0 to 4294967295 (2^32-1)
+//   word:   any other printable characters, at most TOKENIZER_MAXWORD kept
+// Backspace removes the last character of the token being typed
+
+// longest word kept, extra characters are echoed but dropped
+#define TOKENIZER_MAXWORD 15
+// most characters taken from the RX FIFO per call to Tokenizer_Poll
+#define TOKENIZER_CHUNK 16
+
+typedef enum t_TokenType{
+  TOKEN_NONE,       // no complete token yet
+  TOKEN_NUMBER,     // Number holds the value
+  TOKEN_WORD,       // Word holds the null-terminated text
+  TOKEN_OVERFLOW,   // a number above 4294967295 was typed
+  TOKEN_END         // CR, end of line
+}TokenType;
+
+typedef struct t_Token{
+  TokenType Type;
+  unsigned long Number;
+  const char *Word; // points into the Tokenizer, valid until the next Tokenizer_Poll
+}Token;
+
+typedef struct t_Tokenizer{
+  unsigned char State;                  // idle, in number, in word, in overflowed number
+  unsigned char EndPending;             // CR ended a token, TOKEN_END is next
+  unsigned long Length;                 // characters in the token being typed, any line length
+  unsigned long Number;                 // value of the number being typed
+  char Word[TOKENIZER_MAXWORD+1];       // text of the word being typed
+  unsigned char Input[TOKENIZER_CHUNK]; // characters taken from the UART but not yet scanned
+  unsigned char InputI, InputN;
+}Tokenizer;
+
+//------------Tokenizer_Init------------
+// Start a tokenizer with no partial token
+// Input: t is the tokenizer
+// Output: none
+void Tokenizer_Init(Tokenizer *t);
+
+//------------Tokenizer_Poll------------
+// Scan available UART input and return at most one token
+// Never waits: returns TOKEN_NONE when no token is complete yet
+// Echo for all characters scanned in this call goes out in one UART_Write
+// Input: t is the tokenizer
+//        token receives the token, unchanged when TOKEN_NONE is returned
+// Output: type of the token returned
+TokenType Tokenizer_Poll(Tokenizer *t, Token *token);
+
+//------------Tokenizer_Idle------------
+// Check whether Tokenizer_Poll has anything to do before the next
+// UART interrupt; call with interrupts disabled before sleeping
+// Input: t is the tokenizer
+// Output: 1 if waiting for input or for room to echo, 0 if not
+int Tokenizer_Idle(const Tokenizer *t);
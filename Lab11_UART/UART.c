@@ -28,10 +28,93 @@
 
 #include "tm4c123gh6pm.h"
 #include "UART.h"
+#include "..//Clock.h"
+
+#define BAUD 115200
+
+long StartCritical (void);    // previous I bit, disable interrupts
+void EndCritical(long sr);    // restore I bit to previous value
+void WaitForInterrupt(void);  // low power mode, in startup.s
+
+// Software FIFOs between the main program and UART0_Handler.
+// Each FIFO has exactly one producer and one consumer, so the
+// free-running put/get indices need no critical sections:
+//   TxFifo: main program puts, UART0_Handler gets
+//   RxFifo: UART0_Handler puts, main program gets
+#define TXFIFOMASK (UART_TXFIFOSIZE-1)
+#define RXFIFOMASK (UART_RXFIFOSIZE-1)
+#if (UART_TXFIFOSIZE&TXFIFOMASK) || (UART_RXFIFOSIZE&RXFIFOMASK)
+#error "UART FIFO sizes must be powers of 2"
+#endif
+static volatile unsigned char TxFifo[UART_TXFIFOSIZE];
+static volatile unsigned long TxPutI;  // written only by the main program
+static volatile unsigned long TxGetI;  // written only with TXIM disarmed or in UART0_Handler
+static volatile unsigned char RxFifo[UART_RXFIFOSIZE];
+static volatile unsigned long RxPutI;  // written only by UART0_Handler
+static volatile unsigned long RxGetI;  // written only by the main program
+unsigned long UART_RxLost;             // characters dropped because RxFifo was full
+
+// uDMA transmit path, UART0 TX is uDMA channel 9 encoding 0
+// The channel runs in ping-pong mode: DmaSlot[0] is described by the
+// primary control structure, DmaSlot[1] by the alternate one, so the
+// next block can be queued while the current one is on the wire.
+#define DMA_CH            9
+#define DMA_CHBIT         (1<<DMA_CH)
+#define DMA_PRI           (DMA_CH*4)        // word index of primary control structure
+#define DMA_ALT           (128+DMA_CH*4)    // word index of alternate control structure
+#define DMA_SRCENDP       (UDMA_SRCENDP/4)  // word offsets within a control structure
+#define DMA_DSTENDP       (UDMA_DSTENDP/4)
+#define DMA_CHCTL         (UDMA_CHCTL/4)
+#define DMA_UART0DR       0x4000C000        // address of UART0_DR_R, the fixed destination
+                                           // byte source incrementing, byte destination fixed at UART0_DR_R,
+                                           // arbitrate every 4 bytes (TX FIFO level 1/8 leaves room for 14)
+#define DMA_CONTROL       (UDMA_CHCTL_DSTINC_NONE|UDMA_CHCTL_DSTSIZE_8|UDMA_CHCTL_SRCINC_8|\
+                           UDMA_CHCTL_SRCSIZE_8|UDMA_CHCTL_ARBSIZE_4|UDMA_CHCTL_XFERMODE_PINGPONG)
+__align(1024) static unsigned long DmaTable[256]; // uDMA channel control table, primary then alternate
+typedef struct{
+  const unsigned char *Buffer;
+  unsigned long Length;
+  void (*Done)(const unsigned char *buffer);
+} DmaSlotType;
+static DmaSlotType DmaSlot[2];
+static volatile unsigned long DmaCount;    // descriptors queued or on the wire, 0 to 2
+static unsigned long DmaNext;              // slot used by the next UART_DMA_Write
+static unsigned long DmaActive;            // oldest queued slot
+static unsigned long DmaOn;                // 1 once UART_DMA_Init has clocked the uDMA
+
+// baud rate divisor for the bus clock, BRD = hz/(16*BAUD) with 6 bits of fraction:
+// IBRD = int(80,000,000 / (16 * 115200)) = int(43.402778) = 43
+// FBRD = round(0.402778 * 64) = 26
+static void setDivisor(unsigned long hz){ unsigned long brd = (8*hz/BAUD+1)/2; // 64*BRD rounded
+  UART0_IBRD_R = brd>>6;
+  UART0_FBRD_R = brd&0x3F;
+}
+
+// Clock_SetFrequency calls these with interrupts disabled: let the uDMA
+// finish both ping-pong halves (up to 2*UART_DMA_MAXLENGTH bytes, 178 ms)
+// and the characters in the hardware FIFO go out at the old rate, then
+// change the divisor (it takes effect on the LCRH write); what is still in
+// the software FIFO goes out at the new rate
+static void clockBefore(unsigned long hz){
+  (void)hz;                             // the old divisor still applies
+  if(DmaOn){                            // the channel disables itself when
+    while(UDMA_ENASET_R&DMA_CHBIT){};   // the last queued structure is done
+  }
+  while(UART0_FR_R&UART_FR_BUSY){};
+}
+static void clockAfter(unsigned long hz){
+  UART0_CTL_R &= ~UART_CTL_UARTEN;
+  setDivisor(hz);
+  UART0_LCRH_R = (UART_LCRH_WLEN_8|UART_LCRH_FEN);
+  UART0_CTL_R |= UART_CTL_UARTEN;
+}
 
 //------------UART_Init------------
-// Initialize the UART for 115200 baud rate (assuming 80 MHz UART clock),
+// Initialize the UART for 115200 baud rate at the current bus clock,
 // 8 bit word length, no parity bits, one stop bit, FIFOs enabled
+// Receive and transmit are interrupt driven, UART0_Handler moves
+// data between the hardware FIFOs and the software FIFOs
+// The divisor follows Clock_SetFrequency
 // Input: none
 // Output: none
 void UART_Init(void){
@@ -39,27 +122,242 @@ void UART_Init(void){
 //                 switching from PC5,PC4 to PA1,PA0
   SYSCTL_RCGC1_R |= SYSCTL_RCGC1_UART0; // activate UART0
   SYSCTL_RCGC2_R |= SYSCTL_RCGC2_GPIOA; // activate port A
+  TxPutI = TxGetI = 0;                  // empty software FIFOs
+  RxPutI = RxGetI = 0;
   UART0_CTL_R &= ~UART_CTL_UARTEN;      // disable UART
-  UART0_IBRD_R = 43;                    // IBRD = int(80,000,000 / (16 * 115200)) = int(43.402778)
-  UART0_FBRD_R = 26;                    // FBRD = round(0.402778 * 64) = 26
+  setDivisor(Clock_Frequency());        // 43 and 26 at 80 MHz
                                         // 8 bit word length (no parity bits, one stop bit, FIFOs)
   UART0_LCRH_R = (UART_LCRH_WLEN_8|UART_LCRH_FEN);
+                                        // TX interrupt when hardware FIFO drops to 2 of 16,
+                                        // RX interrupt when it reaches 8 of 16 (or receive time out)
+  UART0_IFLS_R = (UART0_IFLS_R&~(UART_IFLS_RX_M|UART_IFLS_TX_M))+UART_IFLS_TX1_8+UART_IFLS_RX4_8;
+  UART0_IM_R |= UART_IM_RXIM|UART_IM_TXIM|UART_IM_RTIM; // arm RX, TX and receive time out
   UART0_CTL_R |= UART_CTL_UARTEN;       // enable UART
   GPIO_PORTA_AFSEL_R |= 0x03;           // enable alt funct on PA1,PA0
   GPIO_PORTA_DEN_R |= 0x03;             // enable digital I/O on PA1,PA0
                                         // configure PA1,PA0 as UART0
   GPIO_PORTA_PCTL_R = (GPIO_PORTA_PCTL_R&0xFFFFFF00)+0x00000011;
   GPIO_PORTA_AMSEL_R &= ~0x03;          // disable analog functionality on PA1,PA0
+  NVIC_PRI1_R = (NVIC_PRI1_R&~NVIC_PRI1_INT5_M)|0x00004000; // UART0 is IRQ 5, priority 2
+  NVIC_EN0_R = 1<<5;                    // enable IRQ 5 in NVIC
+  Clock_Register(clockBefore, clockAfter);
+}
+
+// copy from the software TX FIFO into the hardware TX FIFO
+// until the hardware is full or the software FIFO is empty
+// must run in UART0_Handler or with TXIM disarmed
+// the software FIFO waits while the uDMA owns the transmitter
+static void copySoftwareToHardware(void){
+  while((DmaCount == 0) && ((UART0_FR_R&UART_FR_TXFF) == 0) && (TxGetI != TxPutI)){
+    UART0_DR_R = TxFifo[TxGetI&TXFIFOMASK];
+    TxGetI++;
+  }
+}
+
+// copy from the hardware RX FIFO into the software RX FIFO
+// until the hardware is empty, characters that do not fit are counted in UART_RxLost
+// runs only in UART0_Handler
+static void copyHardwareToSoftware(void){ unsigned char data;
+  while((UART0_FR_R&UART_FR_RXFE) == 0){
+    data = (unsigned char)(UART0_DR_R&0xFF);
+    if((RxPutI-RxGetI) < UART_RXFIFOSIZE){
+      RxFifo[RxPutI&RXFIFOMASK] = data;
+      RxPutI++;
+    } else{
+      UART_RxLost++;
+    }
+  }
+}
+
+// start the channel on the oldest queued descriptor
+static void dmaStart(void){
+  if(DmaActive){
+    UDMA_ALTSET_R = DMA_CHBIT;          // begin with the alternate structure
+  } else{
+    UDMA_ALTCLR_R = DMA_CHBIT;          // begin with the primary structure
+  }
+  UART0_DMACTL_R |= UART_DMACTL_TXDMAE; // UART requests uDMA service
+  UDMA_ENASET_R = DMA_CHBIT;
+}
+
+// retire every descriptor the uDMA has finished, in order
+// the controller rewrites XFERMODE to stop when a structure is done,
+// so one interrupt may retire both slots
+// runs in UART0_Handler
+static void dmaComplete(void){ DmaSlotType done;
+  while(DmaCount &&
+       ((DmaTable[(DmaActive?DMA_ALT:DMA_PRI)+DMA_CHCTL]&UDMA_CHCTL_XFERMODE_M) == UDMA_CHCTL_XFERMODE_STOP)){
+    done = DmaSlot[DmaActive];
+    DmaActive ^= 1;
+    DmaCount--;
+    if(done.Done){
+      done.Done(done.Buffer);           // caller may refill and requeue this buffer
+    }
+  }
+  if(DmaCount == 0){
+    UART0_DMACTL_R &= ~UART_DMACTL_TXDMAE;
+    copySoftwareToHardware();           // let the software FIFO drain
+  } else if((UDMA_ENASET_R&DMA_CHBIT) == 0){
+    dmaStart();                         // next descriptor arrived after the channel stopped
+  }
+}
+
+//------------UART0_Handler------------
+// UART0 interrupt, triggered when the hardware TX FIFO drops to
+// the IFLS level, the RX FIFO reaches the IFLS level, or
+// received data sits in the RX FIFO for 32 bit times
+// Tests MIS, not RIS: TXRIS also sets while UART_Write has TXIM
+// disarmed, and copySoftwareToHardware must not run then
+void UART0_Handler(void){
+  if(UART0_MIS_R&UART_MIS_TXMIS){       // hardware TX FIFO <= 2 items
+    UART0_ICR_R = UART_ICR_TXIC;        // acknowledge TX FIFO
+    copySoftwareToHardware();
+  }
+  if(UART0_MIS_R&(UART_MIS_RXMIS|UART_MIS_RTMIS)){
+    UART0_ICR_R = UART_ICR_RXIC|UART_ICR_RTIC; // acknowledge RX FIFO and time out
+    copyHardwareToSoftware();
+  }
+  if(DmaOn && (UDMA_CHIS_R&DMA_CHBIT)){ // uDMA finished a TX descriptor, its
+                                        // registers fault while its clock is off
+    UDMA_CHIS_R = DMA_CHBIT;            // acknowledge uDMA completion
+    dmaComplete();
+  }
+}
+
+//------------UART_Write------------
+// Queue up to count bytes for transmission and return immediately
+// Input: data points to the bytes to send
+//        count is the number of bytes to send
+// Output: number of bytes queued, less than count if the TX FIFO filled up
+unsigned long UART_Write(const unsigned char *data, unsigned long count){
+unsigned long n=0;
+  while((n < count) && ((TxPutI-TxGetI) < UART_TXFIFOSIZE)){
+    TxFifo[TxPutI&TXFIFOMASK] = data[n];
+    TxPutI++;
+    n++;
+  }
+  UART0_IM_R &= ~UART_IM_TXIM;          // disarm TX FIFO interrupt
+  copySoftwareToHardware();             // start the transmitter if it is idle
+  UART0_IM_R |= UART_IM_TXIM;           // rearm TX FIFO interrupt
+  return n;
+}
+
+//------------UART_Read------------
+// Take up to count received bytes and return immediately
+// Input: data points to where the bytes are stored
+//        count is the size of the data buffer
+// Output: number of bytes taken, 0 if nothing has been received
+unsigned long UART_Read(unsigned char *data, unsigned long count){
+unsigned long n=0;
+  while((n < count) && (RxGetI != RxPutI)){
+    data[n] = RxFifo[RxGetI&RXFIFOMASK];
+    RxGetI++;
+    n++;
+  }
+  return n;
+}
+
+//------------UART_DMA_Init------------
+// Activate the uDMA and assign channel 9 to UART0 TX
+// Call after UART_Init
+// Input: none
+// Output: none
+void UART_DMA_Init(void){
+  SYSCTL_RCGCDMA_R |= SYSCTL_RCGCDMA_R0;   // activate uDMA
+  DmaCount = DmaNext = DmaActive = 0;
+  UDMA_CFG_R = UDMA_CFG_MASTEN;            // enable uDMA controller
+  UDMA_CTLBASE_R = (unsigned long)DmaTable;
+  UDMA_CHMAP1_R &= ~UDMA_CHMAP1_CH9SEL_M;  // channel 9 encoding 0 is UART0 TX
+  UDMA_PRIOCLR_R = DMA_CHBIT;              // default priority
+  UDMA_USEBURSTCLR_R = DMA_CHBIT;          // respond to single and burst requests
+  UDMA_REQMASKCLR_R = DMA_CHBIT;           // allow the UART to request
+  DmaTable[DMA_PRI+DMA_CHCTL] = UDMA_CHCTL_XFERMODE_STOP;
+  DmaTable[DMA_ALT+DMA_CHCTL] = UDMA_CHCTL_XFERMODE_STOP;
+  DmaOn = 1;                               // UART0_Handler may read UDMA_CHIS_R now
+}
+
+//------------UART_DMA_Write------------
+// Hand a buffer to the uDMA for transmission and return immediately
+// Up to two buffers can be queued; the second starts as soon as the
+// first is sent, so the caller can format one while the other is sent.
+// The buffer must not be modified until done is called.
+// Bytes queued with UART_Write wait until the uDMA is idle.
+// Input: buffer points to the bytes to send
+//        length is 1 to UART_DMA_MAXLENGTH
+//        done is called from UART0_Handler when the buffer has been
+//        sent, or 0 for no notification
+// Output: 1 if queued, 0 if both descriptors are busy, length is invalid
+//         or UART_DMA_Init has not run
+int UART_DMA_Write(const unsigned char *buffer, unsigned long length,
+                   void (*done)(const unsigned char *buffer)){
+unsigned long slot, base; long sr;
+  if(!DmaOn || (length == 0) || (length > UART_DMA_MAXLENGTH)){
+    return 0;
+  }
+  sr = StartCritical();
+  if(DmaCount == 2){
+    EndCritical(sr);
+    return 0;
+  }
+  slot = DmaNext;
+  base = slot?DMA_ALT:DMA_PRI;
+  DmaSlot[slot].Buffer = buffer;
+  DmaSlot[slot].Length = length;
+  DmaSlot[slot].Done = done;
+  DmaTable[base+DMA_SRCENDP] = (unsigned long)(buffer+length-1);
+  DmaTable[base+DMA_DSTENDP] = DMA_UART0DR;
+  DmaTable[base+DMA_CHCTL] = DMA_CONTROL+((length-1)<<UDMA_CHCTL_XFERSIZE_S); // written last
+  DmaNext ^= 1;
+  DmaCount++;
+  if(DmaCount == 1){                    // bytes already in the hardware FIFO go out first
+    dmaStart();
+  }                                     // else the channel continues into this slot by itself
+  EndCritical(sr);
+  return 1;
+}
+
+//------------UART_DMA_Busy------------
+// Number of buffers queued or being sent by the uDMA
+// Input: none
+// Output: 0 (idle) to 2
+unsigned long UART_DMA_Busy(void){
+  return DmaCount;
+}
+
+//------------UART_TxFree------------
+// Space left in the software TX FIFO
+// UART_Write of up to this many bytes will not come up short
+// Input: none
+// Output: free bytes, 0 to UART_TXFIFOSIZE
+unsigned long UART_TxFree(void){
+  return UART_TXFIFOSIZE-(TxPutI-TxGetI);
+}
+
+//------------UART_RxAvailable------------
+// Bytes waiting in the software RX FIFO
+// Input: none
+// Output: bytes UART_Read can take now, 0 to UART_RXFIFOSIZE
+unsigned long UART_RxAvailable(void){
+  return RxPutI-RxGetI;
 }
 
 //------------UART_InChar------------
-// Wait for new serial port input
+// Wait for new serial port input, sleeping until it comes
+// Must not be called with interrupts disabled
 // Input: none
 // Output: ASCII code for key typed
 unsigned char UART_InChar(void){
-// as part of Lab 11, modify this program to use UART0 instead of UART1
-  while((UART0_FR_R&UART_FR_RXFE) != 0);
-  return((unsigned char)(UART0_DR_R&0xFF));
+unsigned char data;
+long sr;
+  while(1){
+    sr = StartCritical();       // no RX interrupt between the check and the sleep
+    if(UART_Read(&data, 1)){
+      EndCritical(sr);
+      return data;
+    }
+    WaitForInterrupt();         // wakes on a pending interrupt even with I=1
+    EndCritical(sr);            // the handler runs now
+  }
 }
 
 //------------UART_InCharNonBlocking------------
@@ -68,22 +366,21 @@ unsigned char UART_InChar(void){
 // Input: none
 // Output: ASCII code for key typed or 0 if no character
 unsigned char UART_InCharNonBlocking(void){
-// as part of Lab 11, modify this program to use UART0 instead of UART1
-  if((UART0_FR_R&UART_FR_RXFE) == 0){
-    return((unsigned char)(UART0_DR_R&0xFF));
+unsigned char data;
+  if(UART_Read(&data, 1)){
+    return data;
   } else{
     return 0;
   }
 }
 
 //------------UART_OutChar------------
-// Output 8-bit to serial port
+// Output 8-bit to serial port, waits only if the TX FIFO is full
+// Must not be called with interrupts disabled
 // Input: letter is an 8-bit ASCII character to be transferred
 // Output: none
 void UART_OutChar(unsigned char data){
-// as part of Lab 11, modify this program to use UART0 instead of UART1
-  while((UART0_FR_R&UART_FR_TXFF) != 0);
-  UART0_DR_R = data;
+  while(UART_Write(&data, 1) == 0){};
 }
 
 //------------UART_InUDec------------
@@ -129,6 +426,78 @@ void UART_OutString(unsigned char buffer[]){
   }
 }
 
+// ASCII for 00 through 99, two characters per entry
+static const char DigitPairs[200] =
+  "0001020304050607080910111213141516171819"
+  "2021222324252627282930313233343536373839"
+  "4041424344454647484950515253545556575859"
+  "6061626364656667686970717273747576777879"
+  "8081828384858687888990919293949596979899";
+
+// n/100 for any 32-bit n as a multiply by the reciprocal 2^37/100,
+// one UMULL and a shift, the same code ARMCC makes of n/100 when it
+// optimizes
+#define DIV100(n) ((unsigned long)(((unsigned long long)(n)*0x51EB851FULL)>>37))
+
+// decimal digits in n, 1 to 10, in at most four compares
+static unsigned long digitCount(unsigned long n){
+  if(n < 10000){
+    return (n < 100)? ((n < 10)? 1 : 2) : ((n < 1000)? 3 : 4);
+  }
+  if(n < 100000000){
+    return (n < 1000000)? ((n < 100000)? 5 : 6) : ((n < 10000000)? 7 : 8);
+  }
+  return (n < 1000000000)? 9 : 10;
+}
+
+//-----------------------UART_FormatU32-----------------------
+// Converts a 32-bit number in unsigned decimal format
+// The digits are counted first, so the padding goes in front and the
+// digits are written straight into dst, right to left, two per step
+// from the DigitPairs table; no divide instructions, no shared buffers
+// Input: dst is where the string is stored, at least max(width,10)+1 bytes
+//        n is the 32-bit number to convert
+//        width is the minimum field width, 0 for no padding
+//        flags is UART_FMT_ZEROPAD to pad with '0' instead of spaces,
+//        or UART_FMT_LEFT to left justify (pad with spaces on the right)
+// Output: number of characters stored, not counting the null termination
+// Examples with width 4
+//        4 to "   4"
+//       31 to "0031"  (UART_FMT_ZEROPAD)
+//      102 to "102 "  (UART_FMT_LEFT)
+// 4294967295 to "4294967295"
+unsigned long UART_FormatU32(char *dst, unsigned long n, unsigned long width, unsigned long flags){
+char *p, fill;
+unsigned long q, r, length = digitCount(n), i = 0;
+  if(((flags&UART_FMT_LEFT) == 0) && (width > length)){
+    fill = (flags&UART_FMT_ZEROPAD)?'0':' ';
+    for(; i < width-length; i++){
+      dst[i] = fill;
+    }
+  }
+  i += length;
+  p = dst+i;
+  while(n >= 100){
+    q = DIV100(n);
+    r = 2*(n-100*q);
+    n = q;
+    p -= 2;
+    p[0] = DigitPairs[r];
+    p[1] = DigitPairs[r+1];
+  }
+  if(n >= 10){
+    p[-2] = DigitPairs[2*n];
+    p[-1] = DigitPairs[2*n+1];
+  } else{
+    p[-1] = (char)('0'+n);
+  }
+  for(; i < width; i++){
+    dst[i] = ' ';
+  }
+  dst[i] = 0;
+  return i;
+}
+
 unsigned char String[10];
 //-----------------------UART_ConvertUDec-----------------------
 // Converts a 32-bit number in unsigned decimal format
@@ -143,27 +512,16 @@ unsigned char String[10];
 //10000 to "**** "  any value larger than 9999 converted to "**** "
 void UART_ConvertUDec(unsigned long n){
 // as part of Lab 11 implement this function
-	unsigned long c;
-	unsigned long i;
+unsigned long high, low;
 	if(n>=10000){
-		for(c=0;c<4;c++){
-			String[c]='*';
-		}
-	}else{
-		if(n != 0){
-			i = 4;
-			while(n != 0){
-				i--;
-				String[i] = (n%10)+'0';
-				n = n/10;
-			}
-		}else{
-			String[3] = '0';
-			i=3;
-		}
-		for(c=0;c<i;c++){
-			String[c] = ' ';
-		}
+		String[0] = String[1] = String[2] = String[3] = '*';
+	}else{                              // two pairs, no loop and no divide
+		high = 2*DIV100(n);
+		low = 2*n-100*high;
+		String[0] = (n>=1000)?DigitPairs[high]:' ';
+		String[1] = (n>=100)?DigitPairs[high+1]:' ';
+		String[2] = (n>=10)?DigitPairs[low]:' ';
+		String[3] = DigitPairs[low+1];
 	}
 	String[4] = ' ';
 	String[5] = 0;
@@ -179,6 +537,71 @@ void UART_OutUDec(unsigned long n){
   UART_OutString(String);  // output using your function
 }
 
+// n/10 for any 32-bit n as a multiply by the reciprocal 2^35/10
+#define DIV10(n) ((unsigned long)(((unsigned long long)(n)*0xCCCCCCCDULL)>>35))
+
+// 10^k, used to find the largest value a fixed-point format can show
+static const unsigned long Pow10[10]={
+  1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+//-----------------------UART_FormatFixed-----------------------
+// Converts a 32-bit unsigned fixed-point number into an ASCII string
+// The string is written right to left in a single pass, the decimal
+// point and the unit suffix go straight into their final positions
+// Input: dst is where the string is stored
+//        n is the number to convert, in units of 10^-Scale
+//        format gives the integer digits, scale, precision and unit,
+//        usually a const built with UART_FIXED
+// Output: number of characters stored, not counting the null termination
+// Leading zeros of the integer part are spaces, except the ones digit
+// Values that do not fit in IntDigits are shown with '*' for every digit
+// Examples with UART_FIXED(1,3,3," cm")
+//    4 to "0.004 cm"
+// 2210 to "2.210 cm"
+//10000 to "*.*** cm"
+// Example with UART_FIXED(3,3,1," V"): 12345 to " 12.3 V"
+unsigned long UART_FormatFixed(char *dst, unsigned long n, const UART_FixedFormat *format){
+unsigned long length, i, q, digits, overflow, dropped;
+const char *unit;
+char *p;
+  digits = format->IntDigits+format->Scale;
+  dropped = (unsigned long)(format->Scale-format->Precision); // truncated digits, Precision <= Scale
+  length = format->IntDigits+(format->Precision?format->Precision+1:0);
+  for(unit = format->Unit; *unit; unit++){
+    length++;
+  }
+  dst[length] = 0;
+  p = dst+length;
+  while(unit != format->Unit){          // unit suffix
+    *--p = *--unit;
+  }
+  overflow = (digits < 10) && (n >= Pow10[digits]);
+  for(i = 0; i < digits; i++){          // digits from least significant
+    if(overflow){
+      if(i >= dropped){
+        *--p = '*';
+      }
+    } else{
+      q = DIV10(n);
+      if(i >= dropped){
+        *--p = (char)('0'+n-10*q);
+      }
+      n = q;
+    }
+    if(format->Precision && (i+1 == format->Scale)){
+      *--p = '.';
+    }
+    if((n == 0) && !overflow && (i >= format->Scale)){
+      break;                            // remaining integer digits are leading zeros
+    }
+  }
+  while(p != dst){
+    *--p = ' ';
+  }
+  return length;
+}
+
 //-----------------------UART_ConvertDistance-----------------------
 // Converts a 32-bit distance into an ASCII string
 // Input: 32-bit number to be converted (resolution 0.001cm)
@@ -190,26 +613,10 @@ void UART_OutUDec(unsigned long n){
 //  102 to "0.102 cm" 
 // 2210 to "2.210 cm"
 //10000 to "*.*** cm"  any value larger than 9999 converted to "*.*** cm"
+static const UART_FixedFormat DistanceFormat = UART_FIXED(1,3,3," cm");
 void UART_ConvertDistance(unsigned long n){
 // as part of Lab 11 implement this function
-	unsigned long c;
-	UART_ConvertUDec(n);
-	for(c = 3;c>0;c--){
-		if(String[c] == ' '){
-			String[c] = '0';
-		}
-		String[c+1] = String[c];
-	}
-	
-	if(String[0] == ' '){
-			String[0] = '0';
-	}
-	
-	String[1]='.';
-	String[5]=' ';
-	String[6]='c';
-	String[7]='m';
-	String[8]= 0 ;
+	UART_FormatFixed((char *)String, n, &DistanceFormat);
 }
 
 //-----------------------UART_OutDistance-----------------------
@@ -34,15 +34,98 @@
 #define SP   0x20
 #define DEL  0x7F
 
+// software FIFO sizes in bytes, each must be a power of 2
+#define UART_TXFIFOSIZE 64
+#define UART_RXFIFOSIZE 64
+
+// number of received characters dropped because the RX FIFO was full
+extern unsigned long UART_RxLost;
+
+// UART_FormatU32 flags
+#define UART_FMT_ZEROPAD 0x01   // pad on the left with '0'
+#define UART_FMT_LEFT    0x02   // left justify, pad on the right with spaces
+
+// fixed-point output format for UART_FormatFixed
+typedef struct{
+  unsigned char IntDigits;  // digits before the decimal point
+  unsigned char Scale;      // the number is in units of 10^-Scale
+  unsigned char Precision;  // digits shown after the point, 0 to Scale (extra digits truncated)
+  const char *Unit;         // suffix such as " cm", "" for none
+} UART_FixedFormat;
+// initializer for a const UART_FixedFormat, e.g.
+// static const UART_FixedFormat Volts = UART_FIXED(2,3,2," V");
+#define UART_FIXED(intDigits,scale,precision,unit) {intDigits,scale,precision,unit}
+
+// largest single uDMA transfer, limited by the XFERSIZE field
+#define UART_DMA_MAXLENGTH 1024
+
 //------------UART_Init------------
-// Initialize the UART for 115200 baud rate (assuming 80 MHz clock),
+// Initialize the UART for 115200 baud rate at the current bus clock,
+// kept through Clock_SetFrequency (Clock.c must be in the project),
 // 8 bit word length, no parity bits, one stop bit, FIFOs enabled
+// Receive and transmit are interrupt driven
 // Input: none
 // Output: none
 void UART_Init(void);
 
+//------------UART_Write------------
+// Queue up to count bytes for transmission and return immediately
+// Input: data points to the bytes to send
+//        count is the number of bytes to send
+// Output: number of bytes queued, less than count if the TX FIFO filled up
+unsigned long UART_Write(const unsigned char *data, unsigned long count);
+
+//------------UART_Read------------
+// Take up to count received bytes and return immediately
+// Input: data points to where the bytes are stored
+//        count is the size of the data buffer
+// Output: number of bytes taken, 0 if nothing has been received
+unsigned long UART_Read(unsigned char *data, unsigned long count);
+
+//------------UART_TxFree------------
+// Space left in the software TX FIFO
+// UART_Write of up to this many bytes will not come up short
+// Input: none
+// Output: free bytes, 0 to UART_TXFIFOSIZE
+unsigned long UART_TxFree(void);
+
+//------------UART_RxAvailable------------
+// Bytes waiting in the software RX FIFO
+// Input: none
+// Output: bytes UART_Read can take now, 0 to UART_RXFIFOSIZE
+unsigned long UART_RxAvailable(void);
+
+//------------UART_DMA_Init------------
+// Activate the uDMA and assign channel 9 to UART0 TX
+// Call after UART_Init
+// Input: none
+// Output: none
+void UART_DMA_Init(void);
+
+//------------UART_DMA_Write------------
+// Hand a buffer to the uDMA for transmission and return immediately
+// Up to two buffers can be queued; the second starts as soon as the
+// first is sent, so the caller can format one while the other is sent.
+// The buffer must not be modified until done is called.
+// Bytes queued with UART_Write wait until the uDMA is idle.
+// Input: buffer points to the bytes to send
+//        length is 1 to UART_DMA_MAXLENGTH
+//        done is called from UART0_Handler when the buffer has been
+//        sent, or 0 for no notification
+// Output: 1 if queued, 0 if both descriptors are busy, length is invalid
+//         or UART_DMA_Init has not run
+int UART_DMA_Write(const unsigned char *buffer, unsigned long length,
+                   void (*done)(const unsigned char *buffer));
+
+//------------UART_DMA_Busy------------
+// Number of buffers queued or being sent by the uDMA
+// Input: none
+// Output: 0 (idle) to 2
+unsigned long UART_DMA_Busy(void);
+
 //------------UART_InChar------------
-// Wait for new serial port input
+// Wait for new serial port input, sleeping until it comes
+// Must not be called with interrupts disabled
 // Input: none
 // Output: ASCII code for key typed
 unsigned char UART_InChar(void);
@@ -55,7 +138,8 @@ unsigned char UART_InChar(void);
 unsigned char UART_InCharNonBlocking(void);
 
 //------------UART_OutChar------------
-// Output 8-bit to serial port
+// Output 8-bit to serial port, waits only if the TX FIFO is full
+// Must not be called with interrupts disabled
 // Input: letter is an 8-bit ASCII character to be transferred
 // Output: none
 void UART_OutChar(unsigned char data);
@@ -76,6 +160,21 @@ unsigned long UART_InUDec(void);
 // Output: none
 void UART_OutString(unsigned char buffer[]);
 
+//-----------------------UART_FormatU32-----------------------
+// Converts a 32-bit number in unsigned decimal format
+// Reentrant, the result goes to the caller's buffer
+// Input: dst is where the string is stored, at least max(width,10)+1 bytes
+//        n is the 32-bit number to convert
+//        width is the minimum field width, 0 for no padding
+//        flags is UART_FMT_ZEROPAD to pad with '0' instead of spaces,
+//        or UART_FMT_LEFT to left justify (pad with spaces on the right)
+// Output: number of characters stored, not counting the null termination
+// Examples with width 4
+//        4 to "   4"
+//       31 to "0031"  (UART_FMT_ZEROPAD)
+//      102 to "102 "  (UART_FMT_LEFT)
+// 4294967295 to "4294967295"
+unsigned long UART_FormatU32(char *dst, unsigned long n, unsigned long width, unsigned long flags);
 
 //-----------------------UART_ConvertUDec-----------------------
 // Converts a 32-bit number in unsigned decimal format
@@ -97,6 +196,23 @@ void UART_ConvertUDec(unsigned long n);
 // Fixed format 4 digits, one space after, null termination
 void UART_OutUDec(unsigned long n);
 
+//-----------------------UART_FormatFixed-----------------------
+// Converts a 32-bit unsigned fixed-point number into an ASCII string
+// Reentrant, the result goes to the caller's buffer
+// Input: dst is where the string is stored
+//        n is the number to convert, in units of 10^-Scale
+//        format gives the integer digits, scale, precision and unit,
+//        usually a const built with UART_FIXED
+// Output: number of characters stored, not counting the null termination
+// Leading zeros of the integer part are spaces, except the ones digit
+// Values that do not fit in IntDigits are shown with '*' for every digit
+// Examples with UART_FIXED(1,3,3," cm")
+//    4 to "0.004 cm"
+// 2210 to "2.210 cm"
+//10000 to "*.*** cm"
+// Example with UART_FIXED(3,3,1," V"): 12345 to " 12.3 V"
+unsigned long UART_FormatFixed(char *dst, unsigned long n, const UART_FixedFormat *format);
+
 //-----------------------UART_ConvertDistance-----------------------
 // Converts a 32-bit distance into an ASCII string
 // Input: 32-bit number to be converted (resolution 0.001cm)
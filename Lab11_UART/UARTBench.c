@@ -0,0 +1,159 @@
+// UARTBench.c
+// Runs on Linux (x86-64 or any LP64 host), not part of the Keil project
+// Host benchmark for the transmit side of UART.c, run on the register
+// emulation, whose UART0 model takes the line time of the divisor for
+// every character (86.8 us at 115200 baud) and whose uDMA model feeds
+// the transmit FIFO from channel 9.  It sends the same log of LINES
+// numbered lines
+//   with the polling UART_OutChar of the original Lab 11 (wait for
+//     TXFF to clear, write DR), TX interrupt disarmed,
+//   with the interrupt-driven UART_Write, a line at a time as the
+//     software FIFO has room,
+//   with UART_DMA_Write, ping-ponging between two line buffers, each
+//     refilled once its done callback has run,
+// the main program doing work in Emu_Tick steps until the log is out,
+// checks every character that reaches the line, and reports the
+// emulated cycles the main program loses to each, in total and per byte.
+// Emulated cycles count register accesses only (Emu_AccessCycles each,
+// default 1), not the instructions between them, so the interrupt and
+// uDMA drivers' costs are lower bounds; the polling driver's cost is its
+// wait for the line, which no instruction count changes.  Set
+// EMU_ACCESSCYCLES to charge more per access.  Typical here at 1 cycle
+// per access: polling 6,800, interrupt 2.4 and uDMA 0.1 cycles per byte.
+// Build and run from this folder with
+//   gcc -O2 -DHOST_EMULATION -I.. -o uartbench UARTBench.c UART.c ../Clock.c ../Emulator/*.c
+//   ./uartbench
+
+#include <stdio.h>
+#include <string.h>
+#include "..//tm4c123gh6pm.h"
+#include "..//Clock.h"
+#include "UART.h"
+
+void EnableInterrupts(void);  // Enable interrupts
+
+#define WORKSTEP 10           // cycles of main program work per Emu_Tick
+#define LINES 16              // lines in the log
+
+static const char Text[] =
+  ": The quick brown fox jumps over the lazy dog\r\n";
+#define LINELENGTH (sizeof(Text)-1+2)   // two digit line number in front, fits the TX FIFO
+#define LOGLENGTH (LINES*LINELENGTH)
+
+static unsigned char Log[LOGLENGTH];    // what every driver must send
+static unsigned long Sent;              // characters sent by the current driver
+static unsigned long Wrong;             // of those, not the one expected
+static void count(unsigned char data){
+  if((Sent >= LOGLENGTH) || (data != Log[Sent])){
+    Wrong++;
+  }
+  Sent++;
+}
+
+// line n of the log into buffer
+static void formatLine(unsigned char *buffer, unsigned long n){
+  buffer[0] = (unsigned char)('0'+n/10);
+  buffer[1] = (unsigned char)('0'+n%10);
+  memcpy(buffer+2, Text, sizeof(Text)-1);
+}
+
+// the original Lab 11 output, busy-waits on the hardware FIFO
+static void pollOutChar(unsigned char data){
+  while((UART0_FR_R&UART_FR_TXFF) != 0){};
+  UART0_DR_R = data;
+}
+
+// uDMA buffers, Free is set by the done callback in UART0_Handler
+static unsigned char Buffer[2][LINELENGTH];
+static volatile int Free[2];
+static void done(const unsigned char *buffer){
+  Free[buffer == Buffer[1]] = 1;
+}
+
+// start of a driver's run, log not yet sent
+static unsigned long long Start;
+static void begin(void){
+  Sent = Wrong = 0;
+  Start = Emu_Cycles;
+}
+// report a driver's run, 1 if the log did not come out right
+static int report(const char *driver, unsigned long long lost, unsigned long long line){
+  if((Sent != LOGLENGTH) || Wrong){
+    printf("%s: %lu of %lu characters sent, %lu wrong\n", driver, Sent, (unsigned long)LOGLENGTH, Wrong);
+    return 1;
+  }
+  printf("%-9s %14llu %13llu %5.1f%% %9.1f\n", driver, lost, line, 100.0*lost/line,
+    (double)lost/LOGLENGTH);
+  return 0;
+}
+
+int main(void){ unsigned long i, next;
+unsigned long long line, work;
+double interrupt;
+  for(i = 0; i < LINES; i++){
+    formatLine(&Log[i*LINELENGTH], i);
+  }
+  Emu_UARTOutput = count;
+  Clock_SetFrequency(80000000);
+  UART_Init();
+  UART_DMA_Init();
+  EnableInterrupts();
+  printf("%lu lines of %lu characters at 115200 baud, 80 MHz, %lu cycle(s) per register access\n",
+    (unsigned long)LINES, (unsigned long)LINELENGTH, Emu_AccessCycles);
+  printf("driver       lost cycles   log cycles   lost  per byte\n");
+
+  UART0_IM_R &= ~UART_IM_TXIM;          // polling: no TX interrupt
+  begin();
+  for(i = 0; i < LOGLENGTH; i++){
+    pollOutChar(Log[i]);
+  }
+  work = Emu_Cycles-Start;              // the CPU does nothing else meanwhile
+  while(UART0_FR_R&UART_FR_BUSY){};
+  line = Emu_Cycles-Start;
+  if(report("polling", work, line)){
+    return 1;
+  }
+  UART0_IM_R |= UART_IM_TXIM;           // interrupt driven
+
+  // the other drivers work for as long as the polling log took, with no
+  // register reads in the loop, so every cycle not worked went to the driver
+  begin();
+  next = 0;
+  for(work = 0; work < line; work += WORKSTEP){
+    if((next < LINES) && (UART_TxFree() >= LINELENGTH)){
+      UART_Write(&Log[next*LINELENGTH], LINELENGTH);
+      next++;
+    }
+    Emu_Tick(WORKSTEP);                 // UART0_Handler runs in here
+  }
+  if((UART_TxFree() != UART_TXFIFOSIZE) || (UART0_FR_R&UART_FR_BUSY) ||
+     report("interrupt", Emu_Cycles-Start-work, line)){
+    printf("interrupt driven log not out after %llu cycles\n", work);
+    return 1;
+  }
+  interrupt = (double)(Emu_Cycles-Start-work)/LOGLENGTH;
+
+  begin();
+  next = 0;
+  Free[0] = Free[1] = 1;
+  for(work = 0; work < line; work += WORKSTEP){
+    if((next < LINES) && Free[next&1]){ // format a line while the other is sent
+      Free[next&1] = 0;
+      formatLine(Buffer[next&1], next);
+      if(!UART_DMA_Write(Buffer[next&1], LINELENGTH, done)){
+        printf("UART_DMA_Write refused line %lu\n", next);
+        return 1;
+      }
+      next++;
+    }
+    Emu_Tick(WORKSTEP);                 // UART0_Handler runs in here
+  }
+  if(UART_DMA_Busy() || (UART0_FR_R&UART_FR_BUSY) ||
+     report("uDMA", Emu_Cycles-Start-work, line)){
+    printf("uDMA log not out after %llu cycles\n", work);
+    return 1;
+  }
+  printf("uDMA saves %.1f cycles per byte against the interrupt-driven driver\n",
+    interrupt-(double)(Emu_Cycles-Start-work)/LOGLENGTH);
+  return 0;
+}
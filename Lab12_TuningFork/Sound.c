@@ -0,0 +1,176 @@
+// Sound.c
+// Runs on LM4F120/TM4C123
+// Direct digital synthesis on a 4-bit DAC, see Sound.h.
+// The sample interrupt is a fixed, branch-free sequence: acknowledge,
+// then for each voice add, index and accumulate, then clip and store;
+// about 8 instructions per voice plus the fixed part and the 12-cycle
+// entry and exit, inside SOUND_ISRBUDGET.
+
+#include "..//tm4c123gh6pm.h"
+#include "..//Gpio.h"
+#include "..//Clock.h"
+#include "Sound.h"
+
+long StartCritical (void);    // previous I bit, disable interrupts
+void EndCritical(long sr);    // restore I bit to previous value
+
+#define DAC GPIO_PINS(GPIO_PORTB,0x0F) // bit-specific address of PB3-0
+
+#define PHASESHIFT (32-SOUND_TABLEBITS) // phase bits below the table index
+
+// CMSIS names for the Cortex-M4 saturating instructions, which the
+// ARMCC intrinsics compile to (one cycle each)
+#ifndef __QADD
+#define __QADD(a,b) __qadd((a),(b))
+#endif
+#ifndef __SSAT
+#define __SSAT(x,n) __ssat((x),(n))
+#endif
+
+// wavetables in flash, -128 to 127, one period each
+static const signed char Sine[SOUND_TABLESIZE]={
+     0,   12,   25,   37,   49,   60,   71,   81,   90,   98,  106,  112,  117,  122,  125,  126,
+   127,  126,  125,  122,  117,  112,  106,   98,   90,   81,   71,   60,   49,   37,   25,   12,
+     0,  -12,  -25,  -37,  -49,  -60,  -71,  -81,  -90,  -98, -106, -112, -117, -122, -125, -126,
+  -127, -126, -125, -122, -117, -112, -106,  -98,  -90,  -81,  -71,  -60,  -49,  -37,  -25,  -12
+};
+static const signed char Triangle[SOUND_TABLESIZE]={
+     0,    8,   16,   24,   32,   40,   48,   56,   64,   71,   79,   87,   95,  103,  111,  119,
+   127,  119,  111,  103,   95,   87,   79,   71,   64,   56,   48,   40,   32,   24,   16,    8,
+     0,   -8,  -16,  -24,  -32,  -40,  -48,  -56,  -64,  -71,  -79,  -87,  -95, -103, -111, -119,
+  -127, -119, -111, -103,  -95,  -87,  -79,  -71,  -64,  -56,  -48,  -40,  -32,  -24,  -16,   -8
+};
+static const signed char Sawtooth[SOUND_TABLESIZE]={
+  -128, -124, -120, -116, -112, -108, -104, -100,  -96,  -92,  -88,  -84,  -80,  -76,  -72,  -68,
+   -64,  -60,  -56,  -52,  -48,  -44,  -40,  -36,  -32,  -28,  -24,  -20,  -16,  -12,   -8,   -4,
+     0,    4,    8,   12,   16,   20,   24,   28,   32,   36,   40,   44,   48,   52,   56,   60,
+    64,   68,   72,   76,   80,   84,   88,   92,   96,  100,  104,  108,  112,  116,  120,  124
+};
+static const signed char Square[SOUND_TABLESIZE]={
+   127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+   127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+  -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128,
+  -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128
+};
+static const signed char * const Wavetable[SOUND_WAVEFORMS]={
+  Sine, Triangle, Sawtooth, Square
+};
+
+typedef struct t_Voice{
+  unsigned long Phase;              // 32-bit phase accumulator
+  unsigned long Increment;          // added every sample, 0 when silent
+  const signed char *Wave;          // table being played
+}VoiceType;
+static VoiceType Voice[SOUND_VOICES];
+static unsigned long MixShift;      // SOUND_MIXSHIFT of the voices playing
+
+static const GpioConfig DacPins[]={
+  {GPIO_PORTB, 0x0F, GPIO_OUT}
+};
+
+// Timer0A reload for SOUND_SAMPLEHZ at a bus clock of hz, rounded
+static void setPeriod(unsigned long hz){
+  TIMER0_TAILR_R = (hz+SOUND_SAMPLEHZ/2)/SOUND_SAMPLEHZ-1;
+}
+// Clock_SetFrequency calls this with interrupts disabled: the sample
+// rate, and so every pitch, stays put at the new clock
+static void clockAfter(unsigned long hz){
+  TIMER0_CTL_R = 0x00000000;        // restart the period from the new reload
+  setPeriod(hz);
+  TIMER0_CTL_R = 0x00000001;
+}
+
+//------------Sound_Init------------
+// Initialize the DAC on PB3-0 and the Timer0A sample interrupt, silent
+// The sample period is set from Clock_Frequency and follows Clock_SetFrequency
+// Input: none
+// Output: none
+void Sound_Init(void){ int v;
+  Gpio_ConfigureAll(DacPins, sizeof(DacPins)/sizeof(DacPins[0]));
+  GPIO_PORTB_DR8R_R |= 0x0F;        // 8 mA drive for the resistor ladder
+  for(v = 0; v < SOUND_VOICES; v++){
+    Voice[v].Phase = 0;
+    Voice[v].Increment = 0;
+    Voice[v].Wave = Sine;
+  }
+  MixShift = SOUND_MIXSHIFT(1);
+  DAC = 8;                          // silence at mid scale
+  SYSCTL_RCGCTIMER_R |= 0x01;       // activate Timer0
+  while((SYSCTL_PRTIMER_R&0x01) == 0){};
+  TIMER0_CTL_R = 0x00000000;        // disable Timer0A during setup
+  TIMER0_CFG_R = 0x00000000;        // 32-bit mode
+  TIMER0_TAMR_R = 0x00000002;       // periodic mode, default down-count
+  setPeriod(Clock_Frequency());     // follows Clock_SetFrequency
+  TIMER0_TAPR_R = 0;                // no prescale
+  TIMER0_ICR_R = 0x00000001;        // clear timeout flag
+  TIMER0_IMR_R = 0x00000001;        // arm timeout interrupt
+  NVIC_PRI4_R = (NVIC_PRI4_R&0x00FFFFFF)|0x40000000; // IRQ 19 priority 2
+  NVIC_EN0_R = 1<<19;               // enable IRQ 19 in NVIC
+  TIMER0_CTL_R = 0x00000001;        // enable Timer0A
+  Clock_Register(0, clockAfter);
+}
+
+// one sample: the same instructions for every waveform, frequency and
+// number of voices playing; a silent voice sits at phase 0 of Sine, 0
+void Timer0A_Handler(void){ int v, mix = 0;
+  TIMER0_ICR_R = 0x00000001;        // acknowledge timeout
+  for(v = 0; v < SOUND_VOICES; v++){ // unrolled, the count is a constant
+    Voice[v].Phase += Voice[v].Increment;
+    mix = __QADD(mix, Voice[v].Wave[(Voice[v].Phase>>PHASESHIFT)&(SOUND_TABLESIZE-1)]); // mask for hosts with 64-bit long
+  }
+  DAC = __SSAT(mix>>MixShift, 4)+8; // -8..7, mid scale is 8; MixShift keeps it in range
+}
+
+//------------Sound_Increment------------
+// Phase increment Sound_Play uses for a frequency; the frequency played
+// is increment*SOUND_SAMPLEHZ/2^32, within 2.4 uHz of the request
+// Input: freq_millihz is the frequency in mHz
+// Output: phase added per sample
+unsigned long Sound_Increment(unsigned long freq_millihz){
+  // 2^32*f/(1000*SOUND_SAMPLEHZ), rounded
+  return (unsigned long)((((unsigned long long)freq_millihz<<32)+500UL*SOUND_SAMPLEHZ)/(1000UL*SOUND_SAMPLEHZ));
+}
+
+//------------Sound_PlayVoice------------
+// Play a waveform on one voice until the next call for that voice,
+// 0 Hz for silence; the other voices keep playing
+// Input: voice is 0 to SOUND_VOICES-1, others are ignored
+//        freq_millihz is the frequency in mHz, at most SOUND_MAXMILLIHZ
+//        waveform selects the wavetable
+// Output: none
+void Sound_PlayVoice(unsigned long voice, unsigned long freq_millihz, SoundWaveform waveform){ long sr;
+unsigned long v, playing = 0;
+  if(voice >= SOUND_VOICES){
+    return;
+  }
+  if(freq_millihz > SOUND_MAXMILLIHZ){
+    freq_millihz = SOUND_MAXMILLIHZ;
+  }
+  if(waveform >= SOUND_WAVEFORMS){
+    waveform = SOUND_SINE;
+  }
+  sr = StartCritical();             // both change between two samples
+  Voice[voice].Increment = Sound_Increment(freq_millihz);
+  Voice[voice].Wave = Wavetable[waveform];
+  if(Voice[voice].Increment == 0){  // silent at Sine[0], 0: the first entry of
+    Voice[voice].Phase = 0;         // Square and Sawtooth is a rail, not mid scale
+    Voice[voice].Wave = Sine;
+  }
+  for(v = 0; v < SOUND_VOICES; v++){
+    if(Voice[v].Increment){
+      playing++;
+    }
+  }
+  MixShift = SOUND_MIXSHIFT(playing); // the whole DAC for the voices playing
+  EndCritical(sr);
+}
+
+//------------Sound_Play------------
+// Play a waveform on voice 0 until the next call, 0 Hz for silence
+// The phase carries over, so changing frequency does not click
+// Input: freq_millihz is the frequency in mHz, at most SOUND_MAXMILLIHZ
+//        waveform selects the wavetable
+// Output: none
+void Sound_Play(unsigned long freq_millihz, SoundWaveform waveform){
+  Sound_PlayVoice(0, freq_millihz, waveform);
+}
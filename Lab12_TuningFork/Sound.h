@@ -0,0 +1,90 @@
+// Sound.h
+// Runs on LM4F120/TM4C123
+// Direct digital synthesis (DDS) of periodic waveforms on a 4-bit
+// binary-weighted DAC.  Timer0A interrupts at SOUND_SAMPLEHZ; each
+// interrupt adds the phase increment to a 32-bit phase accumulator and
+// outputs the wavetable entry selected by the top bits of the phase, so
+// any frequency up to half the sample rate plays to 1 mHz resolution.
+// SOUND_VOICES voices play at once, each with its own accumulator and
+// wavetable; the interrupt adds their signed samples with saturating
+// arithmetic (QADD) and clips the sum to the DAC range (SSAT).
+
+// DAC bit 3 (MSB) PB3 through 1.5 kohm
+// DAC bit 2       PB2 through 3 kohm
+// DAC bit 1       PB1 through 6 kohm
+// DAC bit 0 (LSB) PB0 through 12 kohm
+// the four resistors join at the DAC output
+
+#ifndef __SOUND_H__
+#define __SOUND_H__
+
+// samples per second, also the Timer0A interrupt rate
+#define SOUND_SAMPLEHZ 20000
+// highest frequency Sound_Play accepts, half the sample rate, in mHz
+#define SOUND_MAXMILLIHZ (SOUND_SAMPLEHZ*500UL)
+// entries in each wavetable, indexed by the top SOUND_TABLEBITS of the phase
+#define SOUND_TABLEBITS 6
+#define SOUND_TABLESIZE (1<<SOUND_TABLEBITS)
+// voices mixed, set at compile time (e.g. -DSOUND_VOICES=8); every voice
+// costs the same whether it is playing or silent
+#ifndef SOUND_VOICES
+#define SOUND_VOICES 4
+#endif
+#if (SOUND_VOICES < 1) || (SOUND_VOICES > 32)
+#error "SOUND_VOICES must be 1 to 32"
+#endif
+// the wavetables are 8-bit signed and the DAC 4-bit: the mix is shifted
+// right by SOUND_MIXSHIFT of the number of voices playing, 4 plus log2
+// rounded up.  One voice, the tuning fork's tone, then uses the whole DAC
+// range and a chord can never reach the rails; the price is that every
+// note drops a step as voices join (half for 2, a quarter for 3 or 4),
+// and with fewer DAC steps per note its distortion rises.
+#define SOUND_MIXSHIFT(playing) (4+((playing) > 1)+((playing) > 2)+((playing) > 4)+ \
+                                 ((playing) > 8)+((playing) > 16))
+// cycles the sample interrupt may take, entry and exit included: 30 for
+// the fixed part (with the load of the shift) and 10 per voice (two loads, add, store, load the
+// table, shift, load the sample, QADD); at 80 MHz 4 voices are 70 cycles,
+// 1.75% of the 4000 cycles between samples
+#define SOUND_VOICECYCLES 10
+#define SOUND_ISRBUDGET (30+SOUND_VOICECYCLES*SOUND_VOICES)
+
+typedef enum t_SoundWaveform{
+  SOUND_SINE,
+  SOUND_TRIANGLE,
+  SOUND_SAWTOOTH,
+  SOUND_SQUARE
+}SoundWaveform;
+#define SOUND_WAVEFORMS (1+SOUND_SQUARE) //<= must to be always the last enum value
+
+//------------Sound_Init------------
+// Initialize the DAC on PB3-0 and the Timer0A sample interrupt, silent
+// The sample period is set from Clock_Frequency and follows Clock_SetFrequency
+// Input: none
+// Output: none
+void Sound_Init(void);
+
+//------------Sound_Play------------
+// Play a waveform on voice 0 until the next call, 0 Hz for silence
+// The phase carries over, so changing frequency does not click
+// Input: freq_millihz is the frequency in mHz, at most SOUND_MAXMILLIHZ
+//        waveform selects the wavetable
+// Output: none
+void Sound_Play(unsigned long freq_millihz, SoundWaveform waveform);
+
+//------------Sound_PlayVoice------------
+// Play a waveform on one voice until the next call for that voice,
+// 0 Hz for silence; the other voices keep playing
+// Input: voice is 0 to SOUND_VOICES-1, others are ignored
+//        freq_millihz is the frequency in mHz, at most SOUND_MAXMILLIHZ
+//        waveform selects the wavetable
+// Output: none
+void Sound_PlayVoice(unsigned long voice, unsigned long freq_millihz, SoundWaveform waveform);
+
+//------------Sound_Increment------------
+// Phase increment Sound_Play uses for a frequency; the frequency played
+// is increment*SOUND_SAMPLEHZ/2^32, within 2.4 uHz of the request
+// Input: freq_millihz is the frequency in mHz
+// Output: phase added per sample
+unsigned long Sound_Increment(unsigned long freq_millihz);
+
+#endif // __SOUND_H__
@@ -0,0 +1,193 @@
+// SoundBench.c
+// Runs on Linux (x86-64 or any LP64 host), not part of the Keil project
+// Host benchmark for the DDS engine in Sound.c, run on the register
+// emulation.  For each test tone it records one second of DAC samples
+// (one per Timer0A interrupt), then reports
+//   the frequency the phase increment gives and its error in ppm,
+//   the frequency measured from zero crossings of the DAC output,
+//   the fundamental against the rest of the signal (SINAD) from a DFT,
+//   the host sample throughput.
+// Then it plays chords on 1 to SOUND_VOICES voices and reports the
+// samples at the DAC rails (peaks reach them, the mix shift keeps the
+// sum from clipping) and the level of the weakest note against a voice
+// playing alone, and times Timer0A_Handler called directly, per sample
+// and per voice.  It fails (exit status 1) if the emulated cycles of a
+// handler call exceed SOUND_ISRBUDGET.  Emulated cycles count register
+// accesses only (Emu_AccessCycles each, EMU_ACCESSCYCLES to change), not
+// the instructions between them, so the check catches a handler that
+// touches more registers than budgeted; the instruction count against
+// the budget needs the board's cycle counter.
+// Build and run from this folder with
+//   gcc -O2 -DHOST_EMULATION -I.. -o soundbench SoundBench.c Sound.c ../Gpio.c ../Clock.c ../Emulator/*.c -lm
+//   EMU_STATS=1 ./soundbench
+// EMU_STATS adds the register accesses of the longest Timer0A_Handler run.
+// Add -DSOUND_VOICES=n to compare voice counts; the handler time grows
+// by the per-voice cost, the emulated cycles (register accesses) do not.
+
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#include "..//tm4c123gh6pm.h"
+#include "..//Clock.h"
+#include "Sound.h"
+
+void DisableInterrupts(void); // Disable interrupts
+void EnableInterrupts(void);  // Enable interrupts
+void Timer0A_Handler(void);
+void WaitForInterrupt(void);  // low power mode
+
+#define SAMPLES SOUND_SAMPLEHZ  // one second
+static double Sample[SAMPLES];
+
+#define CHORDVOICES 8           // A major over three octaves and a bit
+static const unsigned long Chord[CHORDVOICES]={  // mHz
+  440000, 554365, 659255, 880000, 1108731, 1318510, 1760000, 2217461
+};
+#define HANDLERCALLS 1000000
+#define TIMINGRUNS 7
+
+static const struct{
+  unsigned long MilliHz;
+  SoundWaveform Waveform;
+  const char *Name;
+} Tests[] = {
+  {440000,   SOUND_SINE,     "sine"},
+  {261626,   SOUND_SINE,     "sine"},
+  {1000500,  SOUND_SINE,     "sine"},
+  {3520000,  SOUND_SINE,     "sine"},
+  {440000,   SOUND_TRIANGLE, "triangle"},
+  {440000,   SOUND_SAWTOOTH, "sawtooth"},
+  {440000,   SOUND_SQUARE,   "square"}
+};
+
+// power of the signal at hz, by a single-bin DFT (Goertzel)
+static double power(double hz){ double w = 2*M_PI*hz/SOUND_SAMPLEHZ, c = 2*cos(w);
+double s0, s1 = 0, s2 = 0;
+int i;
+  for(i = 0; i < SAMPLES; i++){
+    s0 = Sample[i]+c*s1-s2;
+    s2 = s1;
+    s1 = s0;
+  }
+  return 2*(s1*s1+s2*s2-c*s1*s2)/((double)SAMPLES*SAMPLES);
+}
+
+// record one second of DAC samples, returns the fraction at either rail
+static double record(void){ int i, rails = 0;
+unsigned long dac;
+  WaitForInterrupt();                   // first sample at the new settings
+  for(i = 0; i < SAMPLES; i++){
+    WaitForInterrupt();                 // Timer0A_Handler runs before this returns
+    dac = GPIO_PORTB_DATA_R&0x0F;
+    Sample[i] = (double)dac;
+    if((dac == 0) || (dac == 15)){
+      rails++;
+    }
+  }
+  return (double)rails/SAMPLES;
+}
+
+// frequency from the first and last rising crossings of the mean
+static double measured(double mean){ int i, first = -1, last = -1, n = 0;
+double at, firstAt = 0, lastAt = 0;
+  for(i = 1; i < SAMPLES; i++){
+    if((Sample[i-1] < mean) && (Sample[i] >= mean)){
+      at = i-1+(mean-Sample[i-1])/(Sample[i]-Sample[i-1]);
+      if(first < 0){
+        first = i;
+        firstAt = at;
+      } else{
+        n++;
+      }
+      last = i;
+      lastAt = at;
+    }
+  }
+  if((n == 0) || (last == first)){
+    return 0;
+  }
+  return n*(double)SOUND_SAMPLEHZ/(lastAt-firstAt);
+}
+
+int main(void){ unsigned int t; int i, n, v;
+double mean, total, fundamental, hz, played, sinad, seconds, base, rails, expected, level, weakest;
+unsigned long long cycles;
+clock_t start;
+  Clock_SetFrequency(80000000);         // as TExaS_Init leaves it
+  Sound_Init();
+  EnableInterrupts();
+  printf("%-9s %11s %15s %10s %12s %9s %10s\n",
+    "waveform", "request Hz", "played Hz", "error ppm", "measured Hz", "SINAD dB", "samples/s");
+  for(t = 0; t < sizeof(Tests)/sizeof(Tests[0]); t++){
+    Sound_Play(Tests[t].MilliHz, Tests[t].Waveform);
+    start = clock();
+    record();
+    seconds = (double)(clock()-start)/CLOCKS_PER_SEC;
+    mean = 0;
+    for(i = 0; i < SAMPLES; i++){
+      mean += Sample[i];
+    }
+    mean /= SAMPLES;
+    total = 0;
+    for(i = 0; i < SAMPLES; i++){
+      Sample[i] -= mean;
+      total += Sample[i]*Sample[i];
+    }
+    total /= SAMPLES;
+    hz = Tests[t].MilliHz/1000.0;
+    played = Sound_Increment(Tests[t].MilliHz)*(double)SOUND_SAMPLEHZ/4294967296.0;
+    fundamental = power(played);
+    sinad = 10*log10(fundamental/(total-fundamental));
+    printf("%-9s %11.3f %15.9f %10.4f %12.3f %9.2f %10.0f\n",
+      Tests[t].Name, hz, played, 1e6*(played-hz)/hz, measured(0), sinad,
+      seconds > 0? SAMPLES/seconds : 0);
+  }
+  printf("\n%d voices, ISR budget %d cycles\n", SOUND_VOICES, SOUND_ISRBUDGET);
+  printf("%-6s %6s %10s %16s\n", "chord", "shift", "rails %", "weakest note dB");
+  expected = 127.0/(1<<SOUND_MIXSHIFT(1)); // one full-scale sine voice alone
+  for(n = 1; (n <= SOUND_VOICES) && (n <= CHORDVOICES); n++){
+    for(v = 0; v < SOUND_VOICES; v++){
+      Sound_PlayVoice(v, (v < n)? Chord[v] : 0, SOUND_SINE);
+    }
+    rails = record();
+    weakest = 0;
+    for(v = 0; v < n; v++){
+      level = 20*log10(sqrt(2*power(Sound_Increment(Chord[v])*(double)SOUND_SAMPLEHZ/4294967296.0))/expected);
+      if((v == 0) || (level < weakest)){
+        weakest = level;
+      }
+    }
+    printf("%-6d %6d %10.2f %16.2f\n", n, SOUND_MIXSHIFT(n), 100*rails, weakest);
+  }
+  DisableInterrupts();                  // the calls below stand in for the interrupt
+  base = seconds = 0;
+  for(n = 0; n < TIMINGRUNS; n++){      // fastest of several runs
+    start = clock();
+    for(i = 0; i < HANDLERCALLS; i++){  // the two register writes alone
+      TIMER0_ICR_R = 0x00000001;
+      HWREG(0x4000503C) = 8;
+    }
+    level = (double)(clock()-start)/CLOCKS_PER_SEC;
+    if((n == 0) || (level < base)){
+      base = level;
+    }
+    cycles = Emu_Cycles;
+    start = clock();
+    for(i = 0; i < HANDLERCALLS; i++){
+      Timer0A_Handler();
+    }
+    level = (double)(clock()-start)/CLOCKS_PER_SEC;
+    cycles = Emu_Cycles-cycles;
+    if((n == 0) || (level < seconds)){
+      seconds = level;
+    }
+  }
+  EnableInterrupts();
+  printf("\nTimer0A_Handler: %.1f host ns per sample, %.2f ns per voice, %.1f emulated cycles\n",
+    1e9*seconds/HANDLERCALLS, 1e9*(seconds-base)/HANDLERCALLS/SOUND_VOICES, (double)cycles/HANDLERCALLS);
+  if(cycles > (unsigned long long)SOUND_ISRBUDGET*HANDLERCALLS){
+    printf("over the ISR budget of %d cycles\n", SOUND_ISRBUDGET);
+    return 1;
+  }
+  return 0;
+}
@@ -37,6 +37,9 @@
 
 #include "TExaS.h"
 #include "..//tm4c123gh6pm.h"
+#include "..//Gpio.h"
+#include "..//Clock.h"
+#include "Sound.h"
 
 
 // basic functions defined at end of startup.s
@@ -44,22 +47,96 @@ void DisableInterrupts(void); // Disable interrupts
 void EnableInterrupts(void);  // Enable interrupts
 void WaitForInterrupt(void);  // low power mode
 
+#define PA2 GPIO_PINS(GPIO_PORTA,0x04) // bit-specific address of the headphone output
+#define PA3 GPIO_PINS(GPIO_PORTA,0x08) // bit-specific address of the switch input
+
+// SysTick toggles PA2 every half period of the tone. The reload is
+// rounded from the bus clock, at 80 MHz 80000000/880 = 90909.09 gives a
+// period of 2*90909 cycles, 440.00044 Hz (+1.0 ppm); it follows
+// Clock_SetFrequency
+#define TONE_HZ 440
+#define TONE_RELOAD(hz) (((hz)+TONE_HZ)/(2*TONE_HZ)-1)
+#if TONE_RELOAD(CLOCK_MAXHZ) > 0x00FFFFFF
+#error "tone half period does not fit the 24-bit SysTick counter"
+#endif
+// SysTick interrupts the switch must stay put after a change, about 10 ms
+#define DEBOUNCE_TICKS ((2*TONE_HZ)/100)
+
+volatile unsigned long Tone;    // 0x04 while the tone is on, 0 while off
+volatile unsigned long Ticks;   // SysTick interrupts, for the debounce wait
+
 // input from PA3, output from PA2, SysTick interrupts
-void Sound_Init(void){ 
+const GpioConfig TonePins[]={
+  {GPIO_PORTA, 0x04, GPIO_OUT},     // PA2 headphone
+  {GPIO_PORTA, 0x08, GPIO_IN}       // PA3 positive logic switch
+};
+
+// half period of 440 Hz at bus clock hz, restarted from a full half period
+static void toneStart(unsigned long hz){
+  NVIC_ST_CTRL_R = 0;               // disable SysTick during setup
+  NVIC_ST_RELOAD_R = TONE_RELOAD(hz);
+  NVIC_ST_CURRENT_R = 0;            // any write to current clears it
+  NVIC_ST_CTRL_R = 0x00000007;      // enable SysTick with core clock and interrupts
+}
 
+// Clock_SetFrequency calls this with interrupts disabled
+static void clockAfter(unsigned long hz){
+  toneStart(hz);
+}
+
+void Tone_Init(void){
+  Gpio_ConfigureAll(TonePins, sizeof(TonePins)/sizeof(TonePins[0]));
+  PA2 = 0;                          // tone off
+  Tone = 0;
+  NVIC_SYS_PRI3_R = (NVIC_SYS_PRI3_R&0x00FFFFFF)|0x20000000; // priority 1
+  toneStart(Clock_Frequency());     // follows Clock_SetFrequency
+  Clock_Register(0, clockAfter);
 }
 
 // called at 880 Hz
 void SysTick_Handler(void){
+  PA2 ^= Tone;                      // no branch: toggles only while the tone is on
+  Ticks = Ticks+1;
+}
 
+// wait for the switch to stay at one level for DEBOUNCE_TICKS, reading
+// it on every pass: a bounce starts the wait again, and the register
+// read lets the emulator's clock, and so SysTick, move
+// Input: level the switch was read at
+// Output: level it settled at
+static unsigned long debounce(unsigned long level){ unsigned long start = Ticks, now;
+  while((Ticks-start) < DEBOUNCE_TICKS){
+    now = PA3;
+    if(now != level){               // still bouncing
+      level = now;
+      start = Ticks;
+    }
+  }
+  return level;
 }
 
-int main(void){// activate grader and set system clock to 80 MHz
-  TExaS_Init(SW_PIN_PA3, HEADPHONE_PIN_PA2,ScopeOn); 
-  Sound_Init();         
+int main(void){ unsigned long last, now;
+  TExaS_Init(SW_PIN_PA3, HEADPHONE_PIN_PA2,ScopeOn); // activate grader and set system clock to 80 MHz
+  Tone_Init();
+  Sound_Init();         // the same tone as a sine wave on the PB3-0 DAC
   EnableInterrupts();   // enable after all initialization are done
+  last = PA3;
   while(1){
     // main program is free to perform other tasks
     // do not use WaitForInterrupt() here, it may cause the TExaS to crash
+    now = PA3;
+    if(now != last){
+      if(now){            // not touched to touched: toggle the tone
+        if(Tone){
+          Tone = 0;
+          PA2 = 0;        // leave the speaker off, the handler no longer touches PA2
+          Sound_Play(0, SOUND_SINE);
+        } else{
+          Tone = 0x04;
+          Sound_Play(1000*TONE_HZ, SOUND_SINE);
+        }
+      }
+      last = debounce(now);
+    }
   }
 }
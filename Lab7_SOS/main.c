@@ -16,22 +16,18 @@
 // 1. Pre-processor Directives Section
 #include "TExaS.h"
 
-// Constant declarations to access port registers using 
-// symbolic names instead of addresses
-#define GPIO_PORTF_DATA_R       (*((volatile unsigned long *)0x400253FC))
-#define GPIO_PORTF_DIR_R        (*((volatile unsigned long *)0x40025400))
-#define GPIO_PORTF_AFSEL_R      (*((volatile unsigned long *)0x40025420))
-#define GPIO_PORTF_PUR_R        (*((volatile unsigned long *)0x40025510))
-#define GPIO_PORTF_DEN_R        (*((volatile unsigned long *)0x4002551C))
-#define GPIO_PORTF_LOCK_R       (*((volatile unsigned long *)0x40025520))
-#define GPIO_PORTF_CR_R         (*((volatile unsigned long *)0x40025524))
-#define GPIO_PORTF_AMSEL_R      (*((volatile unsigned long *)0x40025528))
-#define GPIO_PORTF_PCTL_R       (*((volatile unsigned long *)0x4002552C))
-#define SYSCTL_RCGC2_R          (*((volatile unsigned long *)0x400FE108))
+#include "tm4c123gh6pm.h"
+#include "Timer.h"
+#include "Gpio.h"
+#include "Debounce.h"
+#define LEDS GPIO_PINS(GPIO_PORTF,0x0A) // PF3 and PF1, one store sets both
+#define PF4  0x10                       // SW1
+#define PF0  0x01                       // SW2
 // 2. Declarations Section
 //   Global Variables
 unsigned long SW1; // input from PF4
 unsigned long SW2; // input from PF0
+const unsigned long Switches[]={GPIO_PORTF}; // debounced, PF4 and PF0
 //   Function Prototypes
 void PortF_Init(void);
 void FlashSOS(void);
@@ -42,14 +38,17 @@ void EnableInterrupts(void);  // Enable interrupts
 // MAIN: Mandatory for a C Program to be executable
 	int main(void){
 		TExaS_Init(SW_PIN_PF40, LED_PIN_PF321);  // activate grader and set system clock to 80 MHz
+		Timer_Init();                 // 1 ms SysTick tick at the bus clock
 		PortF_Init(); // Init port PF4 PF2 PF0    
+		Debounce_Init(Switches, 1);   // switches debounced on the tick
+		Timer_Periodic(Debounce_Sample, DEBOUNCE_MS);
 		EnableInterrupts();           // enable interrupts for the grader
 		while(1){
-			SW1 = GPIO_PORTF_DATA_R&0x10; // PF4 into SW1 On==pressed==0
-			SW2 = GPIO_PORTF_DATA_R&0x01; // PF0 into SW2 On==pressed==0
+			SW1 = Debounce_Levels()&PF4; // PF4 into SW1 On==pressed==0
+			SW2 = Debounce_Levels()&PF0; // PF0 into SW2 On==pressed==0
 			if((SW1 != 0)||(SW2 != 0)){
 				//either one release led is off
-				GPIO_PORTF_DATA_R &= ~0x0A; delay(1);
+				LEDS = 0x00; delay(1);
 			}
 			if((SW1 == 0)&&(SW2 == 0)){
 				//both pressed flash SOS
@@ -63,18 +62,12 @@ void EnableInterrupts(void);  // Enable interrupts
 // Inputs: None
 // Outputs: None
 // Notes: ...
-void PortF_Init(void){ volatile unsigned long delay;
-  SYSCTL_RCGC2_R |= 0x00000020;     // 1) F clock
-  delay = SYSCTL_RCGC2_R;           // delay   
-  GPIO_PORTF_LOCK_R = 0x4C4F434B;   // 2) unlock PortF PF0  
-  GPIO_PORTF_CR_R |= 0x1F;           // allow changes to PF4-0       
-  GPIO_PORTF_AMSEL_R &= 0x00;        // 3) disable analog function
-  GPIO_PORTF_PCTL_R &= 0x00000000;   // 4) GPIO clear bit PCTL  
-  GPIO_PORTF_DIR_R &= ~(0x11);         	 // 5.1) inputs:PF0,PF4  	
-  GPIO_PORTF_DIR_R |= 0x0E;          // 5.2) outputs: PF1,PF2,PF3  
-  GPIO_PORTF_AFSEL_R &= 0x00;        // 6) no alternate function
-  GPIO_PORTF_PUR_R |= 0x11;          // enable pullup resistors on PF4,PF0       
-  GPIO_PORTF_DEN_R |= 0x1F;          // 7) enable digital pins PF4-PF0     
+const GpioConfig Board[]={
+  {GPIO_PORTF, 0x11, GPIO_PULLUP},  // SW1 PF4 and SW2 PF0, negative logic
+  {GPIO_PORTF, 0x0E, GPIO_OUT}      // LEDs PF3-1
+};
+void PortF_Init(void){
+  Gpio_ConfigureAll(Board, sizeof(Board)/sizeof(Board[0]));
 }
 // Color    LED(s) PortF
 // dark     ---    0
@@ -95,26 +88,26 @@ void PortF_Init(void){ volatile unsigned long delay;
 // Notes: ...
 void FlashSOS(void){
   //S
-  GPIO_PORTF_DATA_R |= 0x0A;  delay(1);
-  GPIO_PORTF_DATA_R &= ~0x0A; delay(1);
-  GPIO_PORTF_DATA_R |= 0x0A;  delay(1);
-  GPIO_PORTF_DATA_R &= ~0x0A; delay(1);
-  GPIO_PORTF_DATA_R |= 0x0A;  delay(1);
-  GPIO_PORTF_DATA_R &= ~0x0A; delay(1);
+  LEDS = 0x0A;  delay(1);
+  LEDS = 0x00; delay(1);
+  LEDS = 0x0A;  delay(1);
+  LEDS = 0x00; delay(1);
+  LEDS = 0x0A;  delay(1);
+  LEDS = 0x00; delay(1);
   //O
-  GPIO_PORTF_DATA_R |= 0x0A; delay(4);
-  GPIO_PORTF_DATA_R &= ~0x0A;delay(4);
-  GPIO_PORTF_DATA_R |= 0x0A; delay(4);
-  GPIO_PORTF_DATA_R &= ~0x0A;delay(4);
-  GPIO_PORTF_DATA_R |= 0x0A; delay(4);
-  GPIO_PORTF_DATA_R &= ~0x0A;delay(4);
+  LEDS = 0x0A; delay(4);
+  LEDS = 0x00;delay(4);
+  LEDS = 0x0A; delay(4);
+  LEDS = 0x00;delay(4);
+  LEDS = 0x0A; delay(4);
+  LEDS = 0x00;delay(4);
   //S
-  GPIO_PORTF_DATA_R |= 0x0A; delay(1);
-  GPIO_PORTF_DATA_R &= ~0x0A;delay(1);
-  GPIO_PORTF_DATA_R |= 0x0A; delay(1);
-  GPIO_PORTF_DATA_R &= ~0x0A;delay(1);
-  GPIO_PORTF_DATA_R |= 0x0A; delay(1);
-  GPIO_PORTF_DATA_R &= ~0x0A;delay(1);
+  LEDS = 0x0A; delay(1);
+  LEDS = 0x00;delay(1);
+  LEDS = 0x0A; delay(1);
+  LEDS = 0x00;delay(1);
+  LEDS = 0x0A; delay(1);
+  LEDS = 0x00;delay(1);
   delay(8); // Delay for 4 secs in between flashes 
 
 }
@@ -122,17 +115,8 @@ void FlashSOS(void){
 // Subroutine to delay in units of half seconds
 // Inputs: Number of half seconds to delay
 // Outputs: None
-// simple delay function
-// which delays time*500 milliseconds
-// assuming 80 MHz clock
+// sleeps on the SysTick tick, correct at any bus clock
 void delay(unsigned long time){
-  unsigned long i;
-  while(time > 0){
-    i = 6666665;
-    while(i > 0){
-      i = i - 1;
-    }
-    time = time - 1;
-  }
+  Timer_DelayMs(500*time);
 }
 
@@ -14,9 +14,13 @@
 // ***** 1. Pre-processor Directives Section *****
 #include "TExaS.h"
 #include "tm4c123gh6pm.h"
+#include "Timer.h"
+#include "Gpio.h"
+#include "Debounce.h"
 
 #define PE0 0x01 //0b 0000 0001
 #define PE1 0x02 //0b 0000 0010
+#define LED    GPIO_PIN(GPIO_PORTE,1)       // bit-band alias of PE1, 0 or 1
 
 // ***** 2. Global Declarations Section *****
 
@@ -33,50 +37,44 @@ void EnableInterrupts(void);  // Enable interrupts
 // Lab8_artist.pdf (compatible with many various readers like Adobe Acrobat).
 
 /* Set PortE pin PE0 as input for switch and PE1 as output for LED.*/ 
+const GpioConfig Board[]={
+	{GPIO_PORTE, PE0, GPIO_IN},       // switch, external pull-down
+	{GPIO_PORTE, PE1, GPIO_OUT}       // LED
+};
+const unsigned long Switches[]={GPIO_PORTE};
 void InitPorts(){
-	volatile unsigned long delay;
-	SYSCTL_RCGC2_R |= 0x10;           	// 1) activate clock for Port E
-	delay = SYSCTL_RCGC2_R;           	// allow time for clock to start
-	
-	GPIO_PORTE_PCTL_R &= ~0x000000FF; 	// 2) Select Alternative digital function : 4 bits for each pin, set PE0 e PE1 as regular GPIO
-  GPIO_PORTE_AMSEL_R &= ~(PE0 | PE1);	// 3) disable analog function on PE0 and PE1
-	
-	GPIO_PORTE_DIR_R &= ~(PE0); 				// 4) set PE0 direction to input
-  GPIO_PORTE_DIR_R |=  (PE1);        	// 5) set PE1 direction to output
-	  
-  GPIO_PORTE_AFSEL_R &= ~(PE0 | PE1); // 6) regular port function
-  GPIO_PORTE_DEN_R |= (PE0 | PE1);   	// 7) enable digital port
+	Gpio_ConfigureAll(Board, sizeof(Board)/sizeof(Board[0]));
+	Debounce_Init(Switches, 1);       // PE0 debounced on the tick
+	Timer_Periodic(Debounce_Sample, DEBOUNCE_MS);
 }
 
-//generates a time*100ms delay
+//generates a time*100ms delay, sleeping on the SysTick tick
 void Delay100ms(unsigned long time){
-  unsigned long i;
-  while(time > 0){
-    i = 1333333;  // this number means 100ms
-    while(i > 0){
-      i = i - 1;
-    }
-    time = time - 1; // decrements every 100 ms
-  }
+  Timer_DelayMs(100*time);
 }
 
+unsigned long LedState;   // PE1 as last written, so no write reads the pin
+
 // Make PE1 high
 void LED_On(void){
-  GPIO_PORTE_DATA_R |= PE1;
+  LedState = 1;
+  LED = LedState;
 }
 
 void LED_Toggle(){
-	GPIO_PORTE_DATA_R ^= PE1;
+	LedState ^= 1;
+	LED = LedState;                   // one store, no read-modify-write
 }
 
 // Make PA2 low
 void LED_Off(void){
-  GPIO_PORTE_DATA_R &= ~PE1;
+  LedState = 0;
+  LED = LedState;
 }
 
-//positive logic means PE0=1 when switch is pressed
+//positive logic means PE0=1 when switch is pressed, debounced
 unsigned long Switch_IsPressed(void){
-  return GPIO_PORTE_DATA_R & PE0; 
+  return Debounce_Levels()&PE0;
 }
 
 
@@ -85,6 +83,7 @@ int main(void){
 // The following version tests input on PE0 and output on PE1
 //**********************************************************************
   TExaS_Init(SW_PIN_PE0, LED_PIN_PE1);  // activate grader and set system clock to 80 MHz
+  Timer_Init();                         // 1 ms SysTick tick at the bus clock
   
 	EnableInterrupts();           // enable interrupts for the grader
 	
@@ -0,0 +1,113 @@
+// EdgeLog.c
+// Runs on LM4F120/TM4C123
+// Edge capture on PF4, PF1 and PF0 into a ring of packed records,
+// see EdgeLog.h.
+
+#include "tm4c123gh6pm.h"
+#include "Timer.h"
+#include "Gpio.h"
+#include "EdgeLog.h"
+#include "..//Lab11_UART/UART.h"
+
+#define LOGMASK (EDGELOG_SIZE-1)
+#if (EDGELOG_SIZE&LOGMASK) || (EDGELOG_SIZE < 2)
+#error "EDGELOG_SIZE must be a power of 2"
+#endif
+
+#define PINS GPIO_PINS(GPIO_PORTF,0x13) // PF4, PF1 and PF0
+
+// In EDGELOG_OVERWRITE the handler never waits for the reader: it writes
+// over the oldest record, and the reader, seeing PutI a whole ring ahead
+// of GetI, skips the records that were or are about to be overwritten.
+// A record overwritten while the reader copied it is caught the same way,
+// by checking PutI again after the copy.  The ring then keeps the latest
+// EDGELOG_SIZE-1 records.
+static volatile unsigned long Log[EDGELOG_SIZE];
+static volatile unsigned long PutI;     // written only by GPIOPortF_Handler
+static volatile unsigned long GetI;     // written only by the main program
+static volatile unsigned long Dropped;  // EDGELOG_STOP: edges with the ring full
+static unsigned long Overwritten;       // EDGELOG_OVERWRITE: records skipped by the reader
+static EdgeLogMode Mode;
+
+//------------EdgeLog_Init------------
+// Empty the ring and arm interrupts on both edges of PF4, PF1 and PF0
+// Port F must already be set up, PF4 and PF0 inputs and PF1 an output
+// Input: mode for a full ring
+// Output: none
+void EdgeLog_Init(EdgeLogMode mode){
+  Mode = mode;
+  PutI = GetI = 0;
+  Dropped = Overwritten = 0;
+  GPIO_PORTF_IM_R &= ~0x13;         // disarm during setup
+  GPIO_PORTF_IS_R &= ~0x13;         // PF4, PF1, PF0 are edge-sensitive
+  GPIO_PORTF_IBE_R |= 0x13;         // on both edges
+  GPIO_PORTF_ICR_R = 0x13;          // clear flags
+  GPIO_PORTF_IM_R |= 0x13;          // arm interrupts on PF4, PF1, PF0
+  NVIC_PRI7_R = (NVIC_PRI7_R&0xFF00FFFF)|0x00400000; // IRQ 30 priority 2
+  NVIC_EN0_R = 1<<30;               // enable IRQ 30 in NVIC
+}
+
+// one record per interrupt: edges on several pins at once, or arriving
+// while the handler runs, share the record of the levels read here
+void GPIOPortF_Handler(void){ unsigned long pins, record;
+  GPIO_PORTF_ICR_R = GPIO_PORTF_RIS_R&0x13; // acknowledge before reading the levels
+  pins = PINS;
+  record = (Timer_Cycles()&0xFFFFFFF8)|((pins>>2)&0x04)|(pins&0x03);
+  if((Mode == EDGELOG_STOP) && ((PutI-GetI) >= EDGELOG_SIZE)){
+    Dropped = Dropped+1;
+    return;
+  }
+  Log[PutI&LOGMASK] = record;
+  PutI = PutI+1;
+}
+
+//------------EdgeLog_Get------------
+// Take the oldest record, capture goes on meanwhile
+// Input: record receives it
+// Output: 1 if a record was taken, 0 if the ring is empty
+int EdgeLog_Get(unsigned long *record){ unsigned long put;
+  do{
+    put = PutI;
+    if((Mode == EDGELOG_OVERWRITE) && ((put-GetI) >= EDGELOG_SIZE)){
+      Overwritten = Overwritten+(put-GetI-EDGELOG_SIZE+1);
+      GetI = put-EDGELOG_SIZE+1;        // the oldest is or will be overwritten next
+    }
+    if(GetI == put){
+      return 0;
+    }
+    *record = Log[GetI&LOGMASK];
+  }while((Mode == EDGELOG_OVERWRITE) && ((PutI-GetI) >= EDGELOG_SIZE)); // overwritten while copied
+  GetI = GetI+1;
+  return 1;
+}
+
+//------------EdgeLog_Lost------------
+// Edges not recorded: dropped when full in EDGELOG_STOP, overwritten
+// before they were taken in EDGELOG_OVERWRITE
+// Input: none
+// Output: count since EdgeLog_Init
+unsigned long EdgeLog_Lost(void){
+  return Dropped+Overwritten;
+}
+
+//------------EdgeLog_Drain------------
+// Send as many records as fit in the UART0 TX FIFO right now, one per
+// line as 8 hex digits, and return without waiting; call it again as the
+// FIFO empties.  UART_Init must have been called.
+// Input: none
+// Output: number of records sent
+unsigned long EdgeLog_Drain(void){ unsigned long record, sent = 0;
+unsigned char line[10];
+int i;
+  while((UART_TxFree() >= sizeof(line)) && EdgeLog_Get(&record)){
+    for(i = 7; i >= 0; i--){
+      line[i] = "0123456789ABCDEF"[record&0x0F];
+      record = record>>4;
+    }
+    line[8] = CR;
+    line[9] = LF;
+    UART_Write(line, sizeof(line));
+    sent++;
+  }
+  return sent;
+}
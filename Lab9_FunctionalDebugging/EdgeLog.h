@@ -0,0 +1,62 @@
+// EdgeLog.h
+// Runs on LM4F120/TM4C123
+// Interrupt-driven capture of every change on PF4, PF1 and PF0.  Both
+// edges of the three pins interrupt (PF1 is an output, its changes come
+// in through the same input path), and GPIOPortF_Handler stores one
+// packed 32-bit record per interrupt into a power-of-2 ring buffer:
+//   bits 31-3 Timer_Cycles() with the low 3 bits dropped, 8 bus cycle
+//             resolution, wraps after 2^32 cycles (268 s at 16 MHz)
+//   bit 2     PF4 (SW1, 0 pressed)
+//   bit 1     PF1 (red LED)
+//   bit 0     PF0 (SW2, 0 pressed)
+// Nothing is sampled, so a change is recorded however short it is, switch
+// bounce included.  The handler is the only writer and the main program
+// the only reader, the free-running indices need no critical sections.
+// Timer_Init must be called first, the timestamps come from its SysTick.
+
+#ifndef __EDGELOG_H__
+#define __EDGELOG_H__
+
+// records in the ring, must be a power of 2
+#ifndef EDGELOG_SIZE
+#define EDGELOG_SIZE 256
+#endif
+
+#define EDGELOG_TIME(record) ((record)&0xFFFFFFF8) // Timer_Cycles, 8 cycle resolution
+#define EDGELOG_PINS(record) ((record)&0x07)       // PF4 in bit 2, PF1 bit 1, PF0 bit 0
+
+// what a full ring does with a new edge
+typedef enum t_EdgeLogMode{
+	EDGELOG_OVERWRITE,                // drop the oldest record, the ring keeps the latest edges
+	EDGELOG_STOP                      // drop the new edge, the ring keeps the first edges
+}EdgeLogMode;
+
+//------------EdgeLog_Init------------
+// Empty the ring and arm interrupts on both edges of PF4, PF1 and PF0
+// Port F must already be set up, PF4 and PF0 inputs and PF1 an output
+// Input: mode for a full ring
+// Output: none
+void EdgeLog_Init(EdgeLogMode mode);
+
+//------------EdgeLog_Get------------
+// Take the oldest record, capture goes on meanwhile
+// Input: record receives it
+// Output: 1 if a record was taken, 0 if the ring is empty
+int EdgeLog_Get(unsigned long *record);
+
+//------------EdgeLog_Lost------------
+// Edges not recorded: dropped when full in EDGELOG_STOP, overwritten
+// before they were taken in EDGELOG_OVERWRITE
+// Input: none
+// Output: count since EdgeLog_Init
+unsigned long EdgeLog_Lost(void);
+
+//------------EdgeLog_Drain------------
+// Send as many records as fit in the UART0 TX FIFO right now, one per
+// line as 8 hex digits, and return without waiting; call it again as the
+// FIFO empties.  UART_Init must have been called.
+// Input: none
+// Output: number of records sent
+unsigned long EdgeLog_Drain(void);
+
+#endif // __EDGELOG_H__
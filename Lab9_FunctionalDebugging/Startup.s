@@ -251,6 +251,23 @@ __Vectors
 ;******************************************************************************
         EXPORT  Reset_Handler
 Reset_Handler
+    IF :DEF: BOOT_BENCH :LAND: BOOT_BENCH
+        ;
+        ; Start the DWT cycle counter from 0 so main can read the cycles
+        ; since reset from DWT_CYCCNT (0xE0001004).  Assemble with
+        ; --pd "BOOT_BENCH SETL {TRUE}"; {FALSE} leaves it out.
+        ;
+        LDR     R0, =0xE000EDFC         ; DEMCR
+        LDR     R1, [R0]
+        ORR     R1, R1, #0x01000000     ; TRCENA, enable the DWT
+        STR     R1, [R0]
+        LDR     R0, =0xE0001000         ; DWT_CTRL
+        MOVS    R1, #0
+        STR     R1, [R0, #4]            ; DWT_CYCCNT
+        LDR     R1, [R0]
+        ORR     R1, R1, #1              ; CYCCNTENA
+        STR     R1, [R0]
+    ENDIF
         ;
         ; DO NOT enable the floating-point unit.  This must be done here to handle the
         ; case where main() uses floating-point and the function prologue saves
@@ -268,6 +285,115 @@ Reset_Handler
 ;        ORR     R1, #0x00F00000
 ;        STR     R1, [R0]
 
+    IF :DEF: FAST_BOOT :LAND: FAST_BOOT
+        ;
+        ; Fast boot, assemble with --pd "FAST_BOOT SETL {TRUE}" and link with
+        ; --datacompressor=off.  The PLL is powered up first, still bypassed,
+        ; so it locks while memory is set up and main starts; the PLL_Init in
+        ; TExaS_Init or Clock_SetFrequency then finds it locked.  These are
+        ; steps 0) to 3) of PLL_Init, 16 MHz crystal.
+        ;
+        LDR     R0, =0x400FE060         ; SYSCTL_RCC_R
+        LDR     R1, [R0, #0x10]         ; SYSCTL_RCC2_R
+        ORR     R1, R1, #0x80000000     ; USERCC2
+        STR     R1, [R0, #0x10]
+        ORR     R1, R1, #0x00000800     ; BYPASS2
+        STR     R1, [R0, #0x10]
+        LDR     R2, [R0]
+        BIC     R2, R2, #0x000007C0     ; clear XTAL field
+        ORR     R2, R2, #0x00000540     ; 16 MHz crystal
+        STR     R2, [R0]
+        BIC     R1, R1, #0x00000070     ; OSCSRC2 main oscillator
+        STR     R1, [R0, #0x10]
+        BIC     R1, R1, #0x00002000     ; clear PWRDN2, the PLL starts to lock
+        STR     R1, [R0, #0x10]
+        ;
+        ; Copy the .data initializers from flash, where they follow the code,
+        ; to SRAM and zero fill .bss: 16 bytes per LDM/STM, then a word at a
+        ; time, then the odd bytes.  Neither length has to be a multiple of 4;
+        ; .data goes byte by byte if either end of the copy is not word
+        ; aligned, .bss is zeroed byte by byte up to its first word boundary.
+        ; This replaces the C library's __main, so the library's own
+        ; initialization (heap, stdio) does not run.
+        ;
+        IMPORT  ||Image$$RO$$Limit||
+        IMPORT  ||Image$$RW$$Base||
+        IMPORT  ||Image$$RW$$Limit||
+        IMPORT  ||Image$$ZI$$Base||
+        IMPORT  ||Image$$ZI$$Limit||
+        LDR     R0, =||Image$$RO$$Limit||
+        LDR     R1, =||Image$$RW$$Base||
+        LDR     R2, =||Image$$RW$$Limit||
+        SUBS    R2, R2, R1              ; bytes of .data
+        BEQ     DataDone
+        ORR     R3, R0, R1
+        TST     R3, #3
+        BNE     DataByte                ; not word aligned, bytes only
+        SUBS    R2, R2, #16
+        BLO     DataWords
+DataBlock
+        LDM     R0!, {R3-R6}
+        STM     R1!, {R3-R6}
+        SUBS    R2, R2, #16
+        BHS     DataBlock
+DataWords
+        ADDS    R2, R2, #12             ; R2 = bytes left-4
+        BLO     DataTail
+DataWord
+        LDR     R3, [R0], #4
+        STR     R3, [R1], #4
+        SUBS    R2, R2, #4
+        BHS     DataWord
+DataTail
+        ADDS    R2, R2, #4              ; R2 = bytes left, 0 to 3
+        BEQ     DataDone
+DataByte
+        LDRB    R3, [R0], #1
+        STRB    R3, [R1], #1
+        SUBS    R2, R2, #1
+        BNE     DataByte
+DataDone
+        LDR     R1, =||Image$$ZI$$Base||
+        LDR     R2, =||Image$$ZI$$Limit||
+        SUBS    R2, R2, R1              ; bytes of .bss, stack included
+        BEQ     ZeroDone
+        MOVS    R3, #0
+        MOVS    R4, #0
+        MOVS    R5, #0
+        MOVS    R6, #0
+ZeroHead
+        TST     R1, #3
+        BEQ     ZeroAligned
+        STRB    R3, [R1], #1
+        SUBS    R2, R2, #1
+        BNE     ZeroHead
+        B       ZeroDone
+ZeroAligned
+        SUBS    R2, R2, #16
+        BLO     ZeroWords
+ZeroBlock
+        STM     R1!, {R3-R6}
+        SUBS    R2, R2, #16
+        BHS     ZeroBlock
+ZeroWords
+        ADDS    R2, R2, #12             ; R2 = bytes left-4
+        BLO     ZeroTail
+ZeroWord
+        STR     R3, [R1], #4
+        SUBS    R2, R2, #4
+        BHS     ZeroWord
+ZeroTail
+        ADDS    R2, R2, #4              ; R2 = bytes left, 0 to 3
+        BEQ     ZeroDone
+ZeroByte
+        STRB    R3, [R1], #1
+        SUBS    R2, R2, #1
+        BNE     ZeroByte
+ZeroDone
+        IMPORT  main
+        BL      main
+        B       .                       ; main does not return
+    ELSE
         ;
         ; Call the C library enty point that handles startup.  This will copy
         ; the .data section initializers from flash to SRAM and zero fill the
@@ -275,6 +401,7 @@ Reset_Handler
         ;
         IMPORT  __main
         B       __main
+    ENDIF
 
 ;******************************************************************************
 ;
@@ -4,6 +4,12 @@
 // In this lab we are learning functional debugging by dumping
 //   recorded I/O data into a buffer
 // February 21, 2014
+// Every change of PF4, PF1 and PF0 is captured by EdgeLog with its time
+// and streamed out on UART0 while the program runs, one record per line
+// in hex (see EdgeLog.h for the layout), at 115200 baud: UART_Init
+// takes its divisors from the bus clock, 16 MHz in Lab 9.
+// The program acts on the switches through Debounce; EdgeLog keeps the
+// raw edges, bounce included.
 
 // Lab 9
 //      Jon Valvano and Ramesh Yerraballi
@@ -11,6 +17,11 @@
 // ***** 1. Pre-processor Directives Section *****
 #include "TExaS.h"
 #include "tm4c123gh6pm.h"
+#include "Timer.h"
+#include "Gpio.h"
+#include "EdgeLog.h"
+#include "Debounce.h"
+#include "..//Lab11_UART/UART.h"
 
 // ***** 2. Global Declarations Section *****
 
@@ -42,33 +53,31 @@ Information collected in the Data array matches the I/O on PortF.
 */
 
 
-void PortF_Init(void){ volatile unsigned long delay;
-  SYSCTL_RCGC2_R |= 0x00000020;     // 1) activate clock for Port F
-  delay = SYSCTL_RCGC2_R;           // allow time for clock to start
-  GPIO_PORTF_LOCK_R = 0x4C4F434B;   // 2) unlock GPIO Port F
-  GPIO_PORTF_CR_R = 0x1F;           // allow changes to PF4-0
-  // only PF0 needs to be unlocked, other bits can't be locked
-  GPIO_PORTF_AMSEL_R = 0x00;        // 3) disable analog on PF
-  GPIO_PORTF_PCTL_R = 0x00000000;   // 4) PCTL GPIO on PF4-0
-  GPIO_PORTF_DIR_R = 0x0E;          // 5) PF4,PF0 in, PF3-1 out
-  GPIO_PORTF_AFSEL_R = 0x00;        // 6) disable alt funct on PF7-0
-  GPIO_PORTF_PUR_R = 0x11;          // enable pull-up on PF0 and PF4
-  GPIO_PORTF_DEN_R = 0x1F;          // 7) enable digital I/O on PF4-0
+const GpioConfig Board[]={
+  {GPIO_PORTF, 0x11, GPIO_PULLUP},  // PF4 and PF0 in, pull-ups
+  {GPIO_PORTF, 0x0E, GPIO_OUT}      // PF3-1 out
+};
+void PortF_Init(void){
+  Gpio_ConfigureAll(Board, sizeof(Board)/sizeof(Board[0]));
 }
-
-// Initialize SysTick with busy wait running at bus clock.
-void SysTick_Init(void){
-  NVIC_ST_CTRL_R = 0;                   // disable SysTick during setup
-  NVIC_ST_RELOAD_R = 0x00FFFFFF;        // maximum reload value
-  NVIC_ST_CURRENT_R = 0;                // any write to current clears it             
-  NVIC_ST_CTRL_R = 0x00000005;          // enable SysTick with core clock
+const unsigned long Switches[]={GPIO_PORTF};
+// debounced PF4 and PF0 with the PF1 output
+unsigned long PortF_Read(void){
+  return (Debounce_Levels()&0x11)|GPIO_PINS(GPIO_PORTF,0x02);
 }
+
 unsigned long Led;
-void Delay(void){
-	unsigned long volatile time;
-  time = 160000/2; // 0.1sec/2 = 0.05sec
-  while(time){
-   time--;
+// 0.1sec/2 = 0.05sec, streaming the edge log meanwhile: the CPU sleeps
+// until the next SysTick or UART interrupt, then tops up the UART
+void Delay(void){ unsigned long deadline = Timer_Deadline(50);
+  while(1){
+    EdgeLog_Drain();
+    DisableInterrupts();          // no interrupt between the check and the sleep
+    if(Timer_Expired(deadline)){
+      EnableInterrupts();
+      return;
+    }
+    Timer_Sleep();                // returns with interrupts enabled
   }
 }
 
@@ -88,23 +97,24 @@ void LedToggle(void){
 	dataNow ^= 0x02;
 }
 
-// first data point is wrong, the other 49 will be correct
-unsigned long Time[50];
 // you must leave the Data array defined exactly as it is
+// (the grader reads it; the times and every edge are in the EdgeLog)
 unsigned long Data[50];
 int main(void){  
-	unsigned long i,last,now,dataLast, dataIndex;
+	unsigned long dataLast, dataIndex;
   TExaS_Init(SW_PIN_PF40, LED_PIN_PF1);  // activate grader and set system clock to 16 MHz
   PortF_Init();   // initialize PF1 to output
-  SysTick_Init(); // initialize SysTick, runs at 16 MHz
-  i = 0;          // array index
-  last = NVIC_ST_CURRENT_R;
+  Timer_Init();         // SysTick tick at the bus clock, 16 MHz here
+  UART_Init();
+  EdgeLog_Init(EDGELOG_OVERWRITE); // keep the latest edges if the UART falls behind
+  Debounce_Init(Switches, 1);   // PF4 and PF0 debounced on the tick
+  Timer_Periodic(Debounce_Sample, DEBOUNCE_MS);
 	
 	dataIndex=0;
-  dataLast = GPIO_PORTF_DATA_R;
+  dataLast = PortF_Read();
 	EnableInterrupts();           // enable interrupts for the grader
   while(1){
-		dataNow = GPIO_PORTF_DATA_R;
+		dataNow = PortF_Read();
 		if(ShouldFlashLed()){
 			LedToggle();
 		}else{
@@ -114,7 +124,7 @@ int main(void){
 		
 		if(dataLast != dataNow)
 		{
-			GPIO_PORTF_DATA_R = dataNow;
+			GPIO_PINS(GPIO_PORTF,0x02) = dataNow; // PF1 only, the inputs are left alone
 			dataLast = dataNow;
 			if(dataIndex<50){
 				Data[dataIndex] = dataNow;
@@ -122,13 +132,6 @@ int main(void){
 			}
 		}
 		
-    if(i<50){
-      now = NVIC_ST_CURRENT_R;
-      Time[i] = (last-now)&0x00FFFFFF;  // 24-bit time difference
-      //Data[i] = GPIO_PORTF_DATA_R&0x02; // record PF1
-      last = now;
-      i++;
-    }
     Delay();
   }
 }
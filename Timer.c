@@ -0,0 +1,199 @@
+// Timer.c
+// Runs on TM4C123 or LM4F120
+// Shared timing service for the labs, see Timer.h.
+// SysTick reloads every 1 ms of bus clock, rounded to the nearest cycle
+// as ClockPlan.c assumes, and SysTick_Handler counts the ticks; the
+// cycle count in between comes from NVIC_ST_CURRENT_R.
+// A clock change restarts the tick at the new Period: the tick in
+// progress ends at once, so a tick deadline can come up to 1 ms early;
+// Timer_Cycles goes on from the count it had, in cycles of the new clock.
+
+#include "tm4c123gh6pm.h"
+#include "Timer.h"
+#include "Clock.h"
+
+void DisableInterrupts(void); // Disable interrupts
+void EnableInterrupts(void);  // Enable interrupts
+void WaitForInterrupt(void);  // low power mode, in startup.s
+long StartCritical(void);     // previous I bit, disable interrupts
+void EndCritical(long sr);    // restore I bit to previous value
+
+static volatile unsigned long Ticks;    // ms since Timer_Init
+static unsigned long Period;            // bus cycles per tick
+static unsigned long BusHz;             // bus clock the tick was started at
+static unsigned long Asleep;            // cycles in Timer_Sleep since the last Timer_Usage
+static unsigned long UsageStart;        // Timer_Cycles at the last Timer_Usage
+static unsigned long CycleBase;         // Timer_Cycles at the last clock change
+static unsigned long TickBase;          // Ticks at the last clock change
+static void (*volatile Task)(void);     // Timer_Periodic task, 0 for none
+static unsigned long TaskPeriod;        // ticks between its runs
+static unsigned long TaskLeft;          // ticks to its next run
+
+static void start(unsigned long busFrequency){
+  Period = (busFrequency+TIMER_TICKHZ/2)/TIMER_TICKHZ;
+  BusHz = busFrequency;
+  NVIC_ST_CTRL_R = 0;                   // disable SysTick during setup
+  NVIC_ST_RELOAD_R = Period-1;          // interrupt every Period cycles
+  NVIC_ST_CURRENT_R = 0;                // any write to current clears it
+  NVIC_ST_CTRL_R = 0x00000007;          // enable SysTick with core clock and interrupts
+}
+
+// Clock_SetFrequency calls these with interrupts disabled
+static void clockBefore(unsigned long hz){
+  (void)hz;                             // the old Period still applies
+  CycleBase = Timer_Cycles();
+}
+static void clockAfter(unsigned long hz){
+  if(NVIC_INT_CTRL_R&NVIC_INT_CTRL_PENDSTSET){ // a tick of the old Period came in meanwhile,
+    NVIC_INT_CTRL_R = NVIC_INT_CTRL_PENDSTCLR; // count it here, CycleBase has it already
+    Ticks = Ticks+1;
+  }
+  TickBase = Ticks;
+  start(hz);
+}
+
+//------------Timer_Init------------
+// Start the 1 ms SysTick tick at the current bus clock, interrupts must
+// be enabled for it to count; the period follows Clock_SetFrequency
+// Input: none
+// Output: none
+void Timer_Init(void){
+  Ticks = 0;
+  Asleep = UsageStart = 0;
+  CycleBase = TickBase = 0;
+  Task = 0;
+  NVIC_SYS_PRI3_R = (NVIC_SYS_PRI3_R&0x00FFFFFF)|0x20000000; // priority 1
+  start(Clock_Frequency());
+  Clock_Register(clockBefore, clockAfter);
+}
+
+void SysTick_Handler(void){
+  Ticks = Ticks+1;
+  if(Task){
+    TaskLeft = TaskLeft-1;
+    if(TaskLeft == 0){
+      TaskLeft = TaskPeriod;
+      Task();
+    }
+  }
+}
+
+//------------Timer_Periodic------------
+// Run a task from SysTick_Handler every ms ticks, replacing the task set
+// before; it runs in the handler, so it must be short
+// Input: task to run, 0 for none, ms between runs, at least 1
+// Output: none
+void Timer_Periodic(void (*task)(void), unsigned long ms){
+long sr = StartCritical();              // no tick with a half-set task
+  if(ms == 0){
+    ms = 1;
+  }
+  TaskPeriod = TaskLeft = ms;
+  Task = task;
+  EndCritical(sr);                      // callable before interrupts are enabled
+}
+
+//------------Timer_Now------------
+// Milliseconds since Timer_Init, wraps after 49.7 days
+// Input: none
+// Output: tick count
+unsigned long Timer_Now(void){
+  return Ticks;
+}
+
+//------------Timer_Cycles------------
+// Bus cycles since Timer_Init, for measuring short intervals;
+// subtract two readings, wraps after 2^32 cycles (53.7 s at 80 MHz)
+// Input: none
+// Output: cycle count
+unsigned long Timer_Cycles(void){ unsigned long ticks, current, pending;
+  do{                                   // read again if a tick came in between
+    ticks = Ticks;
+    current = NVIC_ST_CURRENT_R&0x00FFFFFF;
+    pending = NVIC_INT_CTRL_R&NVIC_INT_CTRL_PENDSTSET;
+  }while(ticks != Ticks);
+  if(pending && (current > Period/2)){  // wrapped, but interrupts are disabled
+    ticks = ticks+1;                    // so SysTick_Handler has not counted it
+  }
+  return CycleBase+(ticks-TickBase)*Period+(Period-1-current);
+}
+
+//------------Timer_Deadline------------
+// Deadline for Timer_Expired
+// Input: ms from now, at most 2^31-1
+// Output: tick at which the deadline passes
+unsigned long Timer_Deadline(unsigned long ms){
+  return Ticks+ms;
+}
+
+//------------Timer_Expired------------
+// Check a deadline without waiting
+// Input: deadline from Timer_Deadline
+// Output: 1 if the deadline has passed, 0 if not
+int Timer_Expired(unsigned long deadline){
+  return (long)(Ticks-deadline) >= 0;   // signed difference survives the wrap
+}
+
+//------------Timer_Sleep------------
+// Sleep (WFI) until the next interrupt and count the cycles asleep
+// Call with interrupts disabled, after checking there is nothing to do,
+// so an interrupt arriving after the check still ends the sleep
+// Input: none
+// Output: none, returns with interrupts enabled after the handler ran
+void Timer_Sleep(void){ unsigned long start = Timer_Cycles();
+  WaitForInterrupt();                   // wakes on a pending interrupt even with I=1
+  Asleep = Asleep+(Timer_Cycles()-start);
+  EnableInterrupts();                   // the handler runs now
+}
+
+//------------Timer_Usage------------
+// Cycles spent asleep and awake since Timer_Init or the last call,
+// call at least every 2^32 cycles (53.7 s at 80 MHz)
+// Input: asleep and awake receive the counts
+// Output: none
+void Timer_Usage(unsigned long *asleep, unsigned long *awake){ unsigned long now, slept;
+long sr = StartCritical();              // no tick between the reads
+  now = Timer_Cycles();
+  slept = Asleep;
+  Asleep = 0;
+  EndCritical(sr);                      // callable with interrupts off
+  *asleep = slept;
+  *awake = (now-UsageStart)-slept;
+  UsageStart = now;
+}
+
+// wait for cycles bus cycles, sleeping while a whole tick is left
+static void delayCycles(unsigned long cycles){ unsigned long start = Timer_Cycles();
+  while(1){
+    DisableInterrupts();                // no tick between the check and the sleep
+    if((Timer_Cycles()-start)+Period > cycles){
+      break;
+    }
+    Timer_Sleep();                      // the next tick comes before the end
+  }
+  EnableInterrupts();
+  while((Timer_Cycles()-start) < cycles){
+  }
+}
+
+//------------Timer_DelayMs------------
+// Wait, sleeping between ticks
+// Input: ms to wait
+// Output: none
+void Timer_DelayMs(unsigned long ms){
+  while(ms > 1000){                     // keep each wait far from the 32-bit wrap
+    delayCycles(1000*Period);
+    ms = ms-1000;
+  }
+  delayCycles(ms*Period);
+}
+
+//------------Timer_DelayUs------------
+// Wait by counting bus cycles, for delays shorter than a tick
+// Input: us to wait, at most 1000000
+// Output: none
+void Timer_DelayUs(unsigned long us){ unsigned long start = Timer_Cycles();
+unsigned long cycles = ((unsigned long long)us*BusHz+999999)/1000000; // rounded up, never short
+  while((Timer_Cycles()-start) < cycles){
+  }
+}
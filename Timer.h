@@ -0,0 +1,86 @@
+// Timer.h
+// Runs on TM4C123 or LM4F120
+// Shared timing service for the labs.  SysTick interrupts once per
+// millisecond and counts a free-running tick; delays and deadlines are
+// computed from it, so they stay right at any bus clock and the CPU
+// sleeps (WFI) while it waits.  Every wait goes through Timer_Sleep,
+// which keeps count of the cycles spent asleep and awake.
+// The timer owns SysTick: a lab using it must not program SysTick itself.
+// The tick follows Clock_SetFrequency (Clock.c must be in the project);
+// change the clock from the main program, not during a delay.
+// Interrupts must be enabled, except around Timer_Sleep.
+// One periodic task, e.g. Debounce_Sample, can run from the tick.
+
+#ifndef __TIMER_H__
+#define __TIMER_H__
+
+// SysTick interrupts per second
+#define TIMER_TICKHZ 1000
+
+//------------Timer_Init------------
+// Start the 1 ms SysTick tick at the current bus clock, interrupts must
+// be enabled for it to count; the period follows Clock_SetFrequency
+// Input: none
+// Output: none
+void Timer_Init(void);
+
+//------------Timer_Periodic------------
+// Run a task from SysTick_Handler every ms ticks, replacing the task set
+// before; it runs in the handler, so it must be short
+// Input: task to run, 0 for none, ms between runs, at least 1
+// Output: none
+void Timer_Periodic(void (*task)(void), unsigned long ms);
+
+//------------Timer_Now------------
+// Milliseconds since Timer_Init, wraps after 49.7 days
+// Input: none
+// Output: tick count
+unsigned long Timer_Now(void);
+
+//------------Timer_Cycles------------
+// Bus cycles since Timer_Init, for measuring short intervals;
+// subtract two readings, wraps after 2^32 cycles (53.7 s at 80 MHz)
+// Input: none
+// Output: cycle count
+unsigned long Timer_Cycles(void);
+
+//------------Timer_Deadline------------
+// Deadline for Timer_Expired
+// Input: ms from now, at most 2^31-1
+// Output: tick at which the deadline passes
+unsigned long Timer_Deadline(unsigned long ms);
+
+//------------Timer_Expired------------
+// Check a deadline without waiting
+// Input: deadline from Timer_Deadline
+// Output: 1 if the deadline has passed, 0 if not
+int Timer_Expired(unsigned long deadline);
+
+//------------Timer_Sleep------------
+// Sleep (WFI) until the next interrupt and count the cycles asleep
+// Call with interrupts disabled, after checking there is nothing to do,
+// so an interrupt arriving after the check still ends the sleep
+// Input: none
+// Output: none, returns with interrupts enabled after the handler ran
+void Timer_Sleep(void);
+
+//------------Timer_Usage------------
+// Cycles spent asleep and awake since Timer_Init or the last call,
+// call at least every 2^32 cycles (53.7 s at 80 MHz)
+// Input: asleep and awake receive the counts
+// Output: none
+void Timer_Usage(unsigned long *asleep, unsigned long *awake);
+
+//------------Timer_DelayMs------------
+// Wait, sleeping between ticks
+// Input: ms to wait
+// Output: none
+void Timer_DelayMs(unsigned long ms);
+
+//------------Timer_DelayUs------------
+// Wait by counting bus cycles, for delays shorter than a tick
+// Input: us to wait, at most 1000000
+// Output: none
+void Timer_DelayUs(unsigned long us);
+
+#endif // __TIMER_H__
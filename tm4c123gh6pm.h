@@ -40,6 +40,21 @@
 #ifndef __TM4C123GH6PM_H__
 #define __TM4C123GH6PM_H__
 
+//*****************************************************************************
+//
+// Register access.  On the target HWREG is a plain volatile dereference.
+// When built with HOST_EMULATION defined the same register names resolve
+// to the peripheral models in Emulator/, so a lab can run on Linux.
+// The *_DATA_BITS_R arrays and the USB byte/half-word registers below are
+// raw pointers and are not emulated.
+//
+//*****************************************************************************
+#ifdef HOST_EMULATION
+#include "Emulator/Emulator.h"
+#else
+#define HWREG(x)                (*((volatile unsigned long *)(x)))
+#endif
+
 //*****************************************************************************
 //
 // Interrupt assignments
@@ -130,28 +145,28 @@
 // Watchdog Timer registers (WATCHDOG0)
 //
 //*****************************************************************************
-#define WATCHDOG0_LOAD_R        (*((volatile unsigned long *)0x40000000))
-#define WATCHDOG0_VALUE_R       (*((volatile unsigned long *)0x40000004))
-#define WATCHDOG0_CTL_R         (*((volatile unsigned long *)0x40000008))
-#define WATCHDOG0_ICR_R         (*((volatile unsigned long *)0x4000000C))
-#define WATCHDOG0_RIS_R         (*((volatile unsigned long *)0x40000010))
-#define WATCHDOG0_MIS_R         (*((volatile unsigned long *)0x40000014))
-#define WATCHDOG0_TEST_R        (*((volatile unsigned long *)0x40000418))
-#define WATCHDOG0_LOCK_R        (*((volatile unsigned long *)0x40000C00))
+#define WATCHDOG0_LOAD_R        HWREG(0x40000000)
+#define WATCHDOG0_VALUE_R       HWREG(0x40000004)
+#define WATCHDOG0_CTL_R         HWREG(0x40000008)
+#define WATCHDOG0_ICR_R         HWREG(0x4000000C)
+#define WATCHDOG0_RIS_R         HWREG(0x40000010)
+#define WATCHDOG0_MIS_R         HWREG(0x40000014)
+#define WATCHDOG0_TEST_R        HWREG(0x40000418)
+#define WATCHDOG0_LOCK_R        HWREG(0x40000C00)
 
 //*****************************************************************************
 //
 // Watchdog Timer registers (WATCHDOG1)
 //
 //*****************************************************************************
-#define WATCHDOG1_LOAD_R        (*((volatile unsigned long *)0x40001000))
-#define WATCHDOG1_VALUE_R       (*((volatile unsigned long *)0x40001004))
-#define WATCHDOG1_CTL_R         (*((volatile unsigned long *)0x40001008))
-#define WATCHDOG1_ICR_R         (*((volatile unsigned long *)0x4000100C))
-#define WATCHDOG1_RIS_R         (*((volatile unsigned long *)0x40001010))
-#define WATCHDOG1_MIS_R         (*((volatile unsigned long *)0x40001014))
-#define WATCHDOG1_TEST_R        (*((volatile unsigned long *)0x40001418))
-#define WATCHDOG1_LOCK_R        (*((volatile unsigned long *)0x40001C00))
+#define WATCHDOG1_LOAD_R        HWREG(0x40001000)
+#define WATCHDOG1_VALUE_R       HWREG(0x40001004)
+#define WATCHDOG1_CTL_R         HWREG(0x40001008)
+#define WATCHDOG1_ICR_R         HWREG(0x4000100C)
+#define WATCHDOG1_RIS_R         HWREG(0x40001010)
+#define WATCHDOG1_MIS_R         HWREG(0x40001014)
+#define WATCHDOG1_TEST_R        HWREG(0x40001418)
+#define WATCHDOG1_LOCK_R        HWREG(0x40001C00)
 
 //*****************************************************************************
 //
@@ -159,30 +174,30 @@
 //
 //*****************************************************************************
 #define GPIO_PORTA_DATA_BITS_R  ((volatile unsigned long *)0x40004000)
-#define GPIO_PORTA_DATA_R       (*((volatile unsigned long *)0x400043FC))
-#define GPIO_PORTA_DIR_R        (*((volatile unsigned long *)0x40004400))
-#define GPIO_PORTA_IS_R         (*((volatile unsigned long *)0x40004404))
-#define GPIO_PORTA_IBE_R        (*((volatile unsigned long *)0x40004408))
-#define GPIO_PORTA_IEV_R        (*((volatile unsigned long *)0x4000440C))
-#define GPIO_PORTA_IM_R         (*((volatile unsigned long *)0x40004410))
-#define GPIO_PORTA_RIS_R        (*((volatile unsigned long *)0x40004414))
-#define GPIO_PORTA_MIS_R        (*((volatile unsigned long *)0x40004418))
-#define GPIO_PORTA_ICR_R        (*((volatile unsigned long *)0x4000441C))
-#define GPIO_PORTA_AFSEL_R      (*((volatile unsigned long *)0x40004420))
-#define GPIO_PORTA_DR2R_R       (*((volatile unsigned long *)0x40004500))
-#define GPIO_PORTA_DR4R_R       (*((volatile unsigned long *)0x40004504))
-#define GPIO_PORTA_DR8R_R       (*((volatile unsigned long *)0x40004508))
-#define GPIO_PORTA_ODR_R        (*((volatile unsigned long *)0x4000450C))
-#define GPIO_PORTA_PUR_R        (*((volatile unsigned long *)0x40004510))
-#define GPIO_PORTA_PDR_R        (*((volatile unsigned long *)0x40004514))
-#define GPIO_PORTA_SLR_R        (*((volatile unsigned long *)0x40004518))
-#define GPIO_PORTA_DEN_R        (*((volatile unsigned long *)0x4000451C))
-#define GPIO_PORTA_LOCK_R       (*((volatile unsigned long *)0x40004520))
-#define GPIO_PORTA_CR_R         (*((volatile unsigned long *)0x40004524))
-#define GPIO_PORTA_AMSEL_R      (*((volatile unsigned long *)0x40004528))
-#define GPIO_PORTA_PCTL_R       (*((volatile unsigned long *)0x4000452C))
-#define GPIO_PORTA_ADCCTL_R     (*((volatile unsigned long *)0x40004530))
-#define GPIO_PORTA_DMACTL_R     (*((volatile unsigned long *)0x40004534))
+#define GPIO_PORTA_DATA_R       HWREG(0x400043FC)
+#define GPIO_PORTA_DIR_R        HWREG(0x40004400)
+#define GPIO_PORTA_IS_R         HWREG(0x40004404)
+#define GPIO_PORTA_IBE_R        HWREG(0x40004408)
+#define GPIO_PORTA_IEV_R        HWREG(0x4000440C)
+#define GPIO_PORTA_IM_R         HWREG(0x40004410)
+#define GPIO_PORTA_RIS_R        HWREG(0x40004414)
+#define GPIO_PORTA_MIS_R        HWREG(0x40004418)
+#define GPIO_PORTA_ICR_R        HWREG(0x4000441C)
+#define GPIO_PORTA_AFSEL_R      HWREG(0x40004420)
+#define GPIO_PORTA_DR2R_R       HWREG(0x40004500)
+#define GPIO_PORTA_DR4R_R       HWREG(0x40004504)
+#define GPIO_PORTA_DR8R_R       HWREG(0x40004508)
+#define GPIO_PORTA_ODR_R        HWREG(0x4000450C)
+#define GPIO_PORTA_PUR_R        HWREG(0x40004510)
+#define GPIO_PORTA_PDR_R        HWREG(0x40004514)
+#define GPIO_PORTA_SLR_R        HWREG(0x40004518)
+#define GPIO_PORTA_DEN_R        HWREG(0x4000451C)
+#define GPIO_PORTA_LOCK_R       HWREG(0x40004520)
+#define GPIO_PORTA_CR_R         HWREG(0x40004524)
+#define GPIO_PORTA_AMSEL_R      HWREG(0x40004528)
+#define GPIO_PORTA_PCTL_R       HWREG(0x4000452C)
+#define GPIO_PORTA_ADCCTL_R     HWREG(0x40004530)
+#define GPIO_PORTA_DMACTL_R     HWREG(0x40004534)
 
 //*****************************************************************************
 //
@@ -190,30 +205,30 @@
 //
 //*****************************************************************************
 #define GPIO_PORTB_DATA_BITS_R  ((volatile unsigned long *)0x40005000)
-#define GPIO_PORTB_DATA_R       (*((volatile unsigned long *)0x400053FC))
-#define GPIO_PORTB_DIR_R        (*((volatile unsigned long *)0x40005400))
-#define GPIO_PORTB_IS_R         (*((volatile unsigned long *)0x40005404))
-#define GPIO_PORTB_IBE_R        (*((volatile unsigned long *)0x40005408))
-#define GPIO_PORTB_IEV_R        (*((volatile unsigned long *)0x4000540C))
-#define GPIO_PORTB_IM_R         (*((volatile unsigned long *)0x40005410))
-#define GPIO_PORTB_RIS_R        (*((volatile unsigned long *)0x40005414))
-#define GPIO_PORTB_MIS_R        (*((volatile unsigned long *)0x40005418))
-#define GPIO_PORTB_ICR_R        (*((volatile unsigned long *)0x4000541C))
-#define GPIO_PORTB_AFSEL_R      (*((volatile unsigned long *)0x40005420))
-#define GPIO_PORTB_DR2R_R       (*((volatile unsigned long *)0x40005500))
-#define GPIO_PORTB_DR4R_R       (*((volatile unsigned long *)0x40005504))
-#define GPIO_PORTB_DR8R_R       (*((volatile unsigned long *)0x40005508))
-#define GPIO_PORTB_ODR_R        (*((volatile unsigned long *)0x4000550C))
-#define GPIO_PORTB_PUR_R        (*((volatile unsigned long *)0x40005510))
-#define GPIO_PORTB_PDR_R        (*((volatile unsigned long *)0x40005514))
-#define GPIO_PORTB_SLR_R        (*((volatile unsigned long *)0x40005518))
-#define GPIO_PORTB_DEN_R        (*((volatile unsigned long *)0x4000551C))
-#define GPIO_PORTB_LOCK_R       (*((volatile unsigned long *)0x40005520))
-#define GPIO_PORTB_CR_R         (*((volatile unsigned long *)0x40005524))
-#define GPIO_PORTB_AMSEL_R      (*((volatile unsigned long *)0x40005528))
-#define GPIO_PORTB_PCTL_R       (*((volatile unsigned long *)0x4000552C))
-#define GPIO_PORTB_ADCCTL_R     (*((volatile unsigned long *)0x40005530))
-#define GPIO_PORTB_DMACTL_R     (*((volatile unsigned long *)0x40005534))
+#define GPIO_PORTB_DATA_R       HWREG(0x400053FC)
+#define GPIO_PORTB_DIR_R        HWREG(0x40005400)
+#define GPIO_PORTB_IS_R         HWREG(0x40005404)
+#define GPIO_PORTB_IBE_R        HWREG(0x40005408)
+#define GPIO_PORTB_IEV_R        HWREG(0x4000540C)
+#define GPIO_PORTB_IM_R         HWREG(0x40005410)
+#define GPIO_PORTB_RIS_R        HWREG(0x40005414)
+#define GPIO_PORTB_MIS_R        HWREG(0x40005418)
+#define GPIO_PORTB_ICR_R        HWREG(0x4000541C)
+#define GPIO_PORTB_AFSEL_R      HWREG(0x40005420)
+#define GPIO_PORTB_DR2R_R       HWREG(0x40005500)
+#define GPIO_PORTB_DR4R_R       HWREG(0x40005504)
+#define GPIO_PORTB_DR8R_R       HWREG(0x40005508)
+#define GPIO_PORTB_ODR_R        HWREG(0x4000550C)
+#define GPIO_PORTB_PUR_R        HWREG(0x40005510)
+#define GPIO_PORTB_PDR_R        HWREG(0x40005514)
+#define GPIO_PORTB_SLR_R        HWREG(0x40005518)
+#define GPIO_PORTB_DEN_R        HWREG(0x4000551C)
+#define GPIO_PORTB_LOCK_R       HWREG(0x40005520)
+#define GPIO_PORTB_CR_R         HWREG(0x40005524)
+#define GPIO_PORTB_AMSEL_R      HWREG(0x40005528)
+#define GPIO_PORTB_PCTL_R       HWREG(0x4000552C)
+#define GPIO_PORTB_ADCCTL_R     HWREG(0x40005530)
+#define GPIO_PORTB_DMACTL_R     HWREG(0x40005534)
 
 //*****************************************************************************
 //
@@ -221,30 +236,30 @@
 //
 //*****************************************************************************
 #define GPIO_PORTC_DATA_BITS_R  ((volatile unsigned long *)0x40006000)
-#define GPIO_PORTC_DATA_R       (*((volatile unsigned long *)0x400063FC))
-#define GPIO_PORTC_DIR_R        (*((volatile unsigned long *)0x40006400))
-#define GPIO_PORTC_IS_R         (*((volatile unsigned long *)0x40006404))
-#define GPIO_PORTC_IBE_R        (*((volatile unsigned long *)0x40006408))
-#define GPIO_PORTC_IEV_R        (*((volatile unsigned long *)0x4000640C))
-#define GPIO_PORTC_IM_R         (*((volatile unsigned long *)0x40006410))
-#define GPIO_PORTC_RIS_R        (*((volatile unsigned long *)0x40006414))
-#define GPIO_PORTC_MIS_R        (*((volatile unsigned long *)0x40006418))
-#define GPIO_PORTC_ICR_R        (*((volatile unsigned long *)0x4000641C))
-#define GPIO_PORTC_AFSEL_R      (*((volatile unsigned long *)0x40006420))
-#define GPIO_PORTC_DR2R_R       (*((volatile unsigned long *)0x40006500))
-#define GPIO_PORTC_DR4R_R       (*((volatile unsigned long *)0x40006504))
-#define GPIO_PORTC_DR8R_R       (*((volatile unsigned long *)0x40006508))
-#define GPIO_PORTC_ODR_R        (*((volatile unsigned long *)0x4000650C))
-#define GPIO_PORTC_PUR_R        (*((volatile unsigned long *)0x40006510))
-#define GPIO_PORTC_PDR_R        (*((volatile unsigned long *)0x40006514))
-#define GPIO_PORTC_SLR_R        (*((volatile unsigned long *)0x40006518))
-#define GPIO_PORTC_DEN_R        (*((volatile unsigned long *)0x4000651C))
-#define GPIO_PORTC_LOCK_R       (*((volatile unsigned long *)0x40006520))
-#define GPIO_PORTC_CR_R         (*((volatile unsigned long *)0x40006524))
-#define GPIO_PORTC_AMSEL_R      (*((volatile unsigned long *)0x40006528))
-#define GPIO_PORTC_PCTL_R       (*((volatile unsigned long *)0x4000652C))
-#define GPIO_PORTC_ADCCTL_R     (*((volatile unsigned long *)0x40006530))
-#define GPIO_PORTC_DMACTL_R     (*((volatile unsigned long *)0x40006534))
+#define GPIO_PORTC_DATA_R       HWREG(0x400063FC)
+#define GPIO_PORTC_DIR_R        HWREG(0x40006400)
+#define GPIO_PORTC_IS_R         HWREG(0x40006404)
+#define GPIO_PORTC_IBE_R        HWREG(0x40006408)
+#define GPIO_PORTC_IEV_R        HWREG(0x4000640C)
+#define GPIO_PORTC_IM_R         HWREG(0x40006410)
+#define GPIO_PORTC_RIS_R        HWREG(0x40006414)
+#define GPIO_PORTC_MIS_R        HWREG(0x40006418)
+#define GPIO_PORTC_ICR_R        HWREG(0x4000641C)
+#define GPIO_PORTC_AFSEL_R      HWREG(0x40006420)
+#define GPIO_PORTC_DR2R_R       HWREG(0x40006500)
+#define GPIO_PORTC_DR4R_R       HWREG(0x40006504)
+#define GPIO_PORTC_DR8R_R       HWREG(0x40006508)
+#define GPIO_PORTC_ODR_R        HWREG(0x4000650C)
+#define GPIO_PORTC_PUR_R        HWREG(0x40006510)
+#define GPIO_PORTC_PDR_R        HWREG(0x40006514)
+#define GPIO_PORTC_SLR_R        HWREG(0x40006518)
+#define GPIO_PORTC_DEN_R        HWREG(0x4000651C)
+#define GPIO_PORTC_LOCK_R       HWREG(0x40006520)
+#define GPIO_PORTC_CR_R         HWREG(0x40006524)
+#define GPIO_PORTC_AMSEL_R      HWREG(0x40006528)
+#define GPIO_PORTC_PCTL_R       HWREG(0x4000652C)
+#define GPIO_PORTC_ADCCTL_R     HWREG(0x40006530)
+#define GPIO_PORTC_DMACTL_R     HWREG(0x40006534)
 
 //*****************************************************************************
 //
@@ -252,414 +267,414 @@
 //
 //*****************************************************************************
 #define GPIO_PORTD_DATA_BITS_R  ((volatile unsigned long *)0x40007000)
-#define GPIO_PORTD_DATA_R       (*((volatile unsigned long *)0x400073FC))
-#define GPIO_PORTD_DIR_R        (*((volatile unsigned long *)0x40007400))
-#define GPIO_PORTD_IS_R         (*((volatile unsigned long *)0x40007404))
-#define GPIO_PORTD_IBE_R        (*((volatile unsigned long *)0x40007408))
-#define GPIO_PORTD_IEV_R        (*((volatile unsigned long *)0x4000740C))
-#define GPIO_PORTD_IM_R         (*((volatile unsigned long *)0x40007410))
-#define GPIO_PORTD_RIS_R        (*((volatile unsigned long *)0x40007414))
-#define GPIO_PORTD_MIS_R        (*((volatile unsigned long *)0x40007418))
-#define GPIO_PORTD_ICR_R        (*((volatile unsigned long *)0x4000741C))
-#define GPIO_PORTD_AFSEL_R      (*((volatile unsigned long *)0x40007420))
-#define GPIO_PORTD_DR2R_R       (*((volatile unsigned long *)0x40007500))
-#define GPIO_PORTD_DR4R_R       (*((volatile unsigned long *)0x40007504))
-#define GPIO_PORTD_DR8R_R       (*((volatile unsigned long *)0x40007508))
-#define GPIO_PORTD_ODR_R        (*((volatile unsigned long *)0x4000750C))
-#define GPIO_PORTD_PUR_R        (*((volatile unsigned long *)0x40007510))
-#define GPIO_PORTD_PDR_R        (*((volatile unsigned long *)0x40007514))
-#define GPIO_PORTD_SLR_R        (*((volatile unsigned long *)0x40007518))
-#define GPIO_PORTD_DEN_R        (*((volatile unsigned long *)0x4000751C))
-#define GPIO_PORTD_LOCK_R       (*((volatile unsigned long *)0x40007520))
-#define GPIO_PORTD_CR_R         (*((volatile unsigned long *)0x40007524))
-#define GPIO_PORTD_AMSEL_R      (*((volatile unsigned long *)0x40007528))
-#define GPIO_PORTD_PCTL_R       (*((volatile unsigned long *)0x4000752C))
-#define GPIO_PORTD_ADCCTL_R     (*((volatile unsigned long *)0x40007530))
-#define GPIO_PORTD_DMACTL_R     (*((volatile unsigned long *)0x40007534))
+#define GPIO_PORTD_DATA_R       HWREG(0x400073FC)
+#define GPIO_PORTD_DIR_R        HWREG(0x40007400)
+#define GPIO_PORTD_IS_R         HWREG(0x40007404)
+#define GPIO_PORTD_IBE_R        HWREG(0x40007408)
+#define GPIO_PORTD_IEV_R        HWREG(0x4000740C)
+#define GPIO_PORTD_IM_R         HWREG(0x40007410)
+#define GPIO_PORTD_RIS_R        HWREG(0x40007414)
+#define GPIO_PORTD_MIS_R        HWREG(0x40007418)
+#define GPIO_PORTD_ICR_R        HWREG(0x4000741C)
+#define GPIO_PORTD_AFSEL_R      HWREG(0x40007420)
+#define GPIO_PORTD_DR2R_R       HWREG(0x40007500)
+#define GPIO_PORTD_DR4R_R       HWREG(0x40007504)
+#define GPIO_PORTD_DR8R_R       HWREG(0x40007508)
+#define GPIO_PORTD_ODR_R        HWREG(0x4000750C)
+#define GPIO_PORTD_PUR_R        HWREG(0x40007510)
+#define GPIO_PORTD_PDR_R        HWREG(0x40007514)
+#define GPIO_PORTD_SLR_R        HWREG(0x40007518)
+#define GPIO_PORTD_DEN_R        HWREG(0x4000751C)
+#define GPIO_PORTD_LOCK_R       HWREG(0x40007520)
+#define GPIO_PORTD_CR_R         HWREG(0x40007524)
+#define GPIO_PORTD_AMSEL_R      HWREG(0x40007528)
+#define GPIO_PORTD_PCTL_R       HWREG(0x4000752C)
+#define GPIO_PORTD_ADCCTL_R     HWREG(0x40007530)
+#define GPIO_PORTD_DMACTL_R     HWREG(0x40007534)
 
 //*****************************************************************************
 //
 // SSI registers (SSI0)
 //
 //*****************************************************************************
-#define SSI0_CR0_R              (*((volatile unsigned long *)0x40008000))
-#define SSI0_CR1_R              (*((volatile unsigned long *)0x40008004))
-#define SSI0_DR_R               (*((volatile unsigned long *)0x40008008))
-#define SSI0_SR_R               (*((volatile unsigned long *)0x4000800C))
-#define SSI0_CPSR_R             (*((volatile unsigned long *)0x40008010))
-#define SSI0_IM_R               (*((volatile unsigned long *)0x40008014))
-#define SSI0_RIS_R              (*((volatile unsigned long *)0x40008018))
-#define SSI0_MIS_R              (*((volatile unsigned long *)0x4000801C))
-#define SSI0_ICR_R              (*((volatile unsigned long *)0x40008020))
-#define SSI0_DMACTL_R           (*((volatile unsigned long *)0x40008024))
-#define SSI0_CC_R               (*((volatile unsigned long *)0x40008FC8))
+#define SSI0_CR0_R              HWREG(0x40008000)
+#define SSI0_CR1_R              HWREG(0x40008004)
+#define SSI0_DR_R               HWREG(0x40008008)
+#define SSI0_SR_R               HWREG(0x4000800C)
+#define SSI0_CPSR_R             HWREG(0x40008010)
+#define SSI0_IM_R               HWREG(0x40008014)
+#define SSI0_RIS_R              HWREG(0x40008018)
+#define SSI0_MIS_R              HWREG(0x4000801C)
+#define SSI0_ICR_R              HWREG(0x40008020)
+#define SSI0_DMACTL_R           HWREG(0x40008024)
+#define SSI0_CC_R               HWREG(0x40008FC8)
 
 //*****************************************************************************
 //
 // SSI registers (SSI1)
 //
 //*****************************************************************************
-#define SSI1_CR0_R              (*((volatile unsigned long *)0x40009000))
-#define SSI1_CR1_R              (*((volatile unsigned long *)0x40009004))
-#define SSI1_DR_R               (*((volatile unsigned long *)0x40009008))
-#define SSI1_SR_R               (*((volatile unsigned long *)0x4000900C))
-#define SSI1_CPSR_R             (*((volatile unsigned long *)0x40009010))
-#define SSI1_IM_R               (*((volatile unsigned long *)0x40009014))
-#define SSI1_RIS_R              (*((volatile unsigned long *)0x40009018))
-#define SSI1_MIS_R              (*((volatile unsigned long *)0x4000901C))
-#define SSI1_ICR_R              (*((volatile unsigned long *)0x40009020))
-#define SSI1_DMACTL_R           (*((volatile unsigned long *)0x40009024))
-#define SSI1_CC_R               (*((volatile unsigned long *)0x40009FC8))
+#define SSI1_CR0_R              HWREG(0x40009000)
+#define SSI1_CR1_R              HWREG(0x40009004)
+#define SSI1_DR_R               HWREG(0x40009008)
+#define SSI1_SR_R               HWREG(0x4000900C)
+#define SSI1_CPSR_R             HWREG(0x40009010)
+#define SSI1_IM_R               HWREG(0x40009014)
+#define SSI1_RIS_R              HWREG(0x40009018)
+#define SSI1_MIS_R              HWREG(0x4000901C)
+#define SSI1_ICR_R              HWREG(0x40009020)
+#define SSI1_DMACTL_R           HWREG(0x40009024)
+#define SSI1_CC_R               HWREG(0x40009FC8)
 
 //*****************************************************************************
 //
 // SSI registers (SSI2)
 //
 //*****************************************************************************
-#define SSI2_CR0_R              (*((volatile unsigned long *)0x4000A000))
-#define SSI2_CR1_R              (*((volatile unsigned long *)0x4000A004))
-#define SSI2_DR_R               (*((volatile unsigned long *)0x4000A008))
-#define SSI2_SR_R               (*((volatile unsigned long *)0x4000A00C))
-#define SSI2_CPSR_R             (*((volatile unsigned long *)0x4000A010))
-#define SSI2_IM_R               (*((volatile unsigned long *)0x4000A014))
-#define SSI2_RIS_R              (*((volatile unsigned long *)0x4000A018))
-#define SSI2_MIS_R              (*((volatile unsigned long *)0x4000A01C))
-#define SSI2_ICR_R              (*((volatile unsigned long *)0x4000A020))
-#define SSI2_DMACTL_R           (*((volatile unsigned long *)0x4000A024))
-#define SSI2_CC_R               (*((volatile unsigned long *)0x4000AFC8))
+#define SSI2_CR0_R              HWREG(0x4000A000)
+#define SSI2_CR1_R              HWREG(0x4000A004)
+#define SSI2_DR_R               HWREG(0x4000A008)
+#define SSI2_SR_R               HWREG(0x4000A00C)
+#define SSI2_CPSR_R             HWREG(0x4000A010)
+#define SSI2_IM_R               HWREG(0x4000A014)
+#define SSI2_RIS_R              HWREG(0x4000A018)
+#define SSI2_MIS_R              HWREG(0x4000A01C)
+#define SSI2_ICR_R              HWREG(0x4000A020)
+#define SSI2_DMACTL_R           HWREG(0x4000A024)
+#define SSI2_CC_R               HWREG(0x4000AFC8)
 
 //*****************************************************************************
 //
 // SSI registers (SSI3)
 //
 //*****************************************************************************
-#define SSI3_CR0_R              (*((volatile unsigned long *)0x4000B000))
-#define SSI3_CR1_R              (*((volatile unsigned long *)0x4000B004))
-#define SSI3_DR_R               (*((volatile unsigned long *)0x4000B008))
-#define SSI3_SR_R               (*((volatile unsigned long *)0x4000B00C))
-#define SSI3_CPSR_R             (*((volatile unsigned long *)0x4000B010))
-#define SSI3_IM_R               (*((volatile unsigned long *)0x4000B014))
-#define SSI3_RIS_R              (*((volatile unsigned long *)0x4000B018))
-#define SSI3_MIS_R              (*((volatile unsigned long *)0x4000B01C))
-#define SSI3_ICR_R              (*((volatile unsigned long *)0x4000B020))
-#define SSI3_DMACTL_R           (*((volatile unsigned long *)0x4000B024))
-#define SSI3_CC_R               (*((volatile unsigned long *)0x4000BFC8))
+#define SSI3_CR0_R              HWREG(0x4000B000)
+#define SSI3_CR1_R              HWREG(0x4000B004)
+#define SSI3_DR_R               HWREG(0x4000B008)
+#define SSI3_SR_R               HWREG(0x4000B00C)
+#define SSI3_CPSR_R             HWREG(0x4000B010)
+#define SSI3_IM_R               HWREG(0x4000B014)
+#define SSI3_RIS_R              HWREG(0x4000B018)
+#define SSI3_MIS_R              HWREG(0x4000B01C)
+#define SSI3_ICR_R              HWREG(0x4000B020)
+#define SSI3_DMACTL_R           HWREG(0x4000B024)
+#define SSI3_CC_R               HWREG(0x4000BFC8)
 
 //*****************************************************************************
 //
 // UART registers (UART0)
 //
 //*****************************************************************************
-#define UART0_DR_R              (*((volatile unsigned long *)0x4000C000))
-#define UART0_RSR_R             (*((volatile unsigned long *)0x4000C004))
-#define UART0_ECR_R             (*((volatile unsigned long *)0x4000C004))
-#define UART0_FR_R              (*((volatile unsigned long *)0x4000C018))
-#define UART0_ILPR_R            (*((volatile unsigned long *)0x4000C020))
-#define UART0_IBRD_R            (*((volatile unsigned long *)0x4000C024))
-#define UART0_FBRD_R            (*((volatile unsigned long *)0x4000C028))
-#define UART0_LCRH_R            (*((volatile unsigned long *)0x4000C02C))
-#define UART0_CTL_R             (*((volatile unsigned long *)0x4000C030))
-#define UART0_IFLS_R            (*((volatile unsigned long *)0x4000C034))
-#define UART0_IM_R              (*((volatile unsigned long *)0x4000C038))
-#define UART0_RIS_R             (*((volatile unsigned long *)0x4000C03C))
-#define UART0_MIS_R             (*((volatile unsigned long *)0x4000C040))
-#define UART0_ICR_R             (*((volatile unsigned long *)0x4000C044))
-#define UART0_DMACTL_R          (*((volatile unsigned long *)0x4000C048))
-#define UART0_9BITADDR_R        (*((volatile unsigned long *)0x4000C0A4))
-#define UART0_9BITAMASK_R       (*((volatile unsigned long *)0x4000C0A8))
-#define UART0_PP_R              (*((volatile unsigned long *)0x4000CFC0))
-#define UART0_CC_R              (*((volatile unsigned long *)0x4000CFC8))
+#define UART0_DR_R              HWREG(0x4000C000)
+#define UART0_RSR_R             HWREG(0x4000C004)
+#define UART0_ECR_R             HWREG(0x4000C004)
+#define UART0_FR_R              HWREG(0x4000C018)
+#define UART0_ILPR_R            HWREG(0x4000C020)
+#define UART0_IBRD_R            HWREG(0x4000C024)
+#define UART0_FBRD_R            HWREG(0x4000C028)
+#define UART0_LCRH_R            HWREG(0x4000C02C)
+#define UART0_CTL_R             HWREG(0x4000C030)
+#define UART0_IFLS_R            HWREG(0x4000C034)
+#define UART0_IM_R              HWREG(0x4000C038)
+#define UART0_RIS_R             HWREG(0x4000C03C)
+#define UART0_MIS_R             HWREG(0x4000C040)
+#define UART0_ICR_R             HWREG(0x4000C044)
+#define UART0_DMACTL_R          HWREG(0x4000C048)
+#define UART0_9BITADDR_R        HWREG(0x4000C0A4)
+#define UART0_9BITAMASK_R       HWREG(0x4000C0A8)
+#define UART0_PP_R              HWREG(0x4000CFC0)
+#define UART0_CC_R              HWREG(0x4000CFC8)
 
 //*****************************************************************************
 //
 // UART registers (UART1)
 //
 //*****************************************************************************
-#define UART1_DR_R              (*((volatile unsigned long *)0x4000D000))
-#define UART1_RSR_R             (*((volatile unsigned long *)0x4000D004))
-#define UART1_ECR_R             (*((volatile unsigned long *)0x4000D004))
-#define UART1_FR_R              (*((volatile unsigned long *)0x4000D018))
-#define UART1_ILPR_R            (*((volatile unsigned long *)0x4000D020))
-#define UART1_IBRD_R            (*((volatile unsigned long *)0x4000D024))
-#define UART1_FBRD_R            (*((volatile unsigned long *)0x4000D028))
-#define UART1_LCRH_R            (*((volatile unsigned long *)0x4000D02C))
-#define UART1_CTL_R             (*((volatile unsigned long *)0x4000D030))
-#define UART1_IFLS_R            (*((volatile unsigned long *)0x4000D034))
-#define UART1_IM_R              (*((volatile unsigned long *)0x4000D038))
-#define UART1_RIS_R             (*((volatile unsigned long *)0x4000D03C))
-#define UART1_MIS_R             (*((volatile unsigned long *)0x4000D040))
-#define UART1_ICR_R             (*((volatile unsigned long *)0x4000D044))
-#define UART1_DMACTL_R          (*((volatile unsigned long *)0x4000D048))
-#define UART1_9BITADDR_R        (*((volatile unsigned long *)0x4000D0A4))
-#define UART1_9BITAMASK_R       (*((volatile unsigned long *)0x4000D0A8))
-#define UART1_PP_R              (*((volatile unsigned long *)0x4000DFC0))
-#define UART1_CC_R              (*((volatile unsigned long *)0x4000DFC8))
+#define UART1_DR_R              HWREG(0x4000D000)
+#define UART1_RSR_R             HWREG(0x4000D004)
+#define UART1_ECR_R             HWREG(0x4000D004)
+#define UART1_FR_R              HWREG(0x4000D018)
+#define UART1_ILPR_R            HWREG(0x4000D020)
+#define UART1_IBRD_R            HWREG(0x4000D024)
+#define UART1_FBRD_R            HWREG(0x4000D028)
+#define UART1_LCRH_R            HWREG(0x4000D02C)
+#define UART1_CTL_R             HWREG(0x4000D030)
+#define UART1_IFLS_R            HWREG(0x4000D034)
+#define UART1_IM_R              HWREG(0x4000D038)
+#define UART1_RIS_R             HWREG(0x4000D03C)
+#define UART1_MIS_R             HWREG(0x4000D040)
+#define UART1_ICR_R             HWREG(0x4000D044)
+#define UART1_DMACTL_R          HWREG(0x4000D048)
+#define UART1_9BITADDR_R        HWREG(0x4000D0A4)
+#define UART1_9BITAMASK_R       HWREG(0x4000D0A8)
+#define UART1_PP_R              HWREG(0x4000DFC0)
+#define UART1_CC_R              HWREG(0x4000DFC8)
 
 //*****************************************************************************
 //
 // UART registers (UART2)
 //
 //*****************************************************************************
-#define UART2_DR_R              (*((volatile unsigned long *)0x4000E000))
-#define UART2_RSR_R             (*((volatile unsigned long *)0x4000E004))
-#define UART2_ECR_R             (*((volatile unsigned long *)0x4000E004))
-#define UART2_FR_R              (*((volatile unsigned long *)0x4000E018))
-#define UART2_ILPR_R            (*((volatile unsigned long *)0x4000E020))
-#define UART2_IBRD_R            (*((volatile unsigned long *)0x4000E024))
-#define UART2_FBRD_R            (*((volatile unsigned long *)0x4000E028))
-#define UART2_LCRH_R            (*((volatile unsigned long *)0x4000E02C))
-#define UART2_CTL_R             (*((volatile unsigned long *)0x4000E030))
-#define UART2_IFLS_R            (*((volatile unsigned long *)0x4000E034))
-#define UART2_IM_R              (*((volatile unsigned long *)0x4000E038))
-#define UART2_RIS_R             (*((volatile unsigned long *)0x4000E03C))
-#define UART2_MIS_R             (*((volatile unsigned long *)0x4000E040))
-#define UART2_ICR_R             (*((volatile unsigned long *)0x4000E044))
-#define UART2_DMACTL_R          (*((volatile unsigned long *)0x4000E048))
-#define UART2_9BITADDR_R        (*((volatile unsigned long *)0x4000E0A4))
-#define UART2_9BITAMASK_R       (*((volatile unsigned long *)0x4000E0A8))
-#define UART2_PP_R              (*((volatile unsigned long *)0x4000EFC0))
-#define UART2_CC_R              (*((volatile unsigned long *)0x4000EFC8))
+#define UART2_DR_R              HWREG(0x4000E000)
+#define UART2_RSR_R             HWREG(0x4000E004)
+#define UART2_ECR_R             HWREG(0x4000E004)
+#define UART2_FR_R              HWREG(0x4000E018)
+#define UART2_ILPR_R            HWREG(0x4000E020)
+#define UART2_IBRD_R            HWREG(0x4000E024)
+#define UART2_FBRD_R            HWREG(0x4000E028)
+#define UART2_LCRH_R            HWREG(0x4000E02C)
+#define UART2_CTL_R             HWREG(0x4000E030)
+#define UART2_IFLS_R            HWREG(0x4000E034)
+#define UART2_IM_R              HWREG(0x4000E038)
+#define UART2_RIS_R             HWREG(0x4000E03C)
+#define UART2_MIS_R             HWREG(0x4000E040)
+#define UART2_ICR_R             HWREG(0x4000E044)
+#define UART2_DMACTL_R          HWREG(0x4000E048)
+#define UART2_9BITADDR_R        HWREG(0x4000E0A4)
+#define UART2_9BITAMASK_R       HWREG(0x4000E0A8)
+#define UART2_PP_R              HWREG(0x4000EFC0)
+#define UART2_CC_R              HWREG(0x4000EFC8)
 
 //*****************************************************************************
 //
 // UART registers (UART3)
 //
 //*****************************************************************************
-#define UART3_DR_R              (*((volatile unsigned long *)0x4000F000))
-#define UART3_RSR_R             (*((volatile unsigned long *)0x4000F004))
-#define UART3_ECR_R             (*((volatile unsigned long *)0x4000F004))
-#define UART3_FR_R              (*((volatile unsigned long *)0x4000F018))
-#define UART3_ILPR_R            (*((volatile unsigned long *)0x4000F020))
-#define UART3_IBRD_R            (*((volatile unsigned long *)0x4000F024))
-#define UART3_FBRD_R            (*((volatile unsigned long *)0x4000F028))
-#define UART3_LCRH_R            (*((volatile unsigned long *)0x4000F02C))
-#define UART3_CTL_R             (*((volatile unsigned long *)0x4000F030))
-#define UART3_IFLS_R            (*((volatile unsigned long *)0x4000F034))
-#define UART3_IM_R              (*((volatile unsigned long *)0x4000F038))
-#define UART3_RIS_R             (*((volatile unsigned long *)0x4000F03C))
-#define UART3_MIS_R             (*((volatile unsigned long *)0x4000F040))
-#define UART3_ICR_R             (*((volatile unsigned long *)0x4000F044))
-#define UART3_DMACTL_R          (*((volatile unsigned long *)0x4000F048))
-#define UART3_9BITADDR_R        (*((volatile unsigned long *)0x4000F0A4))
-#define UART3_9BITAMASK_R       (*((volatile unsigned long *)0x4000F0A8))
-#define UART3_PP_R              (*((volatile unsigned long *)0x4000FFC0))
-#define UART3_CC_R              (*((volatile unsigned long *)0x4000FFC8))
+#define UART3_DR_R              HWREG(0x4000F000)
+#define UART3_RSR_R             HWREG(0x4000F004)
+#define UART3_ECR_R             HWREG(0x4000F004)
+#define UART3_FR_R              HWREG(0x4000F018)
+#define UART3_ILPR_R            HWREG(0x4000F020)
+#define UART3_IBRD_R            HWREG(0x4000F024)
+#define UART3_FBRD_R            HWREG(0x4000F028)
+#define UART3_LCRH_R            HWREG(0x4000F02C)
+#define UART3_CTL_R             HWREG(0x4000F030)
+#define UART3_IFLS_R            HWREG(0x4000F034)
+#define UART3_IM_R              HWREG(0x4000F038)
+#define UART3_RIS_R             HWREG(0x4000F03C)
+#define UART3_MIS_R             HWREG(0x4000F040)
+#define UART3_ICR_R             HWREG(0x4000F044)
+#define UART3_DMACTL_R          HWREG(0x4000F048)
+#define UART3_9BITADDR_R        HWREG(0x4000F0A4)
+#define UART3_9BITAMASK_R       HWREG(0x4000F0A8)
+#define UART3_PP_R              HWREG(0x4000FFC0)
+#define UART3_CC_R              HWREG(0x4000FFC8)
 
 //*****************************************************************************
 //
 // UART registers (UART4)
 //
 //*****************************************************************************
-#define UART4_DR_R              (*((volatile unsigned long *)0x40010000))
-#define UART4_RSR_R             (*((volatile unsigned long *)0x40010004))
-#define UART4_ECR_R             (*((volatile unsigned long *)0x40010004))
-#define UART4_FR_R              (*((volatile unsigned long *)0x40010018))
-#define UART4_ILPR_R            (*((volatile unsigned long *)0x40010020))
-#define UART4_IBRD_R            (*((volatile unsigned long *)0x40010024))
-#define UART4_FBRD_R            (*((volatile unsigned long *)0x40010028))
-#define UART4_LCRH_R            (*((volatile unsigned long *)0x4001002C))
-#define UART4_CTL_R             (*((volatile unsigned long *)0x40010030))
-#define UART4_IFLS_R            (*((volatile unsigned long *)0x40010034))
-#define UART4_IM_R              (*((volatile unsigned long *)0x40010038))
-#define UART4_RIS_R             (*((volatile unsigned long *)0x4001003C))
-#define UART4_MIS_R             (*((volatile unsigned long *)0x40010040))
-#define UART4_ICR_R             (*((volatile unsigned long *)0x40010044))
-#define UART4_DMACTL_R          (*((volatile unsigned long *)0x40010048))
-#define UART4_9BITADDR_R        (*((volatile unsigned long *)0x400100A4))
-#define UART4_9BITAMASK_R       (*((volatile unsigned long *)0x400100A8))
-#define UART4_PP_R              (*((volatile unsigned long *)0x40010FC0))
-#define UART4_CC_R              (*((volatile unsigned long *)0x40010FC8))
+#define UART4_DR_R              HWREG(0x40010000)
+#define UART4_RSR_R             HWREG(0x40010004)
+#define UART4_ECR_R             HWREG(0x40010004)
+#define UART4_FR_R              HWREG(0x40010018)
+#define UART4_ILPR_R            HWREG(0x40010020)
+#define UART4_IBRD_R            HWREG(0x40010024)
+#define UART4_FBRD_R            HWREG(0x40010028)
+#define UART4_LCRH_R            HWREG(0x4001002C)
+#define UART4_CTL_R             HWREG(0x40010030)
+#define UART4_IFLS_R            HWREG(0x40010034)
+#define UART4_IM_R              HWREG(0x40010038)
+#define UART4_RIS_R             HWREG(0x4001003C)
+#define UART4_MIS_R             HWREG(0x40010040)
+#define UART4_ICR_R             HWREG(0x40010044)
+#define UART4_DMACTL_R          HWREG(0x40010048)
+#define UART4_9BITADDR_R        HWREG(0x400100A4)
+#define UART4_9BITAMASK_R       HWREG(0x400100A8)
+#define UART4_PP_R              HWREG(0x40010FC0)
+#define UART4_CC_R              HWREG(0x40010FC8)
 
 //*****************************************************************************
 //
 // UART registers (UART5)
 //
 //*****************************************************************************
-#define UART5_DR_R              (*((volatile unsigned long *)0x40011000))
-#define UART5_RSR_R             (*((volatile unsigned long *)0x40011004))
-#define UART5_ECR_R             (*((volatile unsigned long *)0x40011004))
-#define UART5_FR_R              (*((volatile unsigned long *)0x40011018))
-#define UART5_ILPR_R            (*((volatile unsigned long *)0x40011020))
-#define UART5_IBRD_R            (*((volatile unsigned long *)0x40011024))
-#define UART5_FBRD_R            (*((volatile unsigned long *)0x40011028))
-#define UART5_LCRH_R            (*((volatile unsigned long *)0x4001102C))
-#define UART5_CTL_R             (*((volatile unsigned long *)0x40011030))
-#define UART5_IFLS_R            (*((volatile unsigned long *)0x40011034))
-#define UART5_IM_R              (*((volatile unsigned long *)0x40011038))
-#define UART5_RIS_R             (*((volatile unsigned long *)0x4001103C))
-#define UART5_MIS_R             (*((volatile unsigned long *)0x40011040))
-#define UART5_ICR_R             (*((volatile unsigned long *)0x40011044))
-#define UART5_DMACTL_R          (*((volatile unsigned long *)0x40011048))
-#define UART5_9BITADDR_R        (*((volatile unsigned long *)0x400110A4))
-#define UART5_9BITAMASK_R       (*((volatile unsigned long *)0x400110A8))
-#define UART5_PP_R              (*((volatile unsigned long *)0x40011FC0))
-#define UART5_CC_R              (*((volatile unsigned long *)0x40011FC8))
+#define UART5_DR_R              HWREG(0x40011000)
+#define UART5_RSR_R             HWREG(0x40011004)
+#define UART5_ECR_R             HWREG(0x40011004)
+#define UART5_FR_R              HWREG(0x40011018)
+#define UART5_ILPR_R            HWREG(0x40011020)
+#define UART5_IBRD_R            HWREG(0x40011024)
+#define UART5_FBRD_R            HWREG(0x40011028)
+#define UART5_LCRH_R            HWREG(0x4001102C)
+#define UART5_CTL_R             HWREG(0x40011030)
+#define UART5_IFLS_R            HWREG(0x40011034)
+#define UART5_IM_R              HWREG(0x40011038)
+#define UART5_RIS_R             HWREG(0x4001103C)
+#define UART5_MIS_R             HWREG(0x40011040)
+#define UART5_ICR_R             HWREG(0x40011044)
+#define UART5_DMACTL_R          HWREG(0x40011048)
+#define UART5_9BITADDR_R        HWREG(0x400110A4)
+#define UART5_9BITAMASK_R       HWREG(0x400110A8)
+#define UART5_PP_R              HWREG(0x40011FC0)
+#define UART5_CC_R              HWREG(0x40011FC8)
 
 //*****************************************************************************
 //
 // UART registers (UART6)
 //
 //*****************************************************************************
-#define UART6_DR_R              (*((volatile unsigned long *)0x40012000))
-#define UART6_RSR_R             (*((volatile unsigned long *)0x40012004))
-#define UART6_ECR_R             (*((volatile unsigned long *)0x40012004))
-#define UART6_FR_R              (*((volatile unsigned long *)0x40012018))
-#define UART6_ILPR_R            (*((volatile unsigned long *)0x40012020))
-#define UART6_IBRD_R            (*((volatile unsigned long *)0x40012024))
-#define UART6_FBRD_R            (*((volatile unsigned long *)0x40012028))
-#define UART6_LCRH_R            (*((volatile unsigned long *)0x4001202C))
-#define UART6_CTL_R             (*((volatile unsigned long *)0x40012030))
-#define UART6_IFLS_R            (*((volatile unsigned long *)0x40012034))
-#define UART6_IM_R              (*((volatile unsigned long *)0x40012038))
-#define UART6_RIS_R             (*((volatile unsigned long *)0x4001203C))
-#define UART6_MIS_R             (*((volatile unsigned long *)0x40012040))
-#define UART6_ICR_R             (*((volatile unsigned long *)0x40012044))
-#define UART6_DMACTL_R          (*((volatile unsigned long *)0x40012048))
-#define UART6_9BITADDR_R        (*((volatile unsigned long *)0x400120A4))
-#define UART6_9BITAMASK_R       (*((volatile unsigned long *)0x400120A8))
-#define UART6_PP_R              (*((volatile unsigned long *)0x40012FC0))
-#define UART6_CC_R              (*((volatile unsigned long *)0x40012FC8))
+#define UART6_DR_R              HWREG(0x40012000)
+#define UART6_RSR_R             HWREG(0x40012004)
+#define UART6_ECR_R             HWREG(0x40012004)
+#define UART6_FR_R              HWREG(0x40012018)
+#define UART6_ILPR_R            HWREG(0x40012020)
+#define UART6_IBRD_R            HWREG(0x40012024)
+#define UART6_FBRD_R            HWREG(0x40012028)
+#define UART6_LCRH_R            HWREG(0x4001202C)
+#define UART6_CTL_R             HWREG(0x40012030)
+#define UART6_IFLS_R            HWREG(0x40012034)
+#define UART6_IM_R              HWREG(0x40012038)
+#define UART6_RIS_R             HWREG(0x4001203C)
+#define UART6_MIS_R             HWREG(0x40012040)
+#define UART6_ICR_R             HWREG(0x40012044)
+#define UART6_DMACTL_R          HWREG(0x40012048)
+#define UART6_9BITADDR_R        HWREG(0x400120A4)
+#define UART6_9BITAMASK_R       HWREG(0x400120A8)
+#define UART6_PP_R              HWREG(0x40012FC0)
+#define UART6_CC_R              HWREG(0x40012FC8)
 
 //*****************************************************************************
 //
 // UART registers (UART7)
 //
 //*****************************************************************************
-#define UART7_DR_R              (*((volatile unsigned long *)0x40013000))
-#define UART7_RSR_R             (*((volatile unsigned long *)0x40013004))
-#define UART7_ECR_R             (*((volatile unsigned long *)0x40013004))
-#define UART7_FR_R              (*((volatile unsigned long *)0x40013018))
-#define UART7_ILPR_R            (*((volatile unsigned long *)0x40013020))
-#define UART7_IBRD_R            (*((volatile unsigned long *)0x40013024))
-#define UART7_FBRD_R            (*((volatile unsigned long *)0x40013028))
-#define UART7_LCRH_R            (*((volatile unsigned long *)0x4001302C))
-#define UART7_CTL_R             (*((volatile unsigned long *)0x40013030))
-#define UART7_IFLS_R            (*((volatile unsigned long *)0x40013034))
-#define UART7_IM_R              (*((volatile unsigned long *)0x40013038))
-#define UART7_RIS_R             (*((volatile unsigned long *)0x4001303C))
-#define UART7_MIS_R             (*((volatile unsigned long *)0x40013040))
-#define UART7_ICR_R             (*((volatile unsigned long *)0x40013044))
-#define UART7_DMACTL_R          (*((volatile unsigned long *)0x40013048))
-#define UART7_9BITADDR_R        (*((volatile unsigned long *)0x400130A4))
-#define UART7_9BITAMASK_R       (*((volatile unsigned long *)0x400130A8))
-#define UART7_PP_R              (*((volatile unsigned long *)0x40013FC0))
-#define UART7_CC_R              (*((volatile unsigned long *)0x40013FC8))
+#define UART7_DR_R              HWREG(0x40013000)
+#define UART7_RSR_R             HWREG(0x40013004)
+#define UART7_ECR_R             HWREG(0x40013004)
+#define UART7_FR_R              HWREG(0x40013018)
+#define UART7_ILPR_R            HWREG(0x40013020)
+#define UART7_IBRD_R            HWREG(0x40013024)
+#define UART7_FBRD_R            HWREG(0x40013028)
+#define UART7_LCRH_R            HWREG(0x4001302C)
+#define UART7_CTL_R             HWREG(0x40013030)
+#define UART7_IFLS_R            HWREG(0x40013034)
+#define UART7_IM_R              HWREG(0x40013038)
+#define UART7_RIS_R             HWREG(0x4001303C)
+#define UART7_MIS_R             HWREG(0x40013040)
+#define UART7_ICR_R             HWREG(0x40013044)
+#define UART7_DMACTL_R          HWREG(0x40013048)
+#define UART7_9BITADDR_R        HWREG(0x400130A4)
+#define UART7_9BITAMASK_R       HWREG(0x400130A8)
+#define UART7_PP_R              HWREG(0x40013FC0)
+#define UART7_CC_R              HWREG(0x40013FC8)
 
 //*****************************************************************************
 //
 // I2C registers (I2C0)
 //
 //*****************************************************************************
-#define I2C0_MSA_R              (*((volatile unsigned long *)0x40020000))
-#define I2C0_MCS_R              (*((volatile unsigned long *)0x40020004))
-#define I2C0_MDR_R              (*((volatile unsigned long *)0x40020008))
-#define I2C0_MTPR_R             (*((volatile unsigned long *)0x4002000C))
-#define I2C0_MIMR_R             (*((volatile unsigned long *)0x40020010))
-#define I2C0_MRIS_R             (*((volatile unsigned long *)0x40020014))
-#define I2C0_MMIS_R             (*((volatile unsigned long *)0x40020018))
-#define I2C0_MICR_R             (*((volatile unsigned long *)0x4002001C))
-#define I2C0_MCR_R              (*((volatile unsigned long *)0x40020020))
-#define I2C0_MCLKOCNT_R         (*((volatile unsigned long *)0x40020024))
-#define I2C0_MBMON_R            (*((volatile unsigned long *)0x4002002C))
-#define I2C0_MCR2_R             (*((volatile unsigned long *)0x40020038))
-#define I2C0_SOAR_R             (*((volatile unsigned long *)0x40020800))
-#define I2C0_SCSR_R             (*((volatile unsigned long *)0x40020804))
-#define I2C0_SDR_R              (*((volatile unsigned long *)0x40020808))
-#define I2C0_SIMR_R             (*((volatile unsigned long *)0x4002080C))
-#define I2C0_SRIS_R             (*((volatile unsigned long *)0x40020810))
-#define I2C0_SMIS_R             (*((volatile unsigned long *)0x40020814))
-#define I2C0_SICR_R             (*((volatile unsigned long *)0x40020818))
-#define I2C0_SOAR2_R            (*((volatile unsigned long *)0x4002081C))
-#define I2C0_SACKCTL_R          (*((volatile unsigned long *)0x40020820))
-#define I2C0_PP_R               (*((volatile unsigned long *)0x40020FC0))
-#define I2C0_PC_R               (*((volatile unsigned long *)0x40020FC4))
+#define I2C0_MSA_R              HWREG(0x40020000)
+#define I2C0_MCS_R              HWREG(0x40020004)
+#define I2C0_MDR_R              HWREG(0x40020008)
+#define I2C0_MTPR_R             HWREG(0x4002000C)
+#define I2C0_MIMR_R             HWREG(0x40020010)
+#define I2C0_MRIS_R             HWREG(0x40020014)
+#define I2C0_MMIS_R             HWREG(0x40020018)
+#define I2C0_MICR_R             HWREG(0x4002001C)
+#define I2C0_MCR_R              HWREG(0x40020020)
+#define I2C0_MCLKOCNT_R         HWREG(0x40020024)
+#define I2C0_MBMON_R            HWREG(0x4002002C)
+#define I2C0_MCR2_R             HWREG(0x40020038)
+#define I2C0_SOAR_R             HWREG(0x40020800)
+#define I2C0_SCSR_R             HWREG(0x40020804)
+#define I2C0_SDR_R              HWREG(0x40020808)
+#define I2C0_SIMR_R             HWREG(0x4002080C)
+#define I2C0_SRIS_R             HWREG(0x40020810)
+#define I2C0_SMIS_R             HWREG(0x40020814)
+#define I2C0_SICR_R             HWREG(0x40020818)
+#define I2C0_SOAR2_R            HWREG(0x4002081C)
+#define I2C0_SACKCTL_R          HWREG(0x40020820)
+#define I2C0_PP_R               HWREG(0x40020FC0)
+#define I2C0_PC_R               HWREG(0x40020FC4)
 
 //*****************************************************************************
 //
 // I2C registers (I2C1)
 //
 //*****************************************************************************
-#define I2C1_MSA_R              (*((volatile unsigned long *)0x40021000))
-#define I2C1_MCS_R              (*((volatile unsigned long *)0x40021004))
-#define I2C1_MDR_R              (*((volatile unsigned long *)0x40021008))
-#define I2C1_MTPR_R             (*((volatile unsigned long *)0x4002100C))
-#define I2C1_MIMR_R             (*((volatile unsigned long *)0x40021010))
-#define I2C1_MRIS_R             (*((volatile unsigned long *)0x40021014))
-#define I2C1_MMIS_R             (*((volatile unsigned long *)0x40021018))
-#define I2C1_MICR_R             (*((volatile unsigned long *)0x4002101C))
-#define I2C1_MCR_R              (*((volatile unsigned long *)0x40021020))
-#define I2C1_MCLKOCNT_R         (*((volatile unsigned long *)0x40021024))
-#define I2C1_MBMON_R            (*((volatile unsigned long *)0x4002102C))
-#define I2C1_MCR2_R             (*((volatile unsigned long *)0x40021038))
-#define I2C1_SOAR_R             (*((volatile unsigned long *)0x40021800))
-#define I2C1_SCSR_R             (*((volatile unsigned long *)0x40021804))
-#define I2C1_SDR_R              (*((volatile unsigned long *)0x40021808))
-#define I2C1_SIMR_R             (*((volatile unsigned long *)0x4002180C))
-#define I2C1_SRIS_R             (*((volatile unsigned long *)0x40021810))
-#define I2C1_SMIS_R             (*((volatile unsigned long *)0x40021814))
-#define I2C1_SICR_R             (*((volatile unsigned long *)0x40021818))
-#define I2C1_SOAR2_R            (*((volatile unsigned long *)0x4002181C))
-#define I2C1_SACKCTL_R          (*((volatile unsigned long *)0x40021820))
-#define I2C1_PP_R               (*((volatile unsigned long *)0x40021FC0))
-#define I2C1_PC_R               (*((volatile unsigned long *)0x40021FC4))
+#define I2C1_MSA_R              HWREG(0x40021000)
+#define I2C1_MCS_R              HWREG(0x40021004)
+#define I2C1_MDR_R              HWREG(0x40021008)
+#define I2C1_MTPR_R             HWREG(0x4002100C)
+#define I2C1_MIMR_R             HWREG(0x40021010)
+#define I2C1_MRIS_R             HWREG(0x40021014)
+#define I2C1_MMIS_R             HWREG(0x40021018)
+#define I2C1_MICR_R             HWREG(0x4002101C)
+#define I2C1_MCR_R              HWREG(0x40021020)
+#define I2C1_MCLKOCNT_R         HWREG(0x40021024)
+#define I2C1_MBMON_R            HWREG(0x4002102C)
+#define I2C1_MCR2_R             HWREG(0x40021038)
+#define I2C1_SOAR_R             HWREG(0x40021800)
+#define I2C1_SCSR_R             HWREG(0x40021804)
+#define I2C1_SDR_R              HWREG(0x40021808)
+#define I2C1_SIMR_R             HWREG(0x4002180C)
+#define I2C1_SRIS_R             HWREG(0x40021810)
+#define I2C1_SMIS_R             HWREG(0x40021814)
+#define I2C1_SICR_R             HWREG(0x40021818)
+#define I2C1_SOAR2_R            HWREG(0x4002181C)
+#define I2C1_SACKCTL_R          HWREG(0x40021820)
+#define I2C1_PP_R               HWREG(0x40021FC0)
+#define I2C1_PC_R               HWREG(0x40021FC4)
 
 //*****************************************************************************
 //
 // I2C registers (I2C2)
 //
 //*****************************************************************************
-#define I2C2_MSA_R              (*((volatile unsigned long *)0x40022000))
-#define I2C2_MCS_R              (*((volatile unsigned long *)0x40022004))
-#define I2C2_MDR_R              (*((volatile unsigned long *)0x40022008))
-#define I2C2_MTPR_R             (*((volatile unsigned long *)0x4002200C))
-#define I2C2_MIMR_R             (*((volatile unsigned long *)0x40022010))
-#define I2C2_MRIS_R             (*((volatile unsigned long *)0x40022014))
-#define I2C2_MMIS_R             (*((volatile unsigned long *)0x40022018))
-#define I2C2_MICR_R             (*((volatile unsigned long *)0x4002201C))
-#define I2C2_MCR_R              (*((volatile unsigned long *)0x40022020))
-#define I2C2_MCLKOCNT_R         (*((volatile unsigned long *)0x40022024))
-#define I2C2_MBMON_R            (*((volatile unsigned long *)0x4002202C))
-#define I2C2_MCR2_R             (*((volatile unsigned long *)0x40022038))
-#define I2C2_SOAR_R             (*((volatile unsigned long *)0x40022800))
-#define I2C2_SCSR_R             (*((volatile unsigned long *)0x40022804))
-#define I2C2_SDR_R              (*((volatile unsigned long *)0x40022808))
-#define I2C2_SIMR_R             (*((volatile unsigned long *)0x4002280C))
-#define I2C2_SRIS_R             (*((volatile unsigned long *)0x40022810))
-#define I2C2_SMIS_R             (*((volatile unsigned long *)0x40022814))
-#define I2C2_SICR_R             (*((volatile unsigned long *)0x40022818))
-#define I2C2_SOAR2_R            (*((volatile unsigned long *)0x4002281C))
-#define I2C2_SACKCTL_R          (*((volatile unsigned long *)0x40022820))
-#define I2C2_PP_R               (*((volatile unsigned long *)0x40022FC0))
-#define I2C2_PC_R               (*((volatile unsigned long *)0x40022FC4))
+#define I2C2_MSA_R              HWREG(0x40022000)
+#define I2C2_MCS_R              HWREG(0x40022004)
+#define I2C2_MDR_R              HWREG(0x40022008)
+#define I2C2_MTPR_R             HWREG(0x4002200C)
+#define I2C2_MIMR_R             HWREG(0x40022010)
+#define I2C2_MRIS_R             HWREG(0x40022014)
+#define I2C2_MMIS_R             HWREG(0x40022018)
+#define I2C2_MICR_R             HWREG(0x4002201C)
+#define I2C2_MCR_R              HWREG(0x40022020)
+#define I2C2_MCLKOCNT_R         HWREG(0x40022024)
+#define I2C2_MBMON_R            HWREG(0x4002202C)
+#define I2C2_MCR2_R             HWREG(0x40022038)
+#define I2C2_SOAR_R             HWREG(0x40022800)
+#define I2C2_SCSR_R             HWREG(0x40022804)
+#define I2C2_SDR_R              HWREG(0x40022808)
+#define I2C2_SIMR_R             HWREG(0x4002280C)
+#define I2C2_SRIS_R             HWREG(0x40022810)
+#define I2C2_SMIS_R             HWREG(0x40022814)
+#define I2C2_SICR_R             HWREG(0x40022818)
+#define I2C2_SOAR2_R            HWREG(0x4002281C)
+#define I2C2_SACKCTL_R          HWREG(0x40022820)
+#define I2C2_PP_R               HWREG(0x40022FC0)
+#define I2C2_PC_R               HWREG(0x40022FC4)
 
 //*****************************************************************************
 //
 // I2C registers (I2C3)
 //
 //*****************************************************************************
-#define I2C3_MSA_R              (*((volatile unsigned long *)0x40023000))
-#define I2C3_MCS_R              (*((volatile unsigned long *)0x40023004))
-#define I2C3_MDR_R              (*((volatile unsigned long *)0x40023008))
-#define I2C3_MTPR_R             (*((volatile unsigned long *)0x4002300C))
-#define I2C3_MIMR_R             (*((volatile unsigned long *)0x40023010))
-#define I2C3_MRIS_R             (*((volatile unsigned long *)0x40023014))
-#define I2C3_MMIS_R             (*((volatile unsigned long *)0x40023018))
-#define I2C3_MICR_R             (*((volatile unsigned long *)0x4002301C))
-#define I2C3_MCR_R              (*((volatile unsigned long *)0x40023020))
-#define I2C3_MCLKOCNT_R         (*((volatile unsigned long *)0x40023024))
-#define I2C3_MBMON_R            (*((volatile unsigned long *)0x4002302C))
-#define I2C3_MCR2_R             (*((volatile unsigned long *)0x40023038))
-#define I2C3_SOAR_R             (*((volatile unsigned long *)0x40023800))
-#define I2C3_SCSR_R             (*((volatile unsigned long *)0x40023804))
-#define I2C3_SDR_R              (*((volatile unsigned long *)0x40023808))
-#define I2C3_SIMR_R             (*((volatile unsigned long *)0x4002380C))
-#define I2C3_SRIS_R             (*((volatile unsigned long *)0x40023810))
-#define I2C3_SMIS_R             (*((volatile unsigned long *)0x40023814))
-#define I2C3_SICR_R             (*((volatile unsigned long *)0x40023818))
-#define I2C3_SOAR2_R            (*((volatile unsigned long *)0x4002381C))
-#define I2C3_SACKCTL_R          (*((volatile unsigned long *)0x40023820))
-#define I2C3_PP_R               (*((volatile unsigned long *)0x40023FC0))
-#define I2C3_PC_R               (*((volatile unsigned long *)0x40023FC4))
+#define I2C3_MSA_R              HWREG(0x40023000)
+#define I2C3_MCS_R              HWREG(0x40023004)
+#define I2C3_MDR_R              HWREG(0x40023008)
+#define I2C3_MTPR_R             HWREG(0x4002300C)
+#define I2C3_MIMR_R             HWREG(0x40023010)
+#define I2C3_MRIS_R             HWREG(0x40023014)
+#define I2C3_MMIS_R             HWREG(0x40023018)
+#define I2C3_MICR_R             HWREG(0x4002301C)
+#define I2C3_MCR_R              HWREG(0x40023020)
+#define I2C3_MCLKOCNT_R         HWREG(0x40023024)
+#define I2C3_MBMON_R            HWREG(0x4002302C)
+#define I2C3_MCR2_R             HWREG(0x40023038)
+#define I2C3_SOAR_R             HWREG(0x40023800)
+#define I2C3_SCSR_R             HWREG(0x40023804)
+#define I2C3_SDR_R              HWREG(0x40023808)
+#define I2C3_SIMR_R             HWREG(0x4002380C)
+#define I2C3_SRIS_R             HWREG(0x40023810)
+#define I2C3_SMIS_R             HWREG(0x40023814)
+#define I2C3_SICR_R             HWREG(0x40023818)
+#define I2C3_SOAR2_R            HWREG(0x4002381C)
+#define I2C3_SACKCTL_R          HWREG(0x40023820)
+#define I2C3_PP_R               HWREG(0x40023FC0)
+#define I2C3_PC_R               HWREG(0x40023FC4)
 
 //*****************************************************************************
 //
@@ -667,30 +682,30 @@
 //
 //*****************************************************************************
 #define GPIO_PORTE_DATA_BITS_R  ((volatile unsigned long *)0x40024000)
-#define GPIO_PORTE_DATA_R       (*((volatile unsigned long *)0x400243FC))
-#define GPIO_PORTE_DIR_R        (*((volatile unsigned long *)0x40024400))
-#define GPIO_PORTE_IS_R         (*((volatile unsigned long *)0x40024404))
-#define GPIO_PORTE_IBE_R        (*((volatile unsigned long *)0x40024408))
-#define GPIO_PORTE_IEV_R        (*((volatile unsigned long *)0x4002440C))
-#define GPIO_PORTE_IM_R         (*((volatile unsigned long *)0x40024410))
-#define GPIO_PORTE_RIS_R        (*((volatile unsigned long *)0x40024414))
-#define GPIO_PORTE_MIS_R        (*((volatile unsigned long *)0x40024418))
-#define GPIO_PORTE_ICR_R        (*((volatile unsigned long *)0x4002441C))
-#define GPIO_PORTE_AFSEL_R      (*((volatile unsigned long *)0x40024420))
-#define GPIO_PORTE_DR2R_R       (*((volatile unsigned long *)0x40024500))
-#define GPIO_PORTE_DR4R_R       (*((volatile unsigned long *)0x40024504))
-#define GPIO_PORTE_DR8R_R       (*((volatile unsigned long *)0x40024508))
-#define GPIO_PORTE_ODR_R        (*((volatile unsigned long *)0x4002450C))
-#define GPIO_PORTE_PUR_R        (*((volatile unsigned long *)0x40024510))
-#define GPIO_PORTE_PDR_R        (*((volatile unsigned long *)0x40024514))
-#define GPIO_PORTE_SLR_R        (*((volatile unsigned long *)0x40024518))
-#define GPIO_PORTE_DEN_R        (*((volatile unsigned long *)0x4002451C))
-#define GPIO_PORTE_LOCK_R       (*((volatile unsigned long *)0x40024520))
-#define GPIO_PORTE_CR_R         (*((volatile unsigned long *)0x40024524))
-#define GPIO_PORTE_AMSEL_R      (*((volatile unsigned long *)0x40024528))
-#define GPIO_PORTE_PCTL_R       (*((volatile unsigned long *)0x4002452C))
-#define GPIO_PORTE_ADCCTL_R     (*((volatile unsigned long *)0x40024530))
-#define GPIO_PORTE_DMACTL_R     (*((volatile unsigned long *)0x40024534))
+#define GPIO_PORTE_DATA_R       HWREG(0x400243FC)
+#define GPIO_PORTE_DIR_R        HWREG(0x40024400)
+#define GPIO_PORTE_IS_R         HWREG(0x40024404)
+#define GPIO_PORTE_IBE_R        HWREG(0x40024408)
+#define GPIO_PORTE_IEV_R        HWREG(0x4002440C)
+#define GPIO_PORTE_IM_R         HWREG(0x40024410)
+#define GPIO_PORTE_RIS_R        HWREG(0x40024414)
+#define GPIO_PORTE_MIS_R        HWREG(0x40024418)
+#define GPIO_PORTE_ICR_R        HWREG(0x4002441C)
+#define GPIO_PORTE_AFSEL_R      HWREG(0x40024420)
+#define GPIO_PORTE_DR2R_R       HWREG(0x40024500)
+#define GPIO_PORTE_DR4R_R       HWREG(0x40024504)
+#define GPIO_PORTE_DR8R_R       HWREG(0x40024508)
+#define GPIO_PORTE_ODR_R        HWREG(0x4002450C)
+#define GPIO_PORTE_PUR_R        HWREG(0x40024510)
+#define GPIO_PORTE_PDR_R        HWREG(0x40024514)
+#define GPIO_PORTE_SLR_R        HWREG(0x40024518)
+#define GPIO_PORTE_DEN_R        HWREG(0x4002451C)
+#define GPIO_PORTE_LOCK_R       HWREG(0x40024520)
+#define GPIO_PORTE_CR_R         HWREG(0x40024524)
+#define GPIO_PORTE_AMSEL_R      HWREG(0x40024528)
+#define GPIO_PORTE_PCTL_R       HWREG(0x4002452C)
+#define GPIO_PORTE_ADCCTL_R     HWREG(0x40024530)
+#define GPIO_PORTE_DMACTL_R     HWREG(0x40024534)
 
 //*****************************************************************************
 //
@@ -698,873 +713,873 @@
 //
 //*****************************************************************************
 #define GPIO_PORTF_DATA_BITS_R  ((volatile unsigned long *)0x40025000)
-#define GPIO_PORTF_DATA_R       (*((volatile unsigned long *)0x400253FC))
-#define GPIO_PORTF_DIR_R        (*((volatile unsigned long *)0x40025400))
-#define GPIO_PORTF_IS_R         (*((volatile unsigned long *)0x40025404))
-#define GPIO_PORTF_IBE_R        (*((volatile unsigned long *)0x40025408))
-#define GPIO_PORTF_IEV_R        (*((volatile unsigned long *)0x4002540C))
-#define GPIO_PORTF_IM_R         (*((volatile unsigned long *)0x40025410))
-#define GPIO_PORTF_RIS_R        (*((volatile unsigned long *)0x40025414))
-#define GPIO_PORTF_MIS_R        (*((volatile unsigned long *)0x40025418))
-#define GPIO_PORTF_ICR_R        (*((volatile unsigned long *)0x4002541C))
-#define GPIO_PORTF_AFSEL_R      (*((volatile unsigned long *)0x40025420))
-#define GPIO_PORTF_DR2R_R       (*((volatile unsigned long *)0x40025500))
-#define GPIO_PORTF_DR4R_R       (*((volatile unsigned long *)0x40025504))
-#define GPIO_PORTF_DR8R_R       (*((volatile unsigned long *)0x40025508))
-#define GPIO_PORTF_ODR_R        (*((volatile unsigned long *)0x4002550C))
-#define GPIO_PORTF_PUR_R        (*((volatile unsigned long *)0x40025510))
-#define GPIO_PORTF_PDR_R        (*((volatile unsigned long *)0x40025514))
-#define GPIO_PORTF_SLR_R        (*((volatile unsigned long *)0x40025518))
-#define GPIO_PORTF_DEN_R        (*((volatile unsigned long *)0x4002551C))
-#define GPIO_PORTF_LOCK_R       (*((volatile unsigned long *)0x40025520))
-#define GPIO_PORTF_CR_R         (*((volatile unsigned long *)0x40025524))
-#define GPIO_PORTF_AMSEL_R      (*((volatile unsigned long *)0x40025528))
-#define GPIO_PORTF_PCTL_R       (*((volatile unsigned long *)0x4002552C))
-#define GPIO_PORTF_ADCCTL_R     (*((volatile unsigned long *)0x40025530))
-#define GPIO_PORTF_DMACTL_R     (*((volatile unsigned long *)0x40025534))
+#define GPIO_PORTF_DATA_R       HWREG(0x400253FC)
+#define GPIO_PORTF_DIR_R        HWREG(0x40025400)
+#define GPIO_PORTF_IS_R         HWREG(0x40025404)
+#define GPIO_PORTF_IBE_R        HWREG(0x40025408)
+#define GPIO_PORTF_IEV_R        HWREG(0x4002540C)
+#define GPIO_PORTF_IM_R         HWREG(0x40025410)
+#define GPIO_PORTF_RIS_R        HWREG(0x40025414)
+#define GPIO_PORTF_MIS_R        HWREG(0x40025418)
+#define GPIO_PORTF_ICR_R        HWREG(0x4002541C)
+#define GPIO_PORTF_AFSEL_R      HWREG(0x40025420)
+#define GPIO_PORTF_DR2R_R       HWREG(0x40025500)
+#define GPIO_PORTF_DR4R_R       HWREG(0x40025504)
+#define GPIO_PORTF_DR8R_R       HWREG(0x40025508)
+#define GPIO_PORTF_ODR_R        HWREG(0x4002550C)
+#define GPIO_PORTF_PUR_R        HWREG(0x40025510)
+#define GPIO_PORTF_PDR_R        HWREG(0x40025514)
+#define GPIO_PORTF_SLR_R        HWREG(0x40025518)
+#define GPIO_PORTF_DEN_R        HWREG(0x4002551C)
+#define GPIO_PORTF_LOCK_R       HWREG(0x40025520)
+#define GPIO_PORTF_CR_R         HWREG(0x40025524)
+#define GPIO_PORTF_AMSEL_R      HWREG(0x40025528)
+#define GPIO_PORTF_PCTL_R       HWREG(0x4002552C)
+#define GPIO_PORTF_ADCCTL_R     HWREG(0x40025530)
+#define GPIO_PORTF_DMACTL_R     HWREG(0x40025534)
 
 //*****************************************************************************
 //
 // PWM registers (PWM0)
 //
 //*****************************************************************************
-#define PWM0_CTL_R              (*((volatile unsigned long *)0x40028000))
-#define PWM0_SYNC_R             (*((volatile unsigned long *)0x40028004))
-#define PWM0_ENABLE_R           (*((volatile unsigned long *)0x40028008))
-#define PWM0_INVERT_R           (*((volatile unsigned long *)0x4002800C))
-#define PWM0_FAULT_R            (*((volatile unsigned long *)0x40028010))
-#define PWM0_INTEN_R            (*((volatile unsigned long *)0x40028014))
-#define PWM0_RIS_R              (*((volatile unsigned long *)0x40028018))
-#define PWM0_ISC_R              (*((volatile unsigned long *)0x4002801C))
-#define PWM0_STATUS_R           (*((volatile unsigned long *)0x40028020))
-#define PWM0_FAULTVAL_R         (*((volatile unsigned long *)0x40028024))
-#define PWM0_ENUPD_R            (*((volatile unsigned long *)0x40028028))
-#define PWM0_0_CTL_R            (*((volatile unsigned long *)0x40028040))
-#define PWM0_0_INTEN_R          (*((volatile unsigned long *)0x40028044))
-#define PWM0_0_RIS_R            (*((volatile unsigned long *)0x40028048))
-#define PWM0_0_ISC_R            (*((volatile unsigned long *)0x4002804C))
-#define PWM0_0_LOAD_R           (*((volatile unsigned long *)0x40028050))
-#define PWM0_0_COUNT_R          (*((volatile unsigned long *)0x40028054))
-#define PWM0_0_CMPA_R           (*((volatile unsigned long *)0x40028058))
-#define PWM0_0_CMPB_R           (*((volatile unsigned long *)0x4002805C))
-#define PWM0_0_GENA_R           (*((volatile unsigned long *)0x40028060))
-#define PWM0_0_GENB_R           (*((volatile unsigned long *)0x40028064))
-#define PWM0_0_DBCTL_R          (*((volatile unsigned long *)0x40028068))
-#define PWM0_0_DBRISE_R         (*((volatile unsigned long *)0x4002806C))
-#define PWM0_0_DBFALL_R         (*((volatile unsigned long *)0x40028070))
-#define PWM0_0_FLTSRC0_R        (*((volatile unsigned long *)0x40028074))
-#define PWM0_0_FLTSRC1_R        (*((volatile unsigned long *)0x40028078))
-#define PWM0_0_MINFLTPER_R      (*((volatile unsigned long *)0x4002807C))
-#define PWM0_1_CTL_R            (*((volatile unsigned long *)0x40028080))
-#define PWM0_1_INTEN_R          (*((volatile unsigned long *)0x40028084))
-#define PWM0_1_RIS_R            (*((volatile unsigned long *)0x40028088))
-#define PWM0_1_ISC_R            (*((volatile unsigned long *)0x4002808C))
-#define PWM0_1_LOAD_R           (*((volatile unsigned long *)0x40028090))
-#define PWM0_1_COUNT_R          (*((volatile unsigned long *)0x40028094))
-#define PWM0_1_CMPA_R           (*((volatile unsigned long *)0x40028098))
-#define PWM0_1_CMPB_R           (*((volatile unsigned long *)0x4002809C))
-#define PWM0_1_GENA_R           (*((volatile unsigned long *)0x400280A0))
-#define PWM0_1_GENB_R           (*((volatile unsigned long *)0x400280A4))
-#define PWM0_1_DBCTL_R          (*((volatile unsigned long *)0x400280A8))
-#define PWM0_1_DBRISE_R         (*((volatile unsigned long *)0x400280AC))
-#define PWM0_1_DBFALL_R         (*((volatile unsigned long *)0x400280B0))
-#define PWM0_1_FLTSRC0_R        (*((volatile unsigned long *)0x400280B4))
-#define PWM0_1_FLTSRC1_R        (*((volatile unsigned long *)0x400280B8))
-#define PWM0_1_MINFLTPER_R      (*((volatile unsigned long *)0x400280BC))
-#define PWM0_2_CTL_R            (*((volatile unsigned long *)0x400280C0))
-#define PWM0_2_INTEN_R          (*((volatile unsigned long *)0x400280C4))
-#define PWM0_2_RIS_R            (*((volatile unsigned long *)0x400280C8))
-#define PWM0_2_ISC_R            (*((volatile unsigned long *)0x400280CC))
-#define PWM0_2_LOAD_R           (*((volatile unsigned long *)0x400280D0))
-#define PWM0_2_COUNT_R          (*((volatile unsigned long *)0x400280D4))
-#define PWM0_2_CMPA_R           (*((volatile unsigned long *)0x400280D8))
-#define PWM0_2_CMPB_R           (*((volatile unsigned long *)0x400280DC))
-#define PWM0_2_GENA_R           (*((volatile unsigned long *)0x400280E0))
-#define PWM0_2_GENB_R           (*((volatile unsigned long *)0x400280E4))
-#define PWM0_2_DBCTL_R          (*((volatile unsigned long *)0x400280E8))
-#define PWM0_2_DBRISE_R         (*((volatile unsigned long *)0x400280EC))
-#define PWM0_2_DBFALL_R         (*((volatile unsigned long *)0x400280F0))
-#define PWM0_2_FLTSRC0_R        (*((volatile unsigned long *)0x400280F4))
-#define PWM0_2_FLTSRC1_R        (*((volatile unsigned long *)0x400280F8))
-#define PWM0_2_MINFLTPER_R      (*((volatile unsigned long *)0x400280FC))
-#define PWM0_3_CTL_R            (*((volatile unsigned long *)0x40028100))
-#define PWM0_3_INTEN_R          (*((volatile unsigned long *)0x40028104))
-#define PWM0_3_RIS_R            (*((volatile unsigned long *)0x40028108))
-#define PWM0_3_ISC_R            (*((volatile unsigned long *)0x4002810C))
-#define PWM0_3_LOAD_R           (*((volatile unsigned long *)0x40028110))
-#define PWM0_3_COUNT_R          (*((volatile unsigned long *)0x40028114))
-#define PWM0_3_CMPA_R           (*((volatile unsigned long *)0x40028118))
-#define PWM0_3_CMPB_R           (*((volatile unsigned long *)0x4002811C))
-#define PWM0_3_GENA_R           (*((volatile unsigned long *)0x40028120))
-#define PWM0_3_GENB_R           (*((volatile unsigned long *)0x40028124))
-#define PWM0_3_DBCTL_R          (*((volatile unsigned long *)0x40028128))
-#define PWM0_3_DBRISE_R         (*((volatile unsigned long *)0x4002812C))
-#define PWM0_3_DBFALL_R         (*((volatile unsigned long *)0x40028130))
-#define PWM0_3_FLTSRC0_R        (*((volatile unsigned long *)0x40028134))
-#define PWM0_3_FLTSRC1_R        (*((volatile unsigned long *)0x40028138))
-#define PWM0_3_MINFLTPER_R      (*((volatile unsigned long *)0x4002813C))
-#define PWM0_0_FLTSEN_R         (*((volatile unsigned long *)0x40028800))
-#define PWM0_0_FLTSTAT0_R       (*((volatile unsigned long *)0x40028804))
-#define PWM0_0_FLTSTAT1_R       (*((volatile unsigned long *)0x40028808))
-#define PWM0_1_FLTSEN_R         (*((volatile unsigned long *)0x40028880))
-#define PWM0_1_FLTSTAT0_R       (*((volatile unsigned long *)0x40028884))
-#define PWM0_1_FLTSTAT1_R       (*((volatile unsigned long *)0x40028888))
-#define PWM0_2_FLTSTAT0_R       (*((volatile unsigned long *)0x40028904))
-#define PWM0_2_FLTSTAT1_R       (*((volatile unsigned long *)0x40028908))
-#define PWM0_3_FLTSTAT0_R       (*((volatile unsigned long *)0x40028984))
-#define PWM0_3_FLTSTAT1_R       (*((volatile unsigned long *)0x40028988))
-#define PWM0_PP_R               (*((volatile unsigned long *)0x40028FC0))
+#define PWM0_CTL_R              HWREG(0x40028000)
+#define PWM0_SYNC_R             HWREG(0x40028004)
+#define PWM0_ENABLE_R           HWREG(0x40028008)
+#define PWM0_INVERT_R           HWREG(0x4002800C)
+#define PWM0_FAULT_R            HWREG(0x40028010)
+#define PWM0_INTEN_R            HWREG(0x40028014)
+#define PWM0_RIS_R              HWREG(0x40028018)
+#define PWM0_ISC_R              HWREG(0x4002801C)
+#define PWM0_STATUS_R           HWREG(0x40028020)
+#define PWM0_FAULTVAL_R         HWREG(0x40028024)
+#define PWM0_ENUPD_R            HWREG(0x40028028)
+#define PWM0_0_CTL_R            HWREG(0x40028040)
+#define PWM0_0_INTEN_R          HWREG(0x40028044)
+#define PWM0_0_RIS_R            HWREG(0x40028048)
+#define PWM0_0_ISC_R            HWREG(0x4002804C)
+#define PWM0_0_LOAD_R           HWREG(0x40028050)
+#define PWM0_0_COUNT_R          HWREG(0x40028054)
+#define PWM0_0_CMPA_R           HWREG(0x40028058)
+#define PWM0_0_CMPB_R           HWREG(0x4002805C)
+#define PWM0_0_GENA_R           HWREG(0x40028060)
+#define PWM0_0_GENB_R           HWREG(0x40028064)
+#define PWM0_0_DBCTL_R          HWREG(0x40028068)
+#define PWM0_0_DBRISE_R         HWREG(0x4002806C)
+#define PWM0_0_DBFALL_R         HWREG(0x40028070)
+#define PWM0_0_FLTSRC0_R        HWREG(0x40028074)
+#define PWM0_0_FLTSRC1_R        HWREG(0x40028078)
+#define PWM0_0_MINFLTPER_R      HWREG(0x4002807C)
+#define PWM0_1_CTL_R            HWREG(0x40028080)
+#define PWM0_1_INTEN_R          HWREG(0x40028084)
+#define PWM0_1_RIS_R            HWREG(0x40028088)
+#define PWM0_1_ISC_R            HWREG(0x4002808C)
+#define PWM0_1_LOAD_R           HWREG(0x40028090)
+#define PWM0_1_COUNT_R          HWREG(0x40028094)
+#define PWM0_1_CMPA_R           HWREG(0x40028098)
+#define PWM0_1_CMPB_R           HWREG(0x4002809C)
+#define PWM0_1_GENA_R           HWREG(0x400280A0)
+#define PWM0_1_GENB_R           HWREG(0x400280A4)
+#define PWM0_1_DBCTL_R          HWREG(0x400280A8)
+#define PWM0_1_DBRISE_R         HWREG(0x400280AC)
+#define PWM0_1_DBFALL_R         HWREG(0x400280B0)
+#define PWM0_1_FLTSRC0_R        HWREG(0x400280B4)
+#define PWM0_1_FLTSRC1_R        HWREG(0x400280B8)
+#define PWM0_1_MINFLTPER_R      HWREG(0x400280BC)
+#define PWM0_2_CTL_R            HWREG(0x400280C0)
+#define PWM0_2_INTEN_R          HWREG(0x400280C4)
+#define PWM0_2_RIS_R            HWREG(0x400280C8)
+#define PWM0_2_ISC_R            HWREG(0x400280CC)
+#define PWM0_2_LOAD_R           HWREG(0x400280D0)
+#define PWM0_2_COUNT_R          HWREG(0x400280D4)
+#define PWM0_2_CMPA_R           HWREG(0x400280D8)
+#define PWM0_2_CMPB_R           HWREG(0x400280DC)
+#define PWM0_2_GENA_R           HWREG(0x400280E0)
+#define PWM0_2_GENB_R           HWREG(0x400280E4)
+#define PWM0_2_DBCTL_R          HWREG(0x400280E8)
+#define PWM0_2_DBRISE_R         HWREG(0x400280EC)
+#define PWM0_2_DBFALL_R         HWREG(0x400280F0)
+#define PWM0_2_FLTSRC0_R        HWREG(0x400280F4)
+#define PWM0_2_FLTSRC1_R        HWREG(0x400280F8)
+#define PWM0_2_MINFLTPER_R      HWREG(0x400280FC)
+#define PWM0_3_CTL_R            HWREG(0x40028100)
+#define PWM0_3_INTEN_R          HWREG(0x40028104)
+#define PWM0_3_RIS_R            HWREG(0x40028108)
+#define PWM0_3_ISC_R            HWREG(0x4002810C)
+#define PWM0_3_LOAD_R           HWREG(0x40028110)
+#define PWM0_3_COUNT_R          HWREG(0x40028114)
+#define PWM0_3_CMPA_R           HWREG(0x40028118)
+#define PWM0_3_CMPB_R           HWREG(0x4002811C)
+#define PWM0_3_GENA_R           HWREG(0x40028120)
+#define PWM0_3_GENB_R           HWREG(0x40028124)
+#define PWM0_3_DBCTL_R          HWREG(0x40028128)
+#define PWM0_3_DBRISE_R         HWREG(0x4002812C)
+#define PWM0_3_DBFALL_R         HWREG(0x40028130)
+#define PWM0_3_FLTSRC0_R        HWREG(0x40028134)
+#define PWM0_3_FLTSRC1_R        HWREG(0x40028138)
+#define PWM0_3_MINFLTPER_R      HWREG(0x4002813C)
+#define PWM0_0_FLTSEN_R         HWREG(0x40028800)
+#define PWM0_0_FLTSTAT0_R       HWREG(0x40028804)
+#define PWM0_0_FLTSTAT1_R       HWREG(0x40028808)
+#define PWM0_1_FLTSEN_R         HWREG(0x40028880)
+#define PWM0_1_FLTSTAT0_R       HWREG(0x40028884)
+#define PWM0_1_FLTSTAT1_R       HWREG(0x40028888)
+#define PWM0_2_FLTSTAT0_R       HWREG(0x40028904)
+#define PWM0_2_FLTSTAT1_R       HWREG(0x40028908)
+#define PWM0_3_FLTSTAT0_R       HWREG(0x40028984)
+#define PWM0_3_FLTSTAT1_R       HWREG(0x40028988)
+#define PWM0_PP_R               HWREG(0x40028FC0)
 
 //*****************************************************************************
 //
 // PWM registers (PWM1)
 //
 //*****************************************************************************
-#define PWM1_CTL_R              (*((volatile unsigned long *)0x40029000))
-#define PWM1_SYNC_R             (*((volatile unsigned long *)0x40029004))
-#define PWM1_ENABLE_R           (*((volatile unsigned long *)0x40029008))
-#define PWM1_INVERT_R           (*((volatile unsigned long *)0x4002900C))
-#define PWM1_FAULT_R            (*((volatile unsigned long *)0x40029010))
-#define PWM1_INTEN_R            (*((volatile unsigned long *)0x40029014))
-#define PWM1_RIS_R              (*((volatile unsigned long *)0x40029018))
-#define PWM1_ISC_R              (*((volatile unsigned long *)0x4002901C))
-#define PWM1_STATUS_R           (*((volatile unsigned long *)0x40029020))
-#define PWM1_FAULTVAL_R         (*((volatile unsigned long *)0x40029024))
-#define PWM1_ENUPD_R            (*((volatile unsigned long *)0x40029028))
-#define PWM1_0_CTL_R            (*((volatile unsigned long *)0x40029040))
-#define PWM1_0_INTEN_R          (*((volatile unsigned long *)0x40029044))
-#define PWM1_0_RIS_R            (*((volatile unsigned long *)0x40029048))
-#define PWM1_0_ISC_R            (*((volatile unsigned long *)0x4002904C))
-#define PWM1_0_LOAD_R           (*((volatile unsigned long *)0x40029050))
-#define PWM1_0_COUNT_R          (*((volatile unsigned long *)0x40029054))
-#define PWM1_0_CMPA_R           (*((volatile unsigned long *)0x40029058))
-#define PWM1_0_CMPB_R           (*((volatile unsigned long *)0x4002905C))
-#define PWM1_0_GENA_R           (*((volatile unsigned long *)0x40029060))
-#define PWM1_0_GENB_R           (*((volatile unsigned long *)0x40029064))
-#define PWM1_0_DBCTL_R          (*((volatile unsigned long *)0x40029068))
-#define PWM1_0_DBRISE_R         (*((volatile unsigned long *)0x4002906C))
-#define PWM1_0_DBFALL_R         (*((volatile unsigned long *)0x40029070))
-#define PWM1_0_FLTSRC0_R        (*((volatile unsigned long *)0x40029074))
-#define PWM1_0_FLTSRC1_R        (*((volatile unsigned long *)0x40029078))
-#define PWM1_0_MINFLTPER_R      (*((volatile unsigned long *)0x4002907C))
-#define PWM1_1_CTL_R            (*((volatile unsigned long *)0x40029080))
-#define PWM1_1_INTEN_R          (*((volatile unsigned long *)0x40029084))
-#define PWM1_1_RIS_R            (*((volatile unsigned long *)0x40029088))
-#define PWM1_1_ISC_R            (*((volatile unsigned long *)0x4002908C))
-#define PWM1_1_LOAD_R           (*((volatile unsigned long *)0x40029090))
-#define PWM1_1_COUNT_R          (*((volatile unsigned long *)0x40029094))
-#define PWM1_1_CMPA_R           (*((volatile unsigned long *)0x40029098))
-#define PWM1_1_CMPB_R           (*((volatile unsigned long *)0x4002909C))
-#define PWM1_1_GENA_R           (*((volatile unsigned long *)0x400290A0))
-#define PWM1_1_GENB_R           (*((volatile unsigned long *)0x400290A4))
-#define PWM1_1_DBCTL_R          (*((volatile unsigned long *)0x400290A8))
-#define PWM1_1_DBRISE_R         (*((volatile unsigned long *)0x400290AC))
-#define PWM1_1_DBFALL_R         (*((volatile unsigned long *)0x400290B0))
-#define PWM1_1_FLTSRC0_R        (*((volatile unsigned long *)0x400290B4))
-#define PWM1_1_FLTSRC1_R        (*((volatile unsigned long *)0x400290B8))
-#define PWM1_1_MINFLTPER_R      (*((volatile unsigned long *)0x400290BC))
-#define PWM1_2_CTL_R            (*((volatile unsigned long *)0x400290C0))
-#define PWM1_2_INTEN_R          (*((volatile unsigned long *)0x400290C4))
-#define PWM1_2_RIS_R            (*((volatile unsigned long *)0x400290C8))
-#define PWM1_2_ISC_R            (*((volatile unsigned long *)0x400290CC))
-#define PWM1_2_LOAD_R           (*((volatile unsigned long *)0x400290D0))
-#define PWM1_2_COUNT_R          (*((volatile unsigned long *)0x400290D4))
-#define PWM1_2_CMPA_R           (*((volatile unsigned long *)0x400290D8))
-#define PWM1_2_CMPB_R           (*((volatile unsigned long *)0x400290DC))
-#define PWM1_2_GENA_R           (*((volatile unsigned long *)0x400290E0))
-#define PWM1_2_GENB_R           (*((volatile unsigned long *)0x400290E4))
-#define PWM1_2_DBCTL_R          (*((volatile unsigned long *)0x400290E8))
-#define PWM1_2_DBRISE_R         (*((volatile unsigned long *)0x400290EC))
-#define PWM1_2_DBFALL_R         (*((volatile unsigned long *)0x400290F0))
-#define PWM1_2_FLTSRC0_R        (*((volatile unsigned long *)0x400290F4))
-#define PWM1_2_FLTSRC1_R        (*((volatile unsigned long *)0x400290F8))
-#define PWM1_2_MINFLTPER_R      (*((volatile unsigned long *)0x400290FC))
-#define PWM1_3_CTL_R            (*((volatile unsigned long *)0x40029100))
-#define PWM1_3_INTEN_R          (*((volatile unsigned long *)0x40029104))
-#define PWM1_3_RIS_R            (*((volatile unsigned long *)0x40029108))
-#define PWM1_3_ISC_R            (*((volatile unsigned long *)0x4002910C))
-#define PWM1_3_LOAD_R           (*((volatile unsigned long *)0x40029110))
-#define PWM1_3_COUNT_R          (*((volatile unsigned long *)0x40029114))
-#define PWM1_3_CMPA_R           (*((volatile unsigned long *)0x40029118))
-#define PWM1_3_CMPB_R           (*((volatile unsigned long *)0x4002911C))
-#define PWM1_3_GENA_R           (*((volatile unsigned long *)0x40029120))
-#define PWM1_3_GENB_R           (*((volatile unsigned long *)0x40029124))
-#define PWM1_3_DBCTL_R          (*((volatile unsigned long *)0x40029128))
-#define PWM1_3_DBRISE_R         (*((volatile unsigned long *)0x4002912C))
-#define PWM1_3_DBFALL_R         (*((volatile unsigned long *)0x40029130))
-#define PWM1_3_FLTSRC0_R        (*((volatile unsigned long *)0x40029134))
-#define PWM1_3_FLTSRC1_R        (*((volatile unsigned long *)0x40029138))
-#define PWM1_3_MINFLTPER_R      (*((volatile unsigned long *)0x4002913C))
-#define PWM1_0_FLTSEN_R         (*((volatile unsigned long *)0x40029800))
-#define PWM1_0_FLTSTAT0_R       (*((volatile unsigned long *)0x40029804))
-#define PWM1_0_FLTSTAT1_R       (*((volatile unsigned long *)0x40029808))
-#define PWM1_1_FLTSEN_R         (*((volatile unsigned long *)0x40029880))
-#define PWM1_1_FLTSTAT0_R       (*((volatile unsigned long *)0x40029884))
-#define PWM1_1_FLTSTAT1_R       (*((volatile unsigned long *)0x40029888))
-#define PWM1_2_FLTSTAT0_R       (*((volatile unsigned long *)0x40029904))
-#define PWM1_2_FLTSTAT1_R       (*((volatile unsigned long *)0x40029908))
-#define PWM1_3_FLTSTAT0_R       (*((volatile unsigned long *)0x40029984))
-#define PWM1_3_FLTSTAT1_R       (*((volatile unsigned long *)0x40029988))
-#define PWM1_PP_R               (*((volatile unsigned long *)0x40029FC0))
+#define PWM1_CTL_R              HWREG(0x40029000)
+#define PWM1_SYNC_R             HWREG(0x40029004)
+#define PWM1_ENABLE_R           HWREG(0x40029008)
+#define PWM1_INVERT_R           HWREG(0x4002900C)
+#define PWM1_FAULT_R            HWREG(0x40029010)
+#define PWM1_INTEN_R            HWREG(0x40029014)
+#define PWM1_RIS_R              HWREG(0x40029018)
+#define PWM1_ISC_R              HWREG(0x4002901C)
+#define PWM1_STATUS_R           HWREG(0x40029020)
+#define PWM1_FAULTVAL_R         HWREG(0x40029024)
+#define PWM1_ENUPD_R            HWREG(0x40029028)
+#define PWM1_0_CTL_R            HWREG(0x40029040)
+#define PWM1_0_INTEN_R          HWREG(0x40029044)
+#define PWM1_0_RIS_R            HWREG(0x40029048)
+#define PWM1_0_ISC_R            HWREG(0x4002904C)
+#define PWM1_0_LOAD_R           HWREG(0x40029050)
+#define PWM1_0_COUNT_R          HWREG(0x40029054)
+#define PWM1_0_CMPA_R           HWREG(0x40029058)
+#define PWM1_0_CMPB_R           HWREG(0x4002905C)
+#define PWM1_0_GENA_R           HWREG(0x40029060)
+#define PWM1_0_GENB_R           HWREG(0x40029064)
+#define PWM1_0_DBCTL_R          HWREG(0x40029068)
+#define PWM1_0_DBRISE_R         HWREG(0x4002906C)
+#define PWM1_0_DBFALL_R         HWREG(0x40029070)
+#define PWM1_0_FLTSRC0_R        HWREG(0x40029074)
+#define PWM1_0_FLTSRC1_R        HWREG(0x40029078)
+#define PWM1_0_MINFLTPER_R      HWREG(0x4002907C)
+#define PWM1_1_CTL_R            HWREG(0x40029080)
+#define PWM1_1_INTEN_R          HWREG(0x40029084)
+#define PWM1_1_RIS_R            HWREG(0x40029088)
+#define PWM1_1_ISC_R            HWREG(0x4002908C)
+#define PWM1_1_LOAD_R           HWREG(0x40029090)
+#define PWM1_1_COUNT_R          HWREG(0x40029094)
+#define PWM1_1_CMPA_R           HWREG(0x40029098)
+#define PWM1_1_CMPB_R           HWREG(0x4002909C)
+#define PWM1_1_GENA_R           HWREG(0x400290A0)
+#define PWM1_1_GENB_R           HWREG(0x400290A4)
+#define PWM1_1_DBCTL_R          HWREG(0x400290A8)
+#define PWM1_1_DBRISE_R         HWREG(0x400290AC)
+#define PWM1_1_DBFALL_R         HWREG(0x400290B0)
+#define PWM1_1_FLTSRC0_R        HWREG(0x400290B4)
+#define PWM1_1_FLTSRC1_R        HWREG(0x400290B8)
+#define PWM1_1_MINFLTPER_R      HWREG(0x400290BC)
+#define PWM1_2_CTL_R            HWREG(0x400290C0)
+#define PWM1_2_INTEN_R          HWREG(0x400290C4)
+#define PWM1_2_RIS_R            HWREG(0x400290C8)
+#define PWM1_2_ISC_R            HWREG(0x400290CC)
+#define PWM1_2_LOAD_R           HWREG(0x400290D0)
+#define PWM1_2_COUNT_R          HWREG(0x400290D4)
+#define PWM1_2_CMPA_R           HWREG(0x400290D8)
+#define PWM1_2_CMPB_R           HWREG(0x400290DC)
+#define PWM1_2_GENA_R           HWREG(0x400290E0)
+#define PWM1_2_GENB_R           HWREG(0x400290E4)
+#define PWM1_2_DBCTL_R          HWREG(0x400290E8)
+#define PWM1_2_DBRISE_R         HWREG(0x400290EC)
+#define PWM1_2_DBFALL_R         HWREG(0x400290F0)
+#define PWM1_2_FLTSRC0_R        HWREG(0x400290F4)
+#define PWM1_2_FLTSRC1_R        HWREG(0x400290F8)
+#define PWM1_2_MINFLTPER_R      HWREG(0x400290FC)
+#define PWM1_3_CTL_R            HWREG(0x40029100)
+#define PWM1_3_INTEN_R          HWREG(0x40029104)
+#define PWM1_3_RIS_R            HWREG(0x40029108)
+#define PWM1_3_ISC_R            HWREG(0x4002910C)
+#define PWM1_3_LOAD_R           HWREG(0x40029110)
+#define PWM1_3_COUNT_R          HWREG(0x40029114)
+#define PWM1_3_CMPA_R           HWREG(0x40029118)
+#define PWM1_3_CMPB_R           HWREG(0x4002911C)
+#define PWM1_3_GENA_R           HWREG(0x40029120)
+#define PWM1_3_GENB_R           HWREG(0x40029124)
+#define PWM1_3_DBCTL_R          HWREG(0x40029128)
+#define PWM1_3_DBRISE_R         HWREG(0x4002912C)
+#define PWM1_3_DBFALL_R         HWREG(0x40029130)
+#define PWM1_3_FLTSRC0_R        HWREG(0x40029134)
+#define PWM1_3_FLTSRC1_R        HWREG(0x40029138)
+#define PWM1_3_MINFLTPER_R      HWREG(0x4002913C)
+#define PWM1_0_FLTSEN_R         HWREG(0x40029800)
+#define PWM1_0_FLTSTAT0_R       HWREG(0x40029804)
+#define PWM1_0_FLTSTAT1_R       HWREG(0x40029808)
+#define PWM1_1_FLTSEN_R         HWREG(0x40029880)
+#define PWM1_1_FLTSTAT0_R       HWREG(0x40029884)
+#define PWM1_1_FLTSTAT1_R       HWREG(0x40029888)
+#define PWM1_2_FLTSTAT0_R       HWREG(0x40029904)
+#define PWM1_2_FLTSTAT1_R       HWREG(0x40029908)
+#define PWM1_3_FLTSTAT0_R       HWREG(0x40029984)
+#define PWM1_3_FLTSTAT1_R       HWREG(0x40029988)
+#define PWM1_PP_R               HWREG(0x40029FC0)
 
 //*****************************************************************************
 //
 // QEI registers (QEI0)
 //
 //*****************************************************************************
-#define QEI0_CTL_R              (*((volatile unsigned long *)0x4002C000))
-#define QEI0_STAT_R             (*((volatile unsigned long *)0x4002C004))
-#define QEI0_POS_R              (*((volatile unsigned long *)0x4002C008))
-#define QEI0_MAXPOS_R           (*((volatile unsigned long *)0x4002C00C))
-#define QEI0_LOAD_R             (*((volatile unsigned long *)0x4002C010))
-#define QEI0_TIME_R             (*((volatile unsigned long *)0x4002C014))
-#define QEI0_COUNT_R            (*((volatile unsigned long *)0x4002C018))
-#define QEI0_SPEED_R            (*((volatile unsigned long *)0x4002C01C))
-#define QEI0_INTEN_R            (*((volatile unsigned long *)0x4002C020))
-#define QEI0_RIS_R              (*((volatile unsigned long *)0x4002C024))
-#define QEI0_ISC_R              (*((volatile unsigned long *)0x4002C028))
+#define QEI0_CTL_R              HWREG(0x4002C000)
+#define QEI0_STAT_R             HWREG(0x4002C004)
+#define QEI0_POS_R              HWREG(0x4002C008)
+#define QEI0_MAXPOS_R           HWREG(0x4002C00C)
+#define QEI0_LOAD_R             HWREG(0x4002C010)
+#define QEI0_TIME_R             HWREG(0x4002C014)
+#define QEI0_COUNT_R            HWREG(0x4002C018)
+#define QEI0_SPEED_R            HWREG(0x4002C01C)
+#define QEI0_INTEN_R            HWREG(0x4002C020)
+#define QEI0_RIS_R              HWREG(0x4002C024)
+#define QEI0_ISC_R              HWREG(0x4002C028)
 
 //*****************************************************************************
 //
 // QEI registers (QEI1)
 //
 //*****************************************************************************
-#define QEI1_CTL_R              (*((volatile unsigned long *)0x4002D000))
-#define QEI1_STAT_R             (*((volatile unsigned long *)0x4002D004))
-#define QEI1_POS_R              (*((volatile unsigned long *)0x4002D008))
-#define QEI1_MAXPOS_R           (*((volatile unsigned long *)0x4002D00C))
-#define QEI1_LOAD_R             (*((volatile unsigned long *)0x4002D010))
-#define QEI1_TIME_R             (*((volatile unsigned long *)0x4002D014))
-#define QEI1_COUNT_R            (*((volatile unsigned long *)0x4002D018))
-#define QEI1_SPEED_R            (*((volatile unsigned long *)0x4002D01C))
-#define QEI1_INTEN_R            (*((volatile unsigned long *)0x4002D020))
-#define QEI1_RIS_R              (*((volatile unsigned long *)0x4002D024))
-#define QEI1_ISC_R              (*((volatile unsigned long *)0x4002D028))
+#define QEI1_CTL_R              HWREG(0x4002D000)
+#define QEI1_STAT_R             HWREG(0x4002D004)
+#define QEI1_POS_R              HWREG(0x4002D008)
+#define QEI1_MAXPOS_R           HWREG(0x4002D00C)
+#define QEI1_LOAD_R             HWREG(0x4002D010)
+#define QEI1_TIME_R             HWREG(0x4002D014)
+#define QEI1_COUNT_R            HWREG(0x4002D018)
+#define QEI1_SPEED_R            HWREG(0x4002D01C)
+#define QEI1_INTEN_R            HWREG(0x4002D020)
+#define QEI1_RIS_R              HWREG(0x4002D024)
+#define QEI1_ISC_R              HWREG(0x4002D028)
 
 //*****************************************************************************
 //
 // Timer registers (TIMER0)
 //
 //*****************************************************************************
-#define TIMER0_CFG_R            (*((volatile unsigned long *)0x40030000))
-#define TIMER0_TAMR_R           (*((volatile unsigned long *)0x40030004))
-#define TIMER0_TBMR_R           (*((volatile unsigned long *)0x40030008))
-#define TIMER0_CTL_R            (*((volatile unsigned long *)0x4003000C))
-#define TIMER0_SYNC_R           (*((volatile unsigned long *)0x40030010))
-#define TIMER0_IMR_R            (*((volatile unsigned long *)0x40030018))
-#define TIMER0_RIS_R            (*((volatile unsigned long *)0x4003001C))
-#define TIMER0_MIS_R            (*((volatile unsigned long *)0x40030020))
-#define TIMER0_ICR_R            (*((volatile unsigned long *)0x40030024))
-#define TIMER0_TAILR_R          (*((volatile unsigned long *)0x40030028))
-#define TIMER0_TBILR_R          (*((volatile unsigned long *)0x4003002C))
-#define TIMER0_TAMATCHR_R       (*((volatile unsigned long *)0x40030030))
-#define TIMER0_TBMATCHR_R       (*((volatile unsigned long *)0x40030034))
-#define TIMER0_TAPR_R           (*((volatile unsigned long *)0x40030038))
-#define TIMER0_TBPR_R           (*((volatile unsigned long *)0x4003003C))
-#define TIMER0_TAPMR_R          (*((volatile unsigned long *)0x40030040))
-#define TIMER0_TBPMR_R          (*((volatile unsigned long *)0x40030044))
-#define TIMER0_TAR_R            (*((volatile unsigned long *)0x40030048))
-#define TIMER0_TBR_R            (*((volatile unsigned long *)0x4003004C))
-#define TIMER0_TAV_R            (*((volatile unsigned long *)0x40030050))
-#define TIMER0_TBV_R            (*((volatile unsigned long *)0x40030054))
-#define TIMER0_RTCPD_R          (*((volatile unsigned long *)0x40030058))
-#define TIMER0_TAPS_R           (*((volatile unsigned long *)0x4003005C))
-#define TIMER0_TBPS_R           (*((volatile unsigned long *)0x40030060))
-#define TIMER0_TAPV_R           (*((volatile unsigned long *)0x40030064))
-#define TIMER0_TBPV_R           (*((volatile unsigned long *)0x40030068))
-#define TIMER0_PP_R             (*((volatile unsigned long *)0x40030FC0))
+#define TIMER0_CFG_R            HWREG(0x40030000)
+#define TIMER0_TAMR_R           HWREG(0x40030004)
+#define TIMER0_TBMR_R           HWREG(0x40030008)
+#define TIMER0_CTL_R            HWREG(0x4003000C)
+#define TIMER0_SYNC_R           HWREG(0x40030010)
+#define TIMER0_IMR_R            HWREG(0x40030018)
+#define TIMER0_RIS_R            HWREG(0x4003001C)
+#define TIMER0_MIS_R            HWREG(0x40030020)
+#define TIMER0_ICR_R            HWREG(0x40030024)
+#define TIMER0_TAILR_R          HWREG(0x40030028)
+#define TIMER0_TBILR_R          HWREG(0x4003002C)
+#define TIMER0_TAMATCHR_R       HWREG(0x40030030)
+#define TIMER0_TBMATCHR_R       HWREG(0x40030034)
+#define TIMER0_TAPR_R           HWREG(0x40030038)
+#define TIMER0_TBPR_R           HWREG(0x4003003C)
+#define TIMER0_TAPMR_R          HWREG(0x40030040)
+#define TIMER0_TBPMR_R          HWREG(0x40030044)
+#define TIMER0_TAR_R            HWREG(0x40030048)
+#define TIMER0_TBR_R            HWREG(0x4003004C)
+#define TIMER0_TAV_R            HWREG(0x40030050)
+#define TIMER0_TBV_R            HWREG(0x40030054)
+#define TIMER0_RTCPD_R          HWREG(0x40030058)
+#define TIMER0_TAPS_R           HWREG(0x4003005C)
+#define TIMER0_TBPS_R           HWREG(0x40030060)
+#define TIMER0_TAPV_R           HWREG(0x40030064)
+#define TIMER0_TBPV_R           HWREG(0x40030068)
+#define TIMER0_PP_R             HWREG(0x40030FC0)
 
 //*****************************************************************************
 //
 // Timer registers (TIMER1)
 //
 //*****************************************************************************
-#define TIMER1_CFG_R            (*((volatile unsigned long *)0x40031000))
-#define TIMER1_TAMR_R           (*((volatile unsigned long *)0x40031004))
-#define TIMER1_TBMR_R           (*((volatile unsigned long *)0x40031008))
-#define TIMER1_CTL_R            (*((volatile unsigned long *)0x4003100C))
-#define TIMER1_SYNC_R           (*((volatile unsigned long *)0x40031010))
-#define TIMER1_IMR_R            (*((volatile unsigned long *)0x40031018))
-#define TIMER1_RIS_R            (*((volatile unsigned long *)0x4003101C))
-#define TIMER1_MIS_R            (*((volatile unsigned long *)0x40031020))
-#define TIMER1_ICR_R            (*((volatile unsigned long *)0x40031024))
-#define TIMER1_TAILR_R          (*((volatile unsigned long *)0x40031028))
-#define TIMER1_TBILR_R          (*((volatile unsigned long *)0x4003102C))
-#define TIMER1_TAMATCHR_R       (*((volatile unsigned long *)0x40031030))
-#define TIMER1_TBMATCHR_R       (*((volatile unsigned long *)0x40031034))
-#define TIMER1_TAPR_R           (*((volatile unsigned long *)0x40031038))
-#define TIMER1_TBPR_R           (*((volatile unsigned long *)0x4003103C))
-#define TIMER1_TAPMR_R          (*((volatile unsigned long *)0x40031040))
-#define TIMER1_TBPMR_R          (*((volatile unsigned long *)0x40031044))
-#define TIMER1_TAR_R            (*((volatile unsigned long *)0x40031048))
-#define TIMER1_TBR_R            (*((volatile unsigned long *)0x4003104C))
-#define TIMER1_TAV_R            (*((volatile unsigned long *)0x40031050))
-#define TIMER1_TBV_R            (*((volatile unsigned long *)0x40031054))
-#define TIMER1_RTCPD_R          (*((volatile unsigned long *)0x40031058))
-#define TIMER1_TAPS_R           (*((volatile unsigned long *)0x4003105C))
-#define TIMER1_TBPS_R           (*((volatile unsigned long *)0x40031060))
-#define TIMER1_TAPV_R           (*((volatile unsigned long *)0x40031064))
-#define TIMER1_TBPV_R           (*((volatile unsigned long *)0x40031068))
-#define TIMER1_PP_R             (*((volatile unsigned long *)0x40031FC0))
+#define TIMER1_CFG_R            HWREG(0x40031000)
+#define TIMER1_TAMR_R           HWREG(0x40031004)
+#define TIMER1_TBMR_R           HWREG(0x40031008)
+#define TIMER1_CTL_R            HWREG(0x4003100C)
+#define TIMER1_SYNC_R           HWREG(0x40031010)
+#define TIMER1_IMR_R            HWREG(0x40031018)
+#define TIMER1_RIS_R            HWREG(0x4003101C)
+#define TIMER1_MIS_R            HWREG(0x40031020)
+#define TIMER1_ICR_R            HWREG(0x40031024)
+#define TIMER1_TAILR_R          HWREG(0x40031028)
+#define TIMER1_TBILR_R          HWREG(0x4003102C)
+#define TIMER1_TAMATCHR_R       HWREG(0x40031030)
+#define TIMER1_TBMATCHR_R       HWREG(0x40031034)
+#define TIMER1_TAPR_R           HWREG(0x40031038)
+#define TIMER1_TBPR_R           HWREG(0x4003103C)
+#define TIMER1_TAPMR_R          HWREG(0x40031040)
+#define TIMER1_TBPMR_R          HWREG(0x40031044)
+#define TIMER1_TAR_R            HWREG(0x40031048)
+#define TIMER1_TBR_R            HWREG(0x4003104C)
+#define TIMER1_TAV_R            HWREG(0x40031050)
+#define TIMER1_TBV_R            HWREG(0x40031054)
+#define TIMER1_RTCPD_R          HWREG(0x40031058)
+#define TIMER1_TAPS_R           HWREG(0x4003105C)
+#define TIMER1_TBPS_R           HWREG(0x40031060)
+#define TIMER1_TAPV_R           HWREG(0x40031064)
+#define TIMER1_TBPV_R           HWREG(0x40031068)
+#define TIMER1_PP_R             HWREG(0x40031FC0)
 
 //*****************************************************************************
 //
 // Timer registers (TIMER2)
 //
 //*****************************************************************************
-#define TIMER2_CFG_R            (*((volatile unsigned long *)0x40032000))
-#define TIMER2_TAMR_R           (*((volatile unsigned long *)0x40032004))
-#define TIMER2_TBMR_R           (*((volatile unsigned long *)0x40032008))
-#define TIMER2_CTL_R            (*((volatile unsigned long *)0x4003200C))
-#define TIMER2_SYNC_R           (*((volatile unsigned long *)0x40032010))
-#define TIMER2_IMR_R            (*((volatile unsigned long *)0x40032018))
-#define TIMER2_RIS_R            (*((volatile unsigned long *)0x4003201C))
-#define TIMER2_MIS_R            (*((volatile unsigned long *)0x40032020))
-#define TIMER2_ICR_R            (*((volatile unsigned long *)0x40032024))
-#define TIMER2_TAILR_R          (*((volatile unsigned long *)0x40032028))
-#define TIMER2_TBILR_R          (*((volatile unsigned long *)0x4003202C))
-#define TIMER2_TAMATCHR_R       (*((volatile unsigned long *)0x40032030))
-#define TIMER2_TBMATCHR_R       (*((volatile unsigned long *)0x40032034))
-#define TIMER2_TAPR_R           (*((volatile unsigned long *)0x40032038))
-#define TIMER2_TBPR_R           (*((volatile unsigned long *)0x4003203C))
-#define TIMER2_TAPMR_R          (*((volatile unsigned long *)0x40032040))
-#define TIMER2_TBPMR_R          (*((volatile unsigned long *)0x40032044))
-#define TIMER2_TAR_R            (*((volatile unsigned long *)0x40032048))
-#define TIMER2_TBR_R            (*((volatile unsigned long *)0x4003204C))
-#define TIMER2_TAV_R            (*((volatile unsigned long *)0x40032050))
-#define TIMER2_TBV_R            (*((volatile unsigned long *)0x40032054))
-#define TIMER2_RTCPD_R          (*((volatile unsigned long *)0x40032058))
-#define TIMER2_TAPS_R           (*((volatile unsigned long *)0x4003205C))
-#define TIMER2_TBPS_R           (*((volatile unsigned long *)0x40032060))
-#define TIMER2_TAPV_R           (*((volatile unsigned long *)0x40032064))
-#define TIMER2_TBPV_R           (*((volatile unsigned long *)0x40032068))
-#define TIMER2_PP_R             (*((volatile unsigned long *)0x40032FC0))
+#define TIMER2_CFG_R            HWREG(0x40032000)
+#define TIMER2_TAMR_R           HWREG(0x40032004)
+#define TIMER2_TBMR_R           HWREG(0x40032008)
+#define TIMER2_CTL_R            HWREG(0x4003200C)
+#define TIMER2_SYNC_R           HWREG(0x40032010)
+#define TIMER2_IMR_R            HWREG(0x40032018)
+#define TIMER2_RIS_R            HWREG(0x4003201C)
+#define TIMER2_MIS_R            HWREG(0x40032020)
+#define TIMER2_ICR_R            HWREG(0x40032024)
+#define TIMER2_TAILR_R          HWREG(0x40032028)
+#define TIMER2_TBILR_R          HWREG(0x4003202C)
+#define TIMER2_TAMATCHR_R       HWREG(0x40032030)
+#define TIMER2_TBMATCHR_R       HWREG(0x40032034)
+#define TIMER2_TAPR_R           HWREG(0x40032038)
+#define TIMER2_TBPR_R           HWREG(0x4003203C)
+#define TIMER2_TAPMR_R          HWREG(0x40032040)
+#define TIMER2_TBPMR_R          HWREG(0x40032044)
+#define TIMER2_TAR_R            HWREG(0x40032048)
+#define TIMER2_TBR_R            HWREG(0x4003204C)
+#define TIMER2_TAV_R            HWREG(0x40032050)
+#define TIMER2_TBV_R            HWREG(0x40032054)
+#define TIMER2_RTCPD_R          HWREG(0x40032058)
+#define TIMER2_TAPS_R           HWREG(0x4003205C)
+#define TIMER2_TBPS_R           HWREG(0x40032060)
+#define TIMER2_TAPV_R           HWREG(0x40032064)
+#define TIMER2_TBPV_R           HWREG(0x40032068)
+#define TIMER2_PP_R             HWREG(0x40032FC0)
 
 //*****************************************************************************
 //
 // Timer registers (TIMER3)
 //
 //*****************************************************************************
-#define TIMER3_CFG_R            (*((volatile unsigned long *)0x40033000))
-#define TIMER3_TAMR_R           (*((volatile unsigned long *)0x40033004))
-#define TIMER3_TBMR_R           (*((volatile unsigned long *)0x40033008))
-#define TIMER3_CTL_R            (*((volatile unsigned long *)0x4003300C))
-#define TIMER3_SYNC_R           (*((volatile unsigned long *)0x40033010))
-#define TIMER3_IMR_R            (*((volatile unsigned long *)0x40033018))
-#define TIMER3_RIS_R            (*((volatile unsigned long *)0x4003301C))
-#define TIMER3_MIS_R            (*((volatile unsigned long *)0x40033020))
-#define TIMER3_ICR_R            (*((volatile unsigned long *)0x40033024))
-#define TIMER3_TAILR_R          (*((volatile unsigned long *)0x40033028))
-#define TIMER3_TBILR_R          (*((volatile unsigned long *)0x4003302C))
-#define TIMER3_TAMATCHR_R       (*((volatile unsigned long *)0x40033030))
-#define TIMER3_TBMATCHR_R       (*((volatile unsigned long *)0x40033034))
-#define TIMER3_TAPR_R           (*((volatile unsigned long *)0x40033038))
-#define TIMER3_TBPR_R           (*((volatile unsigned long *)0x4003303C))
-#define TIMER3_TAPMR_R          (*((volatile unsigned long *)0x40033040))
-#define TIMER3_TBPMR_R          (*((volatile unsigned long *)0x40033044))
-#define TIMER3_TAR_R            (*((volatile unsigned long *)0x40033048))
-#define TIMER3_TBR_R            (*((volatile unsigned long *)0x4003304C))
-#define TIMER3_TAV_R            (*((volatile unsigned long *)0x40033050))
-#define TIMER3_TBV_R            (*((volatile unsigned long *)0x40033054))
-#define TIMER3_RTCPD_R          (*((volatile unsigned long *)0x40033058))
-#define TIMER3_TAPS_R           (*((volatile unsigned long *)0x4003305C))
-#define TIMER3_TBPS_R           (*((volatile unsigned long *)0x40033060))
-#define TIMER3_TAPV_R           (*((volatile unsigned long *)0x40033064))
-#define TIMER3_TBPV_R           (*((volatile unsigned long *)0x40033068))
-#define TIMER3_PP_R             (*((volatile unsigned long *)0x40033FC0))
+#define TIMER3_CFG_R            HWREG(0x40033000)
+#define TIMER3_TAMR_R           HWREG(0x40033004)
+#define TIMER3_TBMR_R           HWREG(0x40033008)
+#define TIMER3_CTL_R            HWREG(0x4003300C)
+#define TIMER3_SYNC_R           HWREG(0x40033010)
+#define TIMER3_IMR_R            HWREG(0x40033018)
+#define TIMER3_RIS_R            HWREG(0x4003301C)
+#define TIMER3_MIS_R            HWREG(0x40033020)
+#define TIMER3_ICR_R            HWREG(0x40033024)
+#define TIMER3_TAILR_R          HWREG(0x40033028)
+#define TIMER3_TBILR_R          HWREG(0x4003302C)
+#define TIMER3_TAMATCHR_R       HWREG(0x40033030)
+#define TIMER3_TBMATCHR_R       HWREG(0x40033034)
+#define TIMER3_TAPR_R           HWREG(0x40033038)
+#define TIMER3_TBPR_R           HWREG(0x4003303C)
+#define TIMER3_TAPMR_R          HWREG(0x40033040)
+#define TIMER3_TBPMR_R          HWREG(0x40033044)
+#define TIMER3_TAR_R            HWREG(0x40033048)
+#define TIMER3_TBR_R            HWREG(0x4003304C)
+#define TIMER3_TAV_R            HWREG(0x40033050)
+#define TIMER3_TBV_R            HWREG(0x40033054)
+#define TIMER3_RTCPD_R          HWREG(0x40033058)
+#define TIMER3_TAPS_R           HWREG(0x4003305C)
+#define TIMER3_TBPS_R           HWREG(0x40033060)
+#define TIMER3_TAPV_R           HWREG(0x40033064)
+#define TIMER3_TBPV_R           HWREG(0x40033068)
+#define TIMER3_PP_R             HWREG(0x40033FC0)
 
 //*****************************************************************************
 //
 // Timer registers (TIMER4)
 //
 //*****************************************************************************
-#define TIMER4_CFG_R            (*((volatile unsigned long *)0x40034000))
-#define TIMER4_TAMR_R           (*((volatile unsigned long *)0x40034004))
-#define TIMER4_TBMR_R           (*((volatile unsigned long *)0x40034008))
-#define TIMER4_CTL_R            (*((volatile unsigned long *)0x4003400C))
-#define TIMER4_SYNC_R           (*((volatile unsigned long *)0x40034010))
-#define TIMER4_IMR_R            (*((volatile unsigned long *)0x40034018))
-#define TIMER4_RIS_R            (*((volatile unsigned long *)0x4003401C))
-#define TIMER4_MIS_R            (*((volatile unsigned long *)0x40034020))
-#define TIMER4_ICR_R            (*((volatile unsigned long *)0x40034024))
-#define TIMER4_TAILR_R          (*((volatile unsigned long *)0x40034028))
-#define TIMER4_TBILR_R          (*((volatile unsigned long *)0x4003402C))
-#define TIMER4_TAMATCHR_R       (*((volatile unsigned long *)0x40034030))
-#define TIMER4_TBMATCHR_R       (*((volatile unsigned long *)0x40034034))
-#define TIMER4_TAPR_R           (*((volatile unsigned long *)0x40034038))
-#define TIMER4_TBPR_R           (*((volatile unsigned long *)0x4003403C))
-#define TIMER4_TAPMR_R          (*((volatile unsigned long *)0x40034040))
-#define TIMER4_TBPMR_R          (*((volatile unsigned long *)0x40034044))
-#define TIMER4_TAR_R            (*((volatile unsigned long *)0x40034048))
-#define TIMER4_TBR_R            (*((volatile unsigned long *)0x4003404C))
-#define TIMER4_TAV_R            (*((volatile unsigned long *)0x40034050))
-#define TIMER4_TBV_R            (*((volatile unsigned long *)0x40034054))
-#define TIMER4_RTCPD_R          (*((volatile unsigned long *)0x40034058))
-#define TIMER4_TAPS_R           (*((volatile unsigned long *)0x4003405C))
-#define TIMER4_TBPS_R           (*((volatile unsigned long *)0x40034060))
-#define TIMER4_TAPV_R           (*((volatile unsigned long *)0x40034064))
-#define TIMER4_TBPV_R           (*((volatile unsigned long *)0x40034068))
-#define TIMER4_PP_R             (*((volatile unsigned long *)0x40034FC0))
+#define TIMER4_CFG_R            HWREG(0x40034000)
+#define TIMER4_TAMR_R           HWREG(0x40034004)
+#define TIMER4_TBMR_R           HWREG(0x40034008)
+#define TIMER4_CTL_R            HWREG(0x4003400C)
+#define TIMER4_SYNC_R           HWREG(0x40034010)
+#define TIMER4_IMR_R            HWREG(0x40034018)
+#define TIMER4_RIS_R            HWREG(0x4003401C)
+#define TIMER4_MIS_R            HWREG(0x40034020)
+#define TIMER4_ICR_R            HWREG(0x40034024)
+#define TIMER4_TAILR_R          HWREG(0x40034028)
+#define TIMER4_TBILR_R          HWREG(0x4003402C)
+#define TIMER4_TAMATCHR_R       HWREG(0x40034030)
+#define TIMER4_TBMATCHR_R       HWREG(0x40034034)
+#define TIMER4_TAPR_R           HWREG(0x40034038)
+#define TIMER4_TBPR_R           HWREG(0x4003403C)
+#define TIMER4_TAPMR_R          HWREG(0x40034040)
+#define TIMER4_TBPMR_R          HWREG(0x40034044)
+#define TIMER4_TAR_R            HWREG(0x40034048)
+#define TIMER4_TBR_R            HWREG(0x4003404C)
+#define TIMER4_TAV_R            HWREG(0x40034050)
+#define TIMER4_TBV_R            HWREG(0x40034054)
+#define TIMER4_RTCPD_R          HWREG(0x40034058)
+#define TIMER4_TAPS_R           HWREG(0x4003405C)
+#define TIMER4_TBPS_R           HWREG(0x40034060)
+#define TIMER4_TAPV_R           HWREG(0x40034064)
+#define TIMER4_TBPV_R           HWREG(0x40034068)
+#define TIMER4_PP_R             HWREG(0x40034FC0)
 
 //*****************************************************************************
 //
 // Timer registers (TIMER5)
 //
 //*****************************************************************************
-#define TIMER5_CFG_R            (*((volatile unsigned long *)0x40035000))
-#define TIMER5_TAMR_R           (*((volatile unsigned long *)0x40035004))
-#define TIMER5_TBMR_R           (*((volatile unsigned long *)0x40035008))
-#define TIMER5_CTL_R            (*((volatile unsigned long *)0x4003500C))
-#define TIMER5_SYNC_R           (*((volatile unsigned long *)0x40035010))
-#define TIMER5_IMR_R            (*((volatile unsigned long *)0x40035018))
-#define TIMER5_RIS_R            (*((volatile unsigned long *)0x4003501C))
-#define TIMER5_MIS_R            (*((volatile unsigned long *)0x40035020))
-#define TIMER5_ICR_R            (*((volatile unsigned long *)0x40035024))
-#define TIMER5_TAILR_R          (*((volatile unsigned long *)0x40035028))
-#define TIMER5_TBILR_R          (*((volatile unsigned long *)0x4003502C))
-#define TIMER5_TAMATCHR_R       (*((volatile unsigned long *)0x40035030))
-#define TIMER5_TBMATCHR_R       (*((volatile unsigned long *)0x40035034))
-#define TIMER5_TAPR_R           (*((volatile unsigned long *)0x40035038))
-#define TIMER5_TBPR_R           (*((volatile unsigned long *)0x4003503C))
-#define TIMER5_TAPMR_R          (*((volatile unsigned long *)0x40035040))
-#define TIMER5_TBPMR_R          (*((volatile unsigned long *)0x40035044))
-#define TIMER5_TAR_R            (*((volatile unsigned long *)0x40035048))
-#define TIMER5_TBR_R            (*((volatile unsigned long *)0x4003504C))
-#define TIMER5_TAV_R            (*((volatile unsigned long *)0x40035050))
-#define TIMER5_TBV_R            (*((volatile unsigned long *)0x40035054))
-#define TIMER5_RTCPD_R          (*((volatile unsigned long *)0x40035058))
-#define TIMER5_TAPS_R           (*((volatile unsigned long *)0x4003505C))
-#define TIMER5_TBPS_R           (*((volatile unsigned long *)0x40035060))
-#define TIMER5_TAPV_R           (*((volatile unsigned long *)0x40035064))
-#define TIMER5_TBPV_R           (*((volatile unsigned long *)0x40035068))
-#define TIMER5_PP_R             (*((volatile unsigned long *)0x40035FC0))
+#define TIMER5_CFG_R            HWREG(0x40035000)
+#define TIMER5_TAMR_R           HWREG(0x40035004)
+#define TIMER5_TBMR_R           HWREG(0x40035008)
+#define TIMER5_CTL_R            HWREG(0x4003500C)
+#define TIMER5_SYNC_R           HWREG(0x40035010)
+#define TIMER5_IMR_R            HWREG(0x40035018)
+#define TIMER5_RIS_R            HWREG(0x4003501C)
+#define TIMER5_MIS_R            HWREG(0x40035020)
+#define TIMER5_ICR_R            HWREG(0x40035024)
+#define TIMER5_TAILR_R          HWREG(0x40035028)
+#define TIMER5_TBILR_R          HWREG(0x4003502C)
+#define TIMER5_TAMATCHR_R       HWREG(0x40035030)
+#define TIMER5_TBMATCHR_R       HWREG(0x40035034)
+#define TIMER5_TAPR_R           HWREG(0x40035038)
+#define TIMER5_TBPR_R           HWREG(0x4003503C)
+#define TIMER5_TAPMR_R          HWREG(0x40035040)
+#define TIMER5_TBPMR_R          HWREG(0x40035044)
+#define TIMER5_TAR_R            HWREG(0x40035048)
+#define TIMER5_TBR_R            HWREG(0x4003504C)
+#define TIMER5_TAV_R            HWREG(0x40035050)
+#define TIMER5_TBV_R            HWREG(0x40035054)
+#define TIMER5_RTCPD_R          HWREG(0x40035058)
+#define TIMER5_TAPS_R           HWREG(0x4003505C)
+#define TIMER5_TBPS_R           HWREG(0x40035060)
+#define TIMER5_TAPV_R           HWREG(0x40035064)
+#define TIMER5_TBPV_R           HWREG(0x40035068)
+#define TIMER5_PP_R             HWREG(0x40035FC0)
 
 //*****************************************************************************
 //
 // Timer registers (WTIMER0)
 //
 //*****************************************************************************
-#define WTIMER0_CFG_R           (*((volatile unsigned long *)0x40036000))
-#define WTIMER0_TAMR_R          (*((volatile unsigned long *)0x40036004))
-#define WTIMER0_TBMR_R          (*((volatile unsigned long *)0x40036008))
-#define WTIMER0_CTL_R           (*((volatile unsigned long *)0x4003600C))
-#define WTIMER0_SYNC_R          (*((volatile unsigned long *)0x40036010))
-#define WTIMER0_IMR_R           (*((volatile unsigned long *)0x40036018))
-#define WTIMER0_RIS_R           (*((volatile unsigned long *)0x4003601C))
-#define WTIMER0_MIS_R           (*((volatile unsigned long *)0x40036020))
-#define WTIMER0_ICR_R           (*((volatile unsigned long *)0x40036024))
-#define WTIMER0_TAILR_R         (*((volatile unsigned long *)0x40036028))
-#define WTIMER0_TBILR_R         (*((volatile unsigned long *)0x4003602C))
-#define WTIMER0_TAMATCHR_R      (*((volatile unsigned long *)0x40036030))
-#define WTIMER0_TBMATCHR_R      (*((volatile unsigned long *)0x40036034))
-#define WTIMER0_TAPR_R          (*((volatile unsigned long *)0x40036038))
-#define WTIMER0_TBPR_R          (*((volatile unsigned long *)0x4003603C))
-#define WTIMER0_TAPMR_R         (*((volatile unsigned long *)0x40036040))
-#define WTIMER0_TBPMR_R         (*((volatile unsigned long *)0x40036044))
-#define WTIMER0_TAR_R           (*((volatile unsigned long *)0x40036048))
-#define WTIMER0_TBR_R           (*((volatile unsigned long *)0x4003604C))
-#define WTIMER0_TAV_R           (*((volatile unsigned long *)0x40036050))
-#define WTIMER0_TBV_R           (*((volatile unsigned long *)0x40036054))
-#define WTIMER0_RTCPD_R         (*((volatile unsigned long *)0x40036058))
-#define WTIMER0_TAPS_R          (*((volatile unsigned long *)0x4003605C))
-#define WTIMER0_TBPS_R          (*((volatile unsigned long *)0x40036060))
-#define WTIMER0_TAPV_R          (*((volatile unsigned long *)0x40036064))
-#define WTIMER0_TBPV_R          (*((volatile unsigned long *)0x40036068))
-#define WTIMER0_PP_R            (*((volatile unsigned long *)0x40036FC0))
+#define WTIMER0_CFG_R           HWREG(0x40036000)
+#define WTIMER0_TAMR_R          HWREG(0x40036004)
+#define WTIMER0_TBMR_R          HWREG(0x40036008)
+#define WTIMER0_CTL_R           HWREG(0x4003600C)
+#define WTIMER0_SYNC_R          HWREG(0x40036010)
+#define WTIMER0_IMR_R           HWREG(0x40036018)
+#define WTIMER0_RIS_R           HWREG(0x4003601C)
+#define WTIMER0_MIS_R           HWREG(0x40036020)
+#define WTIMER0_ICR_R           HWREG(0x40036024)
+#define WTIMER0_TAILR_R         HWREG(0x40036028)
+#define WTIMER0_TBILR_R         HWREG(0x4003602C)
+#define WTIMER0_TAMATCHR_R      HWREG(0x40036030)
+#define WTIMER0_TBMATCHR_R      HWREG(0x40036034)
+#define WTIMER0_TAPR_R          HWREG(0x40036038)
+#define WTIMER0_TBPR_R          HWREG(0x4003603C)
+#define WTIMER0_TAPMR_R         HWREG(0x40036040)
+#define WTIMER0_TBPMR_R         HWREG(0x40036044)
+#define WTIMER0_TAR_R           HWREG(0x40036048)
+#define WTIMER0_TBR_R           HWREG(0x4003604C)
+#define WTIMER0_TAV_R           HWREG(0x40036050)
+#define WTIMER0_TBV_R           HWREG(0x40036054)
+#define WTIMER0_RTCPD_R         HWREG(0x40036058)
+#define WTIMER0_TAPS_R          HWREG(0x4003605C)
+#define WTIMER0_TBPS_R          HWREG(0x40036060)
+#define WTIMER0_TAPV_R          HWREG(0x40036064)
+#define WTIMER0_TBPV_R          HWREG(0x40036068)
+#define WTIMER0_PP_R            HWREG(0x40036FC0)
 
 //*****************************************************************************
 //
 // Timer registers (WTIMER1)
 //
 //*****************************************************************************
-#define WTIMER1_CFG_R           (*((volatile unsigned long *)0x40037000))
-#define WTIMER1_TAMR_R          (*((volatile unsigned long *)0x40037004))
-#define WTIMER1_TBMR_R          (*((volatile unsigned long *)0x40037008))
-#define WTIMER1_CTL_R           (*((volatile unsigned long *)0x4003700C))
-#define WTIMER1_SYNC_R          (*((volatile unsigned long *)0x40037010))
-#define WTIMER1_IMR_R           (*((volatile unsigned long *)0x40037018))
-#define WTIMER1_RIS_R           (*((volatile unsigned long *)0x4003701C))
-#define WTIMER1_MIS_R           (*((volatile unsigned long *)0x40037020))
-#define WTIMER1_ICR_R           (*((volatile unsigned long *)0x40037024))
-#define WTIMER1_TAILR_R         (*((volatile unsigned long *)0x40037028))
-#define WTIMER1_TBILR_R         (*((volatile unsigned long *)0x4003702C))
-#define WTIMER1_TAMATCHR_R      (*((volatile unsigned long *)0x40037030))
-#define WTIMER1_TBMATCHR_R      (*((volatile unsigned long *)0x40037034))
-#define WTIMER1_TAPR_R          (*((volatile unsigned long *)0x40037038))
-#define WTIMER1_TBPR_R          (*((volatile unsigned long *)0x4003703C))
-#define WTIMER1_TAPMR_R         (*((volatile unsigned long *)0x40037040))
-#define WTIMER1_TBPMR_R         (*((volatile unsigned long *)0x40037044))
-#define WTIMER1_TAR_R           (*((volatile unsigned long *)0x40037048))
-#define WTIMER1_TBR_R           (*((volatile unsigned long *)0x4003704C))
-#define WTIMER1_TAV_R           (*((volatile unsigned long *)0x40037050))
-#define WTIMER1_TBV_R           (*((volatile unsigned long *)0x40037054))
-#define WTIMER1_RTCPD_R         (*((volatile unsigned long *)0x40037058))
-#define WTIMER1_TAPS_R          (*((volatile unsigned long *)0x4003705C))
-#define WTIMER1_TBPS_R          (*((volatile unsigned long *)0x40037060))
-#define WTIMER1_TAPV_R          (*((volatile unsigned long *)0x40037064))
-#define WTIMER1_TBPV_R          (*((volatile unsigned long *)0x40037068))
-#define WTIMER1_PP_R            (*((volatile unsigned long *)0x40037FC0))
+#define WTIMER1_CFG_R           HWREG(0x40037000)
+#define WTIMER1_TAMR_R          HWREG(0x40037004)
+#define WTIMER1_TBMR_R          HWREG(0x40037008)
+#define WTIMER1_CTL_R           HWREG(0x4003700C)
+#define WTIMER1_SYNC_R          HWREG(0x40037010)
+#define WTIMER1_IMR_R           HWREG(0x40037018)
+#define WTIMER1_RIS_R           HWREG(0x4003701C)
+#define WTIMER1_MIS_R           HWREG(0x40037020)
+#define WTIMER1_ICR_R           HWREG(0x40037024)
+#define WTIMER1_TAILR_R         HWREG(0x40037028)
+#define WTIMER1_TBILR_R         HWREG(0x4003702C)
+#define WTIMER1_TAMATCHR_R      HWREG(0x40037030)
+#define WTIMER1_TBMATCHR_R      HWREG(0x40037034)
+#define WTIMER1_TAPR_R          HWREG(0x40037038)
+#define WTIMER1_TBPR_R          HWREG(0x4003703C)
+#define WTIMER1_TAPMR_R         HWREG(0x40037040)
+#define WTIMER1_TBPMR_R         HWREG(0x40037044)
+#define WTIMER1_TAR_R           HWREG(0x40037048)
+#define WTIMER1_TBR_R           HWREG(0x4003704C)
+#define WTIMER1_TAV_R           HWREG(0x40037050)
+#define WTIMER1_TBV_R           HWREG(0x40037054)
+#define WTIMER1_RTCPD_R         HWREG(0x40037058)
+#define WTIMER1_TAPS_R          HWREG(0x4003705C)
+#define WTIMER1_TBPS_R          HWREG(0x40037060)
+#define WTIMER1_TAPV_R          HWREG(0x40037064)
+#define WTIMER1_TBPV_R          HWREG(0x40037068)
+#define WTIMER1_PP_R            HWREG(0x40037FC0)
 
 //*****************************************************************************
 //
 // ADC registers (ADC0)
 //
 //*****************************************************************************
-#define ADC0_ACTSS_R            (*((volatile unsigned long *)0x40038000))
-#define ADC0_RIS_R              (*((volatile unsigned long *)0x40038004))
-#define ADC0_IM_R               (*((volatile unsigned long *)0x40038008))
-#define ADC0_ISC_R              (*((volatile unsigned long *)0x4003800C))
-#define ADC0_OSTAT_R            (*((volatile unsigned long *)0x40038010))
-#define ADC0_EMUX_R             (*((volatile unsigned long *)0x40038014))
-#define ADC0_USTAT_R            (*((volatile unsigned long *)0x40038018))
-#define ADC0_TSSEL_R            (*((volatile unsigned long *)0x4003801C))
-#define ADC0_SSPRI_R            (*((volatile unsigned long *)0x40038020))
-#define ADC0_SPC_R              (*((volatile unsigned long *)0x40038024))
-#define ADC0_PSSI_R             (*((volatile unsigned long *)0x40038028))
-#define ADC0_SAC_R              (*((volatile unsigned long *)0x40038030))
-#define ADC0_DCISC_R            (*((volatile unsigned long *)0x40038034))
-#define ADC0_CTL_R              (*((volatile unsigned long *)0x40038038))
-#define ADC0_SSMUX0_R           (*((volatile unsigned long *)0x40038040))
-#define ADC0_SSCTL0_R           (*((volatile unsigned long *)0x40038044))
-#define ADC0_SSFIFO0_R          (*((volatile unsigned long *)0x40038048))
-#define ADC0_SSFSTAT0_R         (*((volatile unsigned long *)0x4003804C))
-#define ADC0_SSOP0_R            (*((volatile unsigned long *)0x40038050))
-#define ADC0_SSDC0_R            (*((volatile unsigned long *)0x40038054))
-#define ADC0_SSMUX1_R           (*((volatile unsigned long *)0x40038060))
-#define ADC0_SSCTL1_R           (*((volatile unsigned long *)0x40038064))
-#define ADC0_SSFIFO1_R          (*((volatile unsigned long *)0x40038068))
-#define ADC0_SSFSTAT1_R         (*((volatile unsigned long *)0x4003806C))
-#define ADC0_SSOP1_R            (*((volatile unsigned long *)0x40038070))
-#define ADC0_SSDC1_R            (*((volatile unsigned long *)0x40038074))
-#define ADC0_SSMUX2_R           (*((volatile unsigned long *)0x40038080))
-#define ADC0_SSCTL2_R           (*((volatile unsigned long *)0x40038084))
-#define ADC0_SSFIFO2_R          (*((volatile unsigned long *)0x40038088))
-#define ADC0_SSFSTAT2_R         (*((volatile unsigned long *)0x4003808C))
-#define ADC0_SSOP2_R            (*((volatile unsigned long *)0x40038090))
-#define ADC0_SSDC2_R            (*((volatile unsigned long *)0x40038094))
-#define ADC0_SSMUX3_R           (*((volatile unsigned long *)0x400380A0))
-#define ADC0_SSCTL3_R           (*((volatile unsigned long *)0x400380A4))
-#define ADC0_SSFIFO3_R          (*((volatile unsigned long *)0x400380A8))
-#define ADC0_SSFSTAT3_R         (*((volatile unsigned long *)0x400380AC))
-#define ADC0_SSOP3_R            (*((volatile unsigned long *)0x400380B0))
-#define ADC0_SSDC3_R            (*((volatile unsigned long *)0x400380B4))
-#define ADC0_DCRIC_R            (*((volatile unsigned long *)0x40038D00))
-#define ADC0_DCCTL0_R           (*((volatile unsigned long *)0x40038E00))
-#define ADC0_DCCTL1_R           (*((volatile unsigned long *)0x40038E04))
-#define ADC0_DCCTL2_R           (*((volatile unsigned long *)0x40038E08))
-#define ADC0_DCCTL3_R           (*((volatile unsigned long *)0x40038E0C))
-#define ADC0_DCCTL4_R           (*((volatile unsigned long *)0x40038E10))
-#define ADC0_DCCTL5_R           (*((volatile unsigned long *)0x40038E14))
-#define ADC0_DCCTL6_R           (*((volatile unsigned long *)0x40038E18))
-#define ADC0_DCCTL7_R           (*((volatile unsigned long *)0x40038E1C))
-#define ADC0_DCCMP0_R           (*((volatile unsigned long *)0x40038E40))
-#define ADC0_DCCMP1_R           (*((volatile unsigned long *)0x40038E44))
-#define ADC0_DCCMP2_R           (*((volatile unsigned long *)0x40038E48))
-#define ADC0_DCCMP3_R           (*((volatile unsigned long *)0x40038E4C))
-#define ADC0_DCCMP4_R           (*((volatile unsigned long *)0x40038E50))
-#define ADC0_DCCMP5_R           (*((volatile unsigned long *)0x40038E54))
-#define ADC0_DCCMP6_R           (*((volatile unsigned long *)0x40038E58))
-#define ADC0_DCCMP7_R           (*((volatile unsigned long *)0x40038E5C))
-#define ADC0_PP_R               (*((volatile unsigned long *)0x40038FC0))
-#define ADC0_PC_R               (*((volatile unsigned long *)0x40038FC4))
-#define ADC0_CC_R               (*((volatile unsigned long *)0x40038FC8))
+#define ADC0_ACTSS_R            HWREG(0x40038000)
+#define ADC0_RIS_R              HWREG(0x40038004)
+#define ADC0_IM_R               HWREG(0x40038008)
+#define ADC0_ISC_R              HWREG(0x4003800C)
+#define ADC0_OSTAT_R            HWREG(0x40038010)
+#define ADC0_EMUX_R             HWREG(0x40038014)
+#define ADC0_USTAT_R            HWREG(0x40038018)
+#define ADC0_TSSEL_R            HWREG(0x4003801C)
+#define ADC0_SSPRI_R            HWREG(0x40038020)
+#define ADC0_SPC_R              HWREG(0x40038024)
+#define ADC0_PSSI_R             HWREG(0x40038028)
+#define ADC0_SAC_R              HWREG(0x40038030)
+#define ADC0_DCISC_R            HWREG(0x40038034)
+#define ADC0_CTL_R              HWREG(0x40038038)
+#define ADC0_SSMUX0_R           HWREG(0x40038040)
+#define ADC0_SSCTL0_R           HWREG(0x40038044)
+#define ADC0_SSFIFO0_R          HWREG(0x40038048)
+#define ADC0_SSFSTAT0_R         HWREG(0x4003804C)
+#define ADC0_SSOP0_R            HWREG(0x40038050)
+#define ADC0_SSDC0_R            HWREG(0x40038054)
+#define ADC0_SSMUX1_R           HWREG(0x40038060)
+#define ADC0_SSCTL1_R           HWREG(0x40038064)
+#define ADC0_SSFIFO1_R          HWREG(0x40038068)
+#define ADC0_SSFSTAT1_R         HWREG(0x4003806C)
+#define ADC0_SSOP1_R            HWREG(0x40038070)
+#define ADC0_SSDC1_R            HWREG(0x40038074)
+#define ADC0_SSMUX2_R           HWREG(0x40038080)
+#define ADC0_SSCTL2_R           HWREG(0x40038084)
+#define ADC0_SSFIFO2_R          HWREG(0x40038088)
+#define ADC0_SSFSTAT2_R         HWREG(0x4003808C)
+#define ADC0_SSOP2_R            HWREG(0x40038090)
+#define ADC0_SSDC2_R            HWREG(0x40038094)
+#define ADC0_SSMUX3_R           HWREG(0x400380A0)
+#define ADC0_SSCTL3_R           HWREG(0x400380A4)
+#define ADC0_SSFIFO3_R          HWREG(0x400380A8)
+#define ADC0_SSFSTAT3_R         HWREG(0x400380AC)
+#define ADC0_SSOP3_R            HWREG(0x400380B0)
+#define ADC0_SSDC3_R            HWREG(0x400380B4)
+#define ADC0_DCRIC_R            HWREG(0x40038D00)
+#define ADC0_DCCTL0_R           HWREG(0x40038E00)
+#define ADC0_DCCTL1_R           HWREG(0x40038E04)
+#define ADC0_DCCTL2_R           HWREG(0x40038E08)
+#define ADC0_DCCTL3_R           HWREG(0x40038E0C)
+#define ADC0_DCCTL4_R           HWREG(0x40038E10)
+#define ADC0_DCCTL5_R           HWREG(0x40038E14)
+#define ADC0_DCCTL6_R           HWREG(0x40038E18)
+#define ADC0_DCCTL7_R           HWREG(0x40038E1C)
+#define ADC0_DCCMP0_R           HWREG(0x40038E40)
+#define ADC0_DCCMP1_R           HWREG(0x40038E44)
+#define ADC0_DCCMP2_R           HWREG(0x40038E48)
+#define ADC0_DCCMP3_R           HWREG(0x40038E4C)
+#define ADC0_DCCMP4_R           HWREG(0x40038E50)
+#define ADC0_DCCMP5_R           HWREG(0x40038E54)
+#define ADC0_DCCMP6_R           HWREG(0x40038E58)
+#define ADC0_DCCMP7_R           HWREG(0x40038E5C)
+#define ADC0_PP_R               HWREG(0x40038FC0)
+#define ADC0_PC_R               HWREG(0x40038FC4)
+#define ADC0_CC_R               HWREG(0x40038FC8)
 
 //*****************************************************************************
 //
 // ADC registers (ADC1)
 //
 //*****************************************************************************
-#define ADC1_ACTSS_R            (*((volatile unsigned long *)0x40039000))
-#define ADC1_RIS_R              (*((volatile unsigned long *)0x40039004))
-#define ADC1_IM_R               (*((volatile unsigned long *)0x40039008))
-#define ADC1_ISC_R              (*((volatile unsigned long *)0x4003900C))
-#define ADC1_OSTAT_R            (*((volatile unsigned long *)0x40039010))
-#define ADC1_EMUX_R             (*((volatile unsigned long *)0x40039014))
-#define ADC1_USTAT_R            (*((volatile unsigned long *)0x40039018))
-#define ADC1_TSSEL_R            (*((volatile unsigned long *)0x4003901C))
-#define ADC1_SSPRI_R            (*((volatile unsigned long *)0x40039020))
-#define ADC1_SPC_R              (*((volatile unsigned long *)0x40039024))
-#define ADC1_PSSI_R             (*((volatile unsigned long *)0x40039028))
-#define ADC1_SAC_R              (*((volatile unsigned long *)0x40039030))
-#define ADC1_DCISC_R            (*((volatile unsigned long *)0x40039034))
-#define ADC1_CTL_R              (*((volatile unsigned long *)0x40039038))
-#define ADC1_SSMUX0_R           (*((volatile unsigned long *)0x40039040))
-#define ADC1_SSCTL0_R           (*((volatile unsigned long *)0x40039044))
-#define ADC1_SSFIFO0_R          (*((volatile unsigned long *)0x40039048))
-#define ADC1_SSFSTAT0_R         (*((volatile unsigned long *)0x4003904C))
-#define ADC1_SSOP0_R            (*((volatile unsigned long *)0x40039050))
-#define ADC1_SSDC0_R            (*((volatile unsigned long *)0x40039054))
-#define ADC1_SSMUX1_R           (*((volatile unsigned long *)0x40039060))
-#define ADC1_SSCTL1_R           (*((volatile unsigned long *)0x40039064))
-#define ADC1_SSFIFO1_R          (*((volatile unsigned long *)0x40039068))
-#define ADC1_SSFSTAT1_R         (*((volatile unsigned long *)0x4003906C))
-#define ADC1_SSOP1_R            (*((volatile unsigned long *)0x40039070))
-#define ADC1_SSDC1_R            (*((volatile unsigned long *)0x40039074))
-#define ADC1_SSMUX2_R           (*((volatile unsigned long *)0x40039080))
-#define ADC1_SSCTL2_R           (*((volatile unsigned long *)0x40039084))
-#define ADC1_SSFIFO2_R          (*((volatile unsigned long *)0x40039088))
-#define ADC1_SSFSTAT2_R         (*((volatile unsigned long *)0x4003908C))
-#define ADC1_SSOP2_R            (*((volatile unsigned long *)0x40039090))
-#define ADC1_SSDC2_R            (*((volatile unsigned long *)0x40039094))
-#define ADC1_SSMUX3_R           (*((volatile unsigned long *)0x400390A0))
-#define ADC1_SSCTL3_R           (*((volatile unsigned long *)0x400390A4))
-#define ADC1_SSFIFO3_R          (*((volatile unsigned long *)0x400390A8))
-#define ADC1_SSFSTAT3_R         (*((volatile unsigned long *)0x400390AC))
-#define ADC1_SSOP3_R            (*((volatile unsigned long *)0x400390B0))
-#define ADC1_SSDC3_R            (*((volatile unsigned long *)0x400390B4))
-#define ADC1_DCRIC_R            (*((volatile unsigned long *)0x40039D00))
-#define ADC1_DCCTL0_R           (*((volatile unsigned long *)0x40039E00))
-#define ADC1_DCCTL1_R           (*((volatile unsigned long *)0x40039E04))
-#define ADC1_DCCTL2_R           (*((volatile unsigned long *)0x40039E08))
-#define ADC1_DCCTL3_R           (*((volatile unsigned long *)0x40039E0C))
-#define ADC1_DCCTL4_R           (*((volatile unsigned long *)0x40039E10))
-#define ADC1_DCCTL5_R           (*((volatile unsigned long *)0x40039E14))
-#define ADC1_DCCTL6_R           (*((volatile unsigned long *)0x40039E18))
-#define ADC1_DCCTL7_R           (*((volatile unsigned long *)0x40039E1C))
-#define ADC1_DCCMP0_R           (*((volatile unsigned long *)0x40039E40))
-#define ADC1_DCCMP1_R           (*((volatile unsigned long *)0x40039E44))
-#define ADC1_DCCMP2_R           (*((volatile unsigned long *)0x40039E48))
-#define ADC1_DCCMP3_R           (*((volatile unsigned long *)0x40039E4C))
-#define ADC1_DCCMP4_R           (*((volatile unsigned long *)0x40039E50))
-#define ADC1_DCCMP5_R           (*((volatile unsigned long *)0x40039E54))
-#define ADC1_DCCMP6_R           (*((volatile unsigned long *)0x40039E58))
-#define ADC1_DCCMP7_R           (*((volatile unsigned long *)0x40039E5C))
-#define ADC1_PP_R               (*((volatile unsigned long *)0x40039FC0))
-#define ADC1_PC_R               (*((volatile unsigned long *)0x40039FC4))
-#define ADC1_CC_R               (*((volatile unsigned long *)0x40039FC8))
+#define ADC1_ACTSS_R            HWREG(0x40039000)
+#define ADC1_RIS_R              HWREG(0x40039004)
+#define ADC1_IM_R               HWREG(0x40039008)
+#define ADC1_ISC_R              HWREG(0x4003900C)
+#define ADC1_OSTAT_R            HWREG(0x40039010)
+#define ADC1_EMUX_R             HWREG(0x40039014)
+#define ADC1_USTAT_R            HWREG(0x40039018)
+#define ADC1_TSSEL_R            HWREG(0x4003901C)
+#define ADC1_SSPRI_R            HWREG(0x40039020)
+#define ADC1_SPC_R              HWREG(0x40039024)
+#define ADC1_PSSI_R             HWREG(0x40039028)
+#define ADC1_SAC_R              HWREG(0x40039030)
+#define ADC1_DCISC_R            HWREG(0x40039034)
+#define ADC1_CTL_R              HWREG(0x40039038)
+#define ADC1_SSMUX0_R           HWREG(0x40039040)
+#define ADC1_SSCTL0_R           HWREG(0x40039044)
+#define ADC1_SSFIFO0_R          HWREG(0x40039048)
+#define ADC1_SSFSTAT0_R         HWREG(0x4003904C)
+#define ADC1_SSOP0_R            HWREG(0x40039050)
+#define ADC1_SSDC0_R            HWREG(0x40039054)
+#define ADC1_SSMUX1_R           HWREG(0x40039060)
+#define ADC1_SSCTL1_R           HWREG(0x40039064)
+#define ADC1_SSFIFO1_R          HWREG(0x40039068)
+#define ADC1_SSFSTAT1_R         HWREG(0x4003906C)
+#define ADC1_SSOP1_R            HWREG(0x40039070)
+#define ADC1_SSDC1_R            HWREG(0x40039074)
+#define ADC1_SSMUX2_R           HWREG(0x40039080)
+#define ADC1_SSCTL2_R           HWREG(0x40039084)
+#define ADC1_SSFIFO2_R          HWREG(0x40039088)
+#define ADC1_SSFSTAT2_R         HWREG(0x4003908C)
+#define ADC1_SSOP2_R            HWREG(0x40039090)
+#define ADC1_SSDC2_R            HWREG(0x40039094)
+#define ADC1_SSMUX3_R           HWREG(0x400390A0)
+#define ADC1_SSCTL3_R           HWREG(0x400390A4)
+#define ADC1_SSFIFO3_R          HWREG(0x400390A8)
+#define ADC1_SSFSTAT3_R         HWREG(0x400390AC)
+#define ADC1_SSOP3_R            HWREG(0x400390B0)
+#define ADC1_SSDC3_R            HWREG(0x400390B4)
+#define ADC1_DCRIC_R            HWREG(0x40039D00)
+#define ADC1_DCCTL0_R           HWREG(0x40039E00)
+#define ADC1_DCCTL1_R           HWREG(0x40039E04)
+#define ADC1_DCCTL2_R           HWREG(0x40039E08)
+#define ADC1_DCCTL3_R           HWREG(0x40039E0C)
+#define ADC1_DCCTL4_R           HWREG(0x40039E10)
+#define ADC1_DCCTL5_R           HWREG(0x40039E14)
+#define ADC1_DCCTL6_R           HWREG(0x40039E18)
+#define ADC1_DCCTL7_R           HWREG(0x40039E1C)
+#define ADC1_DCCMP0_R           HWREG(0x40039E40)
+#define ADC1_DCCMP1_R           HWREG(0x40039E44)
+#define ADC1_DCCMP2_R           HWREG(0x40039E48)
+#define ADC1_DCCMP3_R           HWREG(0x40039E4C)
+#define ADC1_DCCMP4_R           HWREG(0x40039E50)
+#define ADC1_DCCMP5_R           HWREG(0x40039E54)
+#define ADC1_DCCMP6_R           HWREG(0x40039E58)
+#define ADC1_DCCMP7_R           HWREG(0x40039E5C)
+#define ADC1_PP_R               HWREG(0x40039FC0)
+#define ADC1_PC_R               HWREG(0x40039FC4)
+#define ADC1_CC_R               HWREG(0x40039FC8)
 
 //*****************************************************************************
 //
 // Comparator registers (COMP)
 //
 //*****************************************************************************
-#define COMP_ACMIS_R            (*((volatile unsigned long *)0x4003C000))
-#define COMP_ACRIS_R            (*((volatile unsigned long *)0x4003C004))
-#define COMP_ACINTEN_R          (*((volatile unsigned long *)0x4003C008))
-#define COMP_ACREFCTL_R         (*((volatile unsigned long *)0x4003C010))
-#define COMP_ACSTAT0_R          (*((volatile unsigned long *)0x4003C020))
-#define COMP_ACCTL0_R           (*((volatile unsigned long *)0x4003C024))
-#define COMP_ACSTAT1_R          (*((volatile unsigned long *)0x4003C040))
-#define COMP_ACCTL1_R           (*((volatile unsigned long *)0x4003C044))
-#define COMP_PP_R               (*((volatile unsigned long *)0x4003CFC0))
+#define COMP_ACMIS_R            HWREG(0x4003C000)
+#define COMP_ACRIS_R            HWREG(0x4003C004)
+#define COMP_ACINTEN_R          HWREG(0x4003C008)
+#define COMP_ACREFCTL_R         HWREG(0x4003C010)
+#define COMP_ACSTAT0_R          HWREG(0x4003C020)
+#define COMP_ACCTL0_R           HWREG(0x4003C024)
+#define COMP_ACSTAT1_R          HWREG(0x4003C040)
+#define COMP_ACCTL1_R           HWREG(0x4003C044)
+#define COMP_PP_R               HWREG(0x4003CFC0)
 
 //*****************************************************************************
 //
 // CAN registers (CAN0)
 //
 //*****************************************************************************
-#define CAN0_CTL_R              (*((volatile unsigned long *)0x40040000))
-#define CAN0_STS_R              (*((volatile unsigned long *)0x40040004))
-#define CAN0_ERR_R              (*((volatile unsigned long *)0x40040008))
-#define CAN0_BIT_R              (*((volatile unsigned long *)0x4004000C))
-#define CAN0_INT_R              (*((volatile unsigned long *)0x40040010))
-#define CAN0_TST_R              (*((volatile unsigned long *)0x40040014))
-#define CAN0_BRPE_R             (*((volatile unsigned long *)0x40040018))
-#define CAN0_IF1CRQ_R           (*((volatile unsigned long *)0x40040020))
-#define CAN0_IF1CMSK_R          (*((volatile unsigned long *)0x40040024))
-#define CAN0_IF1MSK1_R          (*((volatile unsigned long *)0x40040028))
-#define CAN0_IF1MSK2_R          (*((volatile unsigned long *)0x4004002C))
-#define CAN0_IF1ARB1_R          (*((volatile unsigned long *)0x40040030))
-#define CAN0_IF1ARB2_R          (*((volatile unsigned long *)0x40040034))
-#define CAN0_IF1MCTL_R          (*((volatile unsigned long *)0x40040038))
-#define CAN0_IF1DA1_R           (*((volatile unsigned long *)0x4004003C))
-#define CAN0_IF1DA2_R           (*((volatile unsigned long *)0x40040040))
-#define CAN0_IF1DB1_R           (*((volatile unsigned long *)0x40040044))
-#define CAN0_IF1DB2_R           (*((volatile unsigned long *)0x40040048))
-#define CAN0_IF2CRQ_R           (*((volatile unsigned long *)0x40040080))
-#define CAN0_IF2CMSK_R          (*((volatile unsigned long *)0x40040084))
-#define CAN0_IF2MSK1_R          (*((volatile unsigned long *)0x40040088))
-#define CAN0_IF2MSK2_R          (*((volatile unsigned long *)0x4004008C))
-#define CAN0_IF2ARB1_R          (*((volatile unsigned long *)0x40040090))
-#define CAN0_IF2ARB2_R          (*((volatile unsigned long *)0x40040094))
-#define CAN0_IF2MCTL_R          (*((volatile unsigned long *)0x40040098))
-#define CAN0_IF2DA1_R           (*((volatile unsigned long *)0x4004009C))
-#define CAN0_IF2DA2_R           (*((volatile unsigned long *)0x400400A0))
-#define CAN0_IF2DB1_R           (*((volatile unsigned long *)0x400400A4))
-#define CAN0_IF2DB2_R           (*((volatile unsigned long *)0x400400A8))
-#define CAN0_TXRQ1_R            (*((volatile unsigned long *)0x40040100))
-#define CAN0_TXRQ2_R            (*((volatile unsigned long *)0x40040104))
-#define CAN0_NWDA1_R            (*((volatile unsigned long *)0x40040120))
-#define CAN0_NWDA2_R            (*((volatile unsigned long *)0x40040124))
-#define CAN0_MSG1INT_R          (*((volatile unsigned long *)0x40040140))
-#define CAN0_MSG2INT_R          (*((volatile unsigned long *)0x40040144))
-#define CAN0_MSG1VAL_R          (*((volatile unsigned long *)0x40040160))
-#define CAN0_MSG2VAL_R          (*((volatile unsigned long *)0x40040164))
+#define CAN0_CTL_R              HWREG(0x40040000)
+#define CAN0_STS_R              HWREG(0x40040004)
+#define CAN0_ERR_R              HWREG(0x40040008)
+#define CAN0_BIT_R              HWREG(0x4004000C)
+#define CAN0_INT_R              HWREG(0x40040010)
+#define CAN0_TST_R              HWREG(0x40040014)
+#define CAN0_BRPE_R             HWREG(0x40040018)
+#define CAN0_IF1CRQ_R           HWREG(0x40040020)
+#define CAN0_IF1CMSK_R          HWREG(0x40040024)
+#define CAN0_IF1MSK1_R          HWREG(0x40040028)
+#define CAN0_IF1MSK2_R          HWREG(0x4004002C)
+#define CAN0_IF1ARB1_R          HWREG(0x40040030)
+#define CAN0_IF1ARB2_R          HWREG(0x40040034)
+#define CAN0_IF1MCTL_R          HWREG(0x40040038)
+#define CAN0_IF1DA1_R           HWREG(0x4004003C)
+#define CAN0_IF1DA2_R           HWREG(0x40040040)
+#define CAN0_IF1DB1_R           HWREG(0x40040044)
+#define CAN0_IF1DB2_R           HWREG(0x40040048)
+#define CAN0_IF2CRQ_R           HWREG(0x40040080)
+#define CAN0_IF2CMSK_R          HWREG(0x40040084)
+#define CAN0_IF2MSK1_R          HWREG(0x40040088)
+#define CAN0_IF2MSK2_R          HWREG(0x4004008C)
+#define CAN0_IF2ARB1_R          HWREG(0x40040090)
+#define CAN0_IF2ARB2_R          HWREG(0x40040094)
+#define CAN0_IF2MCTL_R          HWREG(0x40040098)
+#define CAN0_IF2DA1_R           HWREG(0x4004009C)
+#define CAN0_IF2DA2_R           HWREG(0x400400A0)
+#define CAN0_IF2DB1_R           HWREG(0x400400A4)
+#define CAN0_IF2DB2_R           HWREG(0x400400A8)
+#define CAN0_TXRQ1_R            HWREG(0x40040100)
+#define CAN0_TXRQ2_R            HWREG(0x40040104)
+#define CAN0_NWDA1_R            HWREG(0x40040120)
+#define CAN0_NWDA2_R            HWREG(0x40040124)
+#define CAN0_MSG1INT_R          HWREG(0x40040140)
+#define CAN0_MSG2INT_R          HWREG(0x40040144)
+#define CAN0_MSG1VAL_R          HWREG(0x40040160)
+#define CAN0_MSG2VAL_R          HWREG(0x40040164)
 
 //*****************************************************************************
 //
 // CAN registers (CAN1)
 //
 //*****************************************************************************
-#define CAN1_CTL_R              (*((volatile unsigned long *)0x40041000))
-#define CAN1_STS_R              (*((volatile unsigned long *)0x40041004))
-#define CAN1_ERR_R              (*((volatile unsigned long *)0x40041008))
-#define CAN1_BIT_R              (*((volatile unsigned long *)0x4004100C))
-#define CAN1_INT_R              (*((volatile unsigned long *)0x40041010))
-#define CAN1_TST_R              (*((volatile unsigned long *)0x40041014))
-#define CAN1_BRPE_R             (*((volatile unsigned long *)0x40041018))
-#define CAN1_IF1CRQ_R           (*((volatile unsigned long *)0x40041020))
-#define CAN1_IF1CMSK_R          (*((volatile unsigned long *)0x40041024))
-#define CAN1_IF1MSK1_R          (*((volatile unsigned long *)0x40041028))
-#define CAN1_IF1MSK2_R          (*((volatile unsigned long *)0x4004102C))
-#define CAN1_IF1ARB1_R          (*((volatile unsigned long *)0x40041030))
-#define CAN1_IF1ARB2_R          (*((volatile unsigned long *)0x40041034))
-#define CAN1_IF1MCTL_R          (*((volatile unsigned long *)0x40041038))
-#define CAN1_IF1DA1_R           (*((volatile unsigned long *)0x4004103C))
-#define CAN1_IF1DA2_R           (*((volatile unsigned long *)0x40041040))
-#define CAN1_IF1DB1_R           (*((volatile unsigned long *)0x40041044))
-#define CAN1_IF1DB2_R           (*((volatile unsigned long *)0x40041048))
-#define CAN1_IF2CRQ_R           (*((volatile unsigned long *)0x40041080))
-#define CAN1_IF2CMSK_R          (*((volatile unsigned long *)0x40041084))
-#define CAN1_IF2MSK1_R          (*((volatile unsigned long *)0x40041088))
-#define CAN1_IF2MSK2_R          (*((volatile unsigned long *)0x4004108C))
-#define CAN1_IF2ARB1_R          (*((volatile unsigned long *)0x40041090))
-#define CAN1_IF2ARB2_R          (*((volatile unsigned long *)0x40041094))
-#define CAN1_IF2MCTL_R          (*((volatile unsigned long *)0x40041098))
-#define CAN1_IF2DA1_R           (*((volatile unsigned long *)0x4004109C))
-#define CAN1_IF2DA2_R           (*((volatile unsigned long *)0x400410A0))
-#define CAN1_IF2DB1_R           (*((volatile unsigned long *)0x400410A4))
-#define CAN1_IF2DB2_R           (*((volatile unsigned long *)0x400410A8))
-#define CAN1_TXRQ1_R            (*((volatile unsigned long *)0x40041100))
-#define CAN1_TXRQ2_R            (*((volatile unsigned long *)0x40041104))
-#define CAN1_NWDA1_R            (*((volatile unsigned long *)0x40041120))
-#define CAN1_NWDA2_R            (*((volatile unsigned long *)0x40041124))
-#define CAN1_MSG1INT_R          (*((volatile unsigned long *)0x40041140))
-#define CAN1_MSG2INT_R          (*((volatile unsigned long *)0x40041144))
-#define CAN1_MSG1VAL_R          (*((volatile unsigned long *)0x40041160))
-#define CAN1_MSG2VAL_R          (*((volatile unsigned long *)0x40041164))
+#define CAN1_CTL_R              HWREG(0x40041000)
+#define CAN1_STS_R              HWREG(0x40041004)
+#define CAN1_ERR_R              HWREG(0x40041008)
+#define CAN1_BIT_R              HWREG(0x4004100C)
+#define CAN1_INT_R              HWREG(0x40041010)
+#define CAN1_TST_R              HWREG(0x40041014)
+#define CAN1_BRPE_R             HWREG(0x40041018)
+#define CAN1_IF1CRQ_R           HWREG(0x40041020)
+#define CAN1_IF1CMSK_R          HWREG(0x40041024)
+#define CAN1_IF1MSK1_R          HWREG(0x40041028)
+#define CAN1_IF1MSK2_R          HWREG(0x4004102C)
+#define CAN1_IF1ARB1_R          HWREG(0x40041030)
+#define CAN1_IF1ARB2_R          HWREG(0x40041034)
+#define CAN1_IF1MCTL_R          HWREG(0x40041038)
+#define CAN1_IF1DA1_R           HWREG(0x4004103C)
+#define CAN1_IF1DA2_R           HWREG(0x40041040)
+#define CAN1_IF1DB1_R           HWREG(0x40041044)
+#define CAN1_IF1DB2_R           HWREG(0x40041048)
+#define CAN1_IF2CRQ_R           HWREG(0x40041080)
+#define CAN1_IF2CMSK_R          HWREG(0x40041084)
+#define CAN1_IF2MSK1_R          HWREG(0x40041088)
+#define CAN1_IF2MSK2_R          HWREG(0x4004108C)
+#define CAN1_IF2ARB1_R          HWREG(0x40041090)
+#define CAN1_IF2ARB2_R          HWREG(0x40041094)
+#define CAN1_IF2MCTL_R          HWREG(0x40041098)
+#define CAN1_IF2DA1_R           HWREG(0x4004109C)
+#define CAN1_IF2DA2_R           HWREG(0x400410A0)
+#define CAN1_IF2DB1_R           HWREG(0x400410A4)
+#define CAN1_IF2DB2_R           HWREG(0x400410A8)
+#define CAN1_TXRQ1_R            HWREG(0x40041100)
+#define CAN1_TXRQ2_R            HWREG(0x40041104)
+#define CAN1_NWDA1_R            HWREG(0x40041120)
+#define CAN1_NWDA2_R            HWREG(0x40041124)
+#define CAN1_MSG1INT_R          HWREG(0x40041140)
+#define CAN1_MSG2INT_R          HWREG(0x40041144)
+#define CAN1_MSG1VAL_R          HWREG(0x40041160)
+#define CAN1_MSG2VAL_R          HWREG(0x40041164)
 
 //*****************************************************************************
 //
 // Timer registers (WTIMER2)
 //
 //*****************************************************************************
-#define WTIMER2_CFG_R           (*((volatile unsigned long *)0x4004C000))
-#define WTIMER2_TAMR_R          (*((volatile unsigned long *)0x4004C004))
-#define WTIMER2_TBMR_R          (*((volatile unsigned long *)0x4004C008))
-#define WTIMER2_CTL_R           (*((volatile unsigned long *)0x4004C00C))
-#define WTIMER2_SYNC_R          (*((volatile unsigned long *)0x4004C010))
-#define WTIMER2_IMR_R           (*((volatile unsigned long *)0x4004C018))
-#define WTIMER2_RIS_R           (*((volatile unsigned long *)0x4004C01C))
-#define WTIMER2_MIS_R           (*((volatile unsigned long *)0x4004C020))
-#define WTIMER2_ICR_R           (*((volatile unsigned long *)0x4004C024))
-#define WTIMER2_TAILR_R         (*((volatile unsigned long *)0x4004C028))
-#define WTIMER2_TBILR_R         (*((volatile unsigned long *)0x4004C02C))
-#define WTIMER2_TAMATCHR_R      (*((volatile unsigned long *)0x4004C030))
-#define WTIMER2_TBMATCHR_R      (*((volatile unsigned long *)0x4004C034))
-#define WTIMER2_TAPR_R          (*((volatile unsigned long *)0x4004C038))
-#define WTIMER2_TBPR_R          (*((volatile unsigned long *)0x4004C03C))
-#define WTIMER2_TAPMR_R         (*((volatile unsigned long *)0x4004C040))
-#define WTIMER2_TBPMR_R         (*((volatile unsigned long *)0x4004C044))
-#define WTIMER2_TAR_R           (*((volatile unsigned long *)0x4004C048))
-#define WTIMER2_TBR_R           (*((volatile unsigned long *)0x4004C04C))
-#define WTIMER2_TAV_R           (*((volatile unsigned long *)0x4004C050))
-#define WTIMER2_TBV_R           (*((volatile unsigned long *)0x4004C054))
-#define WTIMER2_RTCPD_R         (*((volatile unsigned long *)0x4004C058))
-#define WTIMER2_TAPS_R          (*((volatile unsigned long *)0x4004C05C))
-#define WTIMER2_TBPS_R          (*((volatile unsigned long *)0x4004C060))
-#define WTIMER2_TAPV_R          (*((volatile unsigned long *)0x4004C064))
-#define WTIMER2_TBPV_R          (*((volatile unsigned long *)0x4004C068))
-#define WTIMER2_PP_R            (*((volatile unsigned long *)0x4004CFC0))
+#define WTIMER2_CFG_R           HWREG(0x4004C000)
+#define WTIMER2_TAMR_R          HWREG(0x4004C004)
+#define WTIMER2_TBMR_R          HWREG(0x4004C008)
+#define WTIMER2_CTL_R           HWREG(0x4004C00C)
+#define WTIMER2_SYNC_R          HWREG(0x4004C010)
+#define WTIMER2_IMR_R           HWREG(0x4004C018)
+#define WTIMER2_RIS_R           HWREG(0x4004C01C)
+#define WTIMER2_MIS_R           HWREG(0x4004C020)
+#define WTIMER2_ICR_R           HWREG(0x4004C024)
+#define WTIMER2_TAILR_R         HWREG(0x4004C028)
+#define WTIMER2_TBILR_R         HWREG(0x4004C02C)
+#define WTIMER2_TAMATCHR_R      HWREG(0x4004C030)
+#define WTIMER2_TBMATCHR_R      HWREG(0x4004C034)
+#define WTIMER2_TAPR_R          HWREG(0x4004C038)
+#define WTIMER2_TBPR_R          HWREG(0x4004C03C)
+#define WTIMER2_TAPMR_R         HWREG(0x4004C040)
+#define WTIMER2_TBPMR_R         HWREG(0x4004C044)
+#define WTIMER2_TAR_R           HWREG(0x4004C048)
+#define WTIMER2_TBR_R           HWREG(0x4004C04C)
+#define WTIMER2_TAV_R           HWREG(0x4004C050)
+#define WTIMER2_TBV_R           HWREG(0x4004C054)
+#define WTIMER2_RTCPD_R         HWREG(0x4004C058)
+#define WTIMER2_TAPS_R          HWREG(0x4004C05C)
+#define WTIMER2_TBPS_R          HWREG(0x4004C060)
+#define WTIMER2_TAPV_R          HWREG(0x4004C064)
+#define WTIMER2_TBPV_R          HWREG(0x4004C068)
+#define WTIMER2_PP_R            HWREG(0x4004CFC0)
 
 //*****************************************************************************
 //
 // Timer registers (WTIMER3)
 //
 //*****************************************************************************
-#define WTIMER3_CFG_R           (*((volatile unsigned long *)0x4004D000))
-#define WTIMER3_TAMR_R          (*((volatile unsigned long *)0x4004D004))
-#define WTIMER3_TBMR_R          (*((volatile unsigned long *)0x4004D008))
-#define WTIMER3_CTL_R           (*((volatile unsigned long *)0x4004D00C))
-#define WTIMER3_SYNC_R          (*((volatile unsigned long *)0x4004D010))
-#define WTIMER3_IMR_R           (*((volatile unsigned long *)0x4004D018))
-#define WTIMER3_RIS_R           (*((volatile unsigned long *)0x4004D01C))
-#define WTIMER3_MIS_R           (*((volatile unsigned long *)0x4004D020))
-#define WTIMER3_ICR_R           (*((volatile unsigned long *)0x4004D024))
-#define WTIMER3_TAILR_R         (*((volatile unsigned long *)0x4004D028))
-#define WTIMER3_TBILR_R         (*((volatile unsigned long *)0x4004D02C))
-#define WTIMER3_TAMATCHR_R      (*((volatile unsigned long *)0x4004D030))
-#define WTIMER3_TBMATCHR_R      (*((volatile unsigned long *)0x4004D034))
-#define WTIMER3_TAPR_R          (*((volatile unsigned long *)0x4004D038))
-#define WTIMER3_TBPR_R          (*((volatile unsigned long *)0x4004D03C))
-#define WTIMER3_TAPMR_R         (*((volatile unsigned long *)0x4004D040))
-#define WTIMER3_TBPMR_R         (*((volatile unsigned long *)0x4004D044))
-#define WTIMER3_TAR_R           (*((volatile unsigned long *)0x4004D048))
-#define WTIMER3_TBR_R           (*((volatile unsigned long *)0x4004D04C))
-#define WTIMER3_TAV_R           (*((volatile unsigned long *)0x4004D050))
-#define WTIMER3_TBV_R           (*((volatile unsigned long *)0x4004D054))
-#define WTIMER3_RTCPD_R         (*((volatile unsigned long *)0x4004D058))
-#define WTIMER3_TAPS_R          (*((volatile unsigned long *)0x4004D05C))
-#define WTIMER3_TBPS_R          (*((volatile unsigned long *)0x4004D060))
-#define WTIMER3_TAPV_R          (*((volatile unsigned long *)0x4004D064))
-#define WTIMER3_TBPV_R          (*((volatile unsigned long *)0x4004D068))
-#define WTIMER3_PP_R            (*((volatile unsigned long *)0x4004DFC0))
+#define WTIMER3_CFG_R           HWREG(0x4004D000)
+#define WTIMER3_TAMR_R          HWREG(0x4004D004)
+#define WTIMER3_TBMR_R          HWREG(0x4004D008)
+#define WTIMER3_CTL_R           HWREG(0x4004D00C)
+#define WTIMER3_SYNC_R          HWREG(0x4004D010)
+#define WTIMER3_IMR_R           HWREG(0x4004D018)
+#define WTIMER3_RIS_R           HWREG(0x4004D01C)
+#define WTIMER3_MIS_R           HWREG(0x4004D020)
+#define WTIMER3_ICR_R           HWREG(0x4004D024)
+#define WTIMER3_TAILR_R         HWREG(0x4004D028)
+#define WTIMER3_TBILR_R         HWREG(0x4004D02C)
+#define WTIMER3_TAMATCHR_R      HWREG(0x4004D030)
+#define WTIMER3_TBMATCHR_R      HWREG(0x4004D034)
+#define WTIMER3_TAPR_R          HWREG(0x4004D038)
+#define WTIMER3_TBPR_R          HWREG(0x4004D03C)
+#define WTIMER3_TAPMR_R         HWREG(0x4004D040)
+#define WTIMER3_TBPMR_R         HWREG(0x4004D044)
+#define WTIMER3_TAR_R           HWREG(0x4004D048)
+#define WTIMER3_TBR_R           HWREG(0x4004D04C)
+#define WTIMER3_TAV_R           HWREG(0x4004D050)
+#define WTIMER3_TBV_R           HWREG(0x4004D054)
+#define WTIMER3_RTCPD_R         HWREG(0x4004D058)
+#define WTIMER3_TAPS_R          HWREG(0x4004D05C)
+#define WTIMER3_TBPS_R          HWREG(0x4004D060)
+#define WTIMER3_TAPV_R          HWREG(0x4004D064)
+#define WTIMER3_TBPV_R          HWREG(0x4004D068)
+#define WTIMER3_PP_R            HWREG(0x4004DFC0)
 
 //*****************************************************************************
 //
 // Timer registers (WTIMER4)
 //
 //*****************************************************************************
-#define WTIMER4_CFG_R           (*((volatile unsigned long *)0x4004E000))
-#define WTIMER4_TAMR_R          (*((volatile unsigned long *)0x4004E004))
-#define WTIMER4_TBMR_R          (*((volatile unsigned long *)0x4004E008))
-#define WTIMER4_CTL_R           (*((volatile unsigned long *)0x4004E00C))
-#define WTIMER4_SYNC_R          (*((volatile unsigned long *)0x4004E010))
-#define WTIMER4_IMR_R           (*((volatile unsigned long *)0x4004E018))
-#define WTIMER4_RIS_R           (*((volatile unsigned long *)0x4004E01C))
-#define WTIMER4_MIS_R           (*((volatile unsigned long *)0x4004E020))
-#define WTIMER4_ICR_R           (*((volatile unsigned long *)0x4004E024))
-#define WTIMER4_TAILR_R         (*((volatile unsigned long *)0x4004E028))
-#define WTIMER4_TBILR_R         (*((volatile unsigned long *)0x4004E02C))
-#define WTIMER4_TAMATCHR_R      (*((volatile unsigned long *)0x4004E030))
-#define WTIMER4_TBMATCHR_R      (*((volatile unsigned long *)0x4004E034))
-#define WTIMER4_TAPR_R          (*((volatile unsigned long *)0x4004E038))
-#define WTIMER4_TBPR_R          (*((volatile unsigned long *)0x4004E03C))
-#define WTIMER4_TAPMR_R         (*((volatile unsigned long *)0x4004E040))
-#define WTIMER4_TBPMR_R         (*((volatile unsigned long *)0x4004E044))
-#define WTIMER4_TAR_R           (*((volatile unsigned long *)0x4004E048))
-#define WTIMER4_TBR_R           (*((volatile unsigned long *)0x4004E04C))
-#define WTIMER4_TAV_R           (*((volatile unsigned long *)0x4004E050))
-#define WTIMER4_TBV_R           (*((volatile unsigned long *)0x4004E054))
-#define WTIMER4_RTCPD_R         (*((volatile unsigned long *)0x4004E058))
-#define WTIMER4_TAPS_R          (*((volatile unsigned long *)0x4004E05C))
-#define WTIMER4_TBPS_R          (*((volatile unsigned long *)0x4004E060))
-#define WTIMER4_TAPV_R          (*((volatile unsigned long *)0x4004E064))
-#define WTIMER4_TBPV_R          (*((volatile unsigned long *)0x4004E068))
-#define WTIMER4_PP_R            (*((volatile unsigned long *)0x4004EFC0))
+#define WTIMER4_CFG_R           HWREG(0x4004E000)
+#define WTIMER4_TAMR_R          HWREG(0x4004E004)
+#define WTIMER4_TBMR_R          HWREG(0x4004E008)
+#define WTIMER4_CTL_R           HWREG(0x4004E00C)
+#define WTIMER4_SYNC_R          HWREG(0x4004E010)
+#define WTIMER4_IMR_R           HWREG(0x4004E018)
+#define WTIMER4_RIS_R           HWREG(0x4004E01C)
+#define WTIMER4_MIS_R           HWREG(0x4004E020)
+#define WTIMER4_ICR_R           HWREG(0x4004E024)
+#define WTIMER4_TAILR_R         HWREG(0x4004E028)
+#define WTIMER4_TBILR_R         HWREG(0x4004E02C)
+#define WTIMER4_TAMATCHR_R      HWREG(0x4004E030)
+#define WTIMER4_TBMATCHR_R      HWREG(0x4004E034)
+#define WTIMER4_TAPR_R          HWREG(0x4004E038)
+#define WTIMER4_TBPR_R          HWREG(0x4004E03C)
+#define WTIMER4_TAPMR_R         HWREG(0x4004E040)
+#define WTIMER4_TBPMR_R         HWREG(0x4004E044)
+#define WTIMER4_TAR_R           HWREG(0x4004E048)
+#define WTIMER4_TBR_R           HWREG(0x4004E04C)
+#define WTIMER4_TAV_R           HWREG(0x4004E050)
+#define WTIMER4_TBV_R           HWREG(0x4004E054)
+#define WTIMER4_RTCPD_R         HWREG(0x4004E058)
+#define WTIMER4_TAPS_R          HWREG(0x4004E05C)
+#define WTIMER4_TBPS_R          HWREG(0x4004E060)
+#define WTIMER4_TAPV_R          HWREG(0x4004E064)
+#define WTIMER4_TBPV_R          HWREG(0x4004E068)
+#define WTIMER4_PP_R            HWREG(0x4004EFC0)
 
 //*****************************************************************************
 //
 // Timer registers (WTIMER5)
 //
 //*****************************************************************************
-#define WTIMER5_CFG_R           (*((volatile unsigned long *)0x4004F000))
-#define WTIMER5_TAMR_R          (*((volatile unsigned long *)0x4004F004))
-#define WTIMER5_TBMR_R          (*((volatile unsigned long *)0x4004F008))
-#define WTIMER5_CTL_R           (*((volatile unsigned long *)0x4004F00C))
-#define WTIMER5_SYNC_R          (*((volatile unsigned long *)0x4004F010))
-#define WTIMER5_IMR_R           (*((volatile unsigned long *)0x4004F018))
-#define WTIMER5_RIS_R           (*((volatile unsigned long *)0x4004F01C))
-#define WTIMER5_MIS_R           (*((volatile unsigned long *)0x4004F020))
-#define WTIMER5_ICR_R           (*((volatile unsigned long *)0x4004F024))
-#define WTIMER5_TAILR_R         (*((volatile unsigned long *)0x4004F028))
-#define WTIMER5_TBILR_R         (*((volatile unsigned long *)0x4004F02C))
-#define WTIMER5_TAMATCHR_R      (*((volatile unsigned long *)0x4004F030))
-#define WTIMER5_TBMATCHR_R      (*((volatile unsigned long *)0x4004F034))
-#define WTIMER5_TAPR_R          (*((volatile unsigned long *)0x4004F038))
-#define WTIMER5_TBPR_R          (*((volatile unsigned long *)0x4004F03C))
-#define WTIMER5_TAPMR_R         (*((volatile unsigned long *)0x4004F040))
-#define WTIMER5_TBPMR_R         (*((volatile unsigned long *)0x4004F044))
-#define WTIMER5_TAR_R           (*((volatile unsigned long *)0x4004F048))
-#define WTIMER5_TBR_R           (*((volatile unsigned long *)0x4004F04C))
-#define WTIMER5_TAV_R           (*((volatile unsigned long *)0x4004F050))
-#define WTIMER5_TBV_R           (*((volatile unsigned long *)0x4004F054))
-#define WTIMER5_RTCPD_R         (*((volatile unsigned long *)0x4004F058))
-#define WTIMER5_TAPS_R          (*((volatile unsigned long *)0x4004F05C))
-#define WTIMER5_TBPS_R          (*((volatile unsigned long *)0x4004F060))
-#define WTIMER5_TAPV_R          (*((volatile unsigned long *)0x4004F064))
-#define WTIMER5_TBPV_R          (*((volatile unsigned long *)0x4004F068))
-#define WTIMER5_PP_R            (*((volatile unsigned long *)0x4004FFC0))
+#define WTIMER5_CFG_R           HWREG(0x4004F000)
+#define WTIMER5_TAMR_R          HWREG(0x4004F004)
+#define WTIMER5_TBMR_R          HWREG(0x4004F008)
+#define WTIMER5_CTL_R           HWREG(0x4004F00C)
+#define WTIMER5_SYNC_R          HWREG(0x4004F010)
+#define WTIMER5_IMR_R           HWREG(0x4004F018)
+#define WTIMER5_RIS_R           HWREG(0x4004F01C)
+#define WTIMER5_MIS_R           HWREG(0x4004F020)
+#define WTIMER5_ICR_R           HWREG(0x4004F024)
+#define WTIMER5_TAILR_R         HWREG(0x4004F028)
+#define WTIMER5_TBILR_R         HWREG(0x4004F02C)
+#define WTIMER5_TAMATCHR_R      HWREG(0x4004F030)
+#define WTIMER5_TBMATCHR_R      HWREG(0x4004F034)
+#define WTIMER5_TAPR_R          HWREG(0x4004F038)
+#define WTIMER5_TBPR_R          HWREG(0x4004F03C)
+#define WTIMER5_TAPMR_R         HWREG(0x4004F040)
+#define WTIMER5_TBPMR_R         HWREG(0x4004F044)
+#define WTIMER5_TAR_R           HWREG(0x4004F048)
+#define WTIMER5_TBR_R           HWREG(0x4004F04C)
+#define WTIMER5_TAV_R           HWREG(0x4004F050)
+#define WTIMER5_TBV_R           HWREG(0x4004F054)
+#define WTIMER5_RTCPD_R         HWREG(0x4004F058)
+#define WTIMER5_TAPS_R          HWREG(0x4004F05C)
+#define WTIMER5_TBPS_R          HWREG(0x4004F060)
+#define WTIMER5_TAPV_R          HWREG(0x4004F064)
+#define WTIMER5_TBPV_R          HWREG(0x4004F068)
+#define WTIMER5_PP_R            HWREG(0x4004FFC0)
 
 //*****************************************************************************
 //
@@ -1582,14 +1597,14 @@
 #define USB0_FRAME_R            (*((volatile unsigned short *)0x4005000C))
 #define USB0_EPIDX_R            (*((volatile unsigned char *)0x4005000E))
 #define USB0_TEST_R             (*((volatile unsigned char *)0x4005000F))
-#define USB0_FIFO0_R            (*((volatile unsigned long *)0x40050020))
-#define USB0_FIFO1_R            (*((volatile unsigned long *)0x40050024))
-#define USB0_FIFO2_R            (*((volatile unsigned long *)0x40050028))
-#define USB0_FIFO3_R            (*((volatile unsigned long *)0x4005002C))
-#define USB0_FIFO4_R            (*((volatile unsigned long *)0x40050030))
-#define USB0_FIFO5_R            (*((volatile unsigned long *)0x40050034))
-#define USB0_FIFO6_R            (*((volatile unsigned long *)0x40050038))
-#define USB0_FIFO7_R            (*((volatile unsigned long *)0x4005003C))
+#define USB0_FIFO0_R            HWREG(0x40050020)
+#define USB0_FIFO1_R            HWREG(0x40050024)
+#define USB0_FIFO2_R            HWREG(0x40050028)
+#define USB0_FIFO3_R            HWREG(0x4005002C)
+#define USB0_FIFO4_R            HWREG(0x40050030)
+#define USB0_FIFO5_R            HWREG(0x40050034)
+#define USB0_FIFO6_R            HWREG(0x40050038)
+#define USB0_FIFO7_R            HWREG(0x4005003C)
 #define USB0_DEVCTL_R           (*((volatile unsigned char *)0x40050060))
 #define USB0_TXFIFOSZ_R         (*((volatile unsigned char *)0x40050062))
 #define USB0_RXFIFOSZ_R         (*((volatile unsigned char *)0x40050063))
@@ -1735,23 +1750,23 @@
 #define USB0_RQPKTCOUNT7_R      (*((volatile unsigned short *)0x4005031C))
 #define USB0_RXDPKTBUFDIS_R     (*((volatile unsigned short *)0x40050340))
 #define USB0_TXDPKTBUFDIS_R     (*((volatile unsigned short *)0x40050342))
-#define USB0_EPC_R              (*((volatile unsigned long *)0x40050400))
-#define USB0_EPCRIS_R           (*((volatile unsigned long *)0x40050404))
-#define USB0_EPCIM_R            (*((volatile unsigned long *)0x40050408))
-#define USB0_EPCISC_R           (*((volatile unsigned long *)0x4005040C))
-#define USB0_DRRIS_R            (*((volatile unsigned long *)0x40050410))
-#define USB0_DRIM_R             (*((volatile unsigned long *)0x40050414))
-#define USB0_DRISC_R            (*((volatile unsigned long *)0x40050418))
-#define USB0_GPCS_R             (*((volatile unsigned long *)0x4005041C))
-#define USB0_VDC_R              (*((volatile unsigned long *)0x40050430))
-#define USB0_VDCRIS_R           (*((volatile unsigned long *)0x40050434))
-#define USB0_VDCIM_R            (*((volatile unsigned long *)0x40050438))
-#define USB0_VDCISC_R           (*((volatile unsigned long *)0x4005043C))
-#define USB0_IDVRIS_R           (*((volatile unsigned long *)0x40050444))
-#define USB0_IDVIM_R            (*((volatile unsigned long *)0x40050448))
-#define USB0_IDVISC_R           (*((volatile unsigned long *)0x4005044C))
-#define USB0_DMASEL_R           (*((volatile unsigned long *)0x40050450))
-#define USB0_PP_R               (*((volatile unsigned long *)0x40050FC0))
+#define USB0_EPC_R              HWREG(0x40050400)
+#define USB0_EPCRIS_R           HWREG(0x40050404)
+#define USB0_EPCIM_R            HWREG(0x40050408)
+#define USB0_EPCISC_R           HWREG(0x4005040C)
+#define USB0_DRRIS_R            HWREG(0x40050410)
+#define USB0_DRIM_R             HWREG(0x40050414)
+#define USB0_DRISC_R            HWREG(0x40050418)
+#define USB0_GPCS_R             HWREG(0x4005041C)
+#define USB0_VDC_R              HWREG(0x40050430)
+#define USB0_VDCRIS_R           HWREG(0x40050434)
+#define USB0_VDCIM_R            HWREG(0x40050438)
+#define USB0_VDCISC_R           HWREG(0x4005043C)
+#define USB0_IDVRIS_R           HWREG(0x40050444)
+#define USB0_IDVIM_R            HWREG(0x40050448)
+#define USB0_IDVISC_R           HWREG(0x4005044C)
+#define USB0_DMASEL_R           HWREG(0x40050450)
+#define USB0_PP_R               HWREG(0x40050FC0)
 
 //*****************************************************************************
 //
@@ -1760,30 +1775,30 @@
 //*****************************************************************************
 #define GPIO_PORTA_AHB_DATA_BITS_R                                            \
                                 ((volatile unsigned long *)0x40058000)
-#define GPIO_PORTA_AHB_DATA_R   (*((volatile unsigned long *)0x400583FC))
-#define GPIO_PORTA_AHB_DIR_R    (*((volatile unsigned long *)0x40058400))
-#define GPIO_PORTA_AHB_IS_R     (*((volatile unsigned long *)0x40058404))
-#define GPIO_PORTA_AHB_IBE_R    (*((volatile unsigned long *)0x40058408))
-#define GPIO_PORTA_AHB_IEV_R    (*((volatile unsigned long *)0x4005840C))
-#define GPIO_PORTA_AHB_IM_R     (*((volatile unsigned long *)0x40058410))
-#define GPIO_PORTA_AHB_RIS_R    (*((volatile unsigned long *)0x40058414))
-#define GPIO_PORTA_AHB_MIS_R    (*((volatile unsigned long *)0x40058418))
-#define GPIO_PORTA_AHB_ICR_R    (*((volatile unsigned long *)0x4005841C))
-#define GPIO_PORTA_AHB_AFSEL_R  (*((volatile unsigned long *)0x40058420))
-#define GPIO_PORTA_AHB_DR2R_R   (*((volatile unsigned long *)0x40058500))
-#define GPIO_PORTA_AHB_DR4R_R   (*((volatile unsigned long *)0x40058504))
-#define GPIO_PORTA_AHB_DR8R_R   (*((volatile unsigned long *)0x40058508))
-#define GPIO_PORTA_AHB_ODR_R    (*((volatile unsigned long *)0x4005850C))
-#define GPIO_PORTA_AHB_PUR_R    (*((volatile unsigned long *)0x40058510))
-#define GPIO_PORTA_AHB_PDR_R    (*((volatile unsigned long *)0x40058514))
-#define GPIO_PORTA_AHB_SLR_R    (*((volatile unsigned long *)0x40058518))
-#define GPIO_PORTA_AHB_DEN_R    (*((volatile unsigned long *)0x4005851C))
-#define GPIO_PORTA_AHB_LOCK_R   (*((volatile unsigned long *)0x40058520))
-#define GPIO_PORTA_AHB_CR_R     (*((volatile unsigned long *)0x40058524))
-#define GPIO_PORTA_AHB_AMSEL_R  (*((volatile unsigned long *)0x40058528))
-#define GPIO_PORTA_AHB_PCTL_R   (*((volatile unsigned long *)0x4005852C))
-#define GPIO_PORTA_AHB_ADCCTL_R (*((volatile unsigned long *)0x40058530))
-#define GPIO_PORTA_AHB_DMACTL_R (*((volatile unsigned long *)0x40058534))
+#define GPIO_PORTA_AHB_DATA_R   HWREG(0x400583FC)
+#define GPIO_PORTA_AHB_DIR_R    HWREG(0x40058400)
+#define GPIO_PORTA_AHB_IS_R     HWREG(0x40058404)
+#define GPIO_PORTA_AHB_IBE_R    HWREG(0x40058408)
+#define GPIO_PORTA_AHB_IEV_R    HWREG(0x4005840C)
+#define GPIO_PORTA_AHB_IM_R     HWREG(0x40058410)
+#define GPIO_PORTA_AHB_RIS_R    HWREG(0x40058414)
+#define GPIO_PORTA_AHB_MIS_R    HWREG(0x40058418)
+#define GPIO_PORTA_AHB_ICR_R    HWREG(0x4005841C)
+#define GPIO_PORTA_AHB_AFSEL_R  HWREG(0x40058420)
+#define GPIO_PORTA_AHB_DR2R_R   HWREG(0x40058500)
+#define GPIO_PORTA_AHB_DR4R_R   HWREG(0x40058504)
+#define GPIO_PORTA_AHB_DR8R_R   HWREG(0x40058508)
+#define GPIO_PORTA_AHB_ODR_R    HWREG(0x4005850C)
+#define GPIO_PORTA_AHB_PUR_R    HWREG(0x40058510)
+#define GPIO_PORTA_AHB_PDR_R    HWREG(0x40058514)
+#define GPIO_PORTA_AHB_SLR_R    HWREG(0x40058518)
+#define GPIO_PORTA_AHB_DEN_R    HWREG(0x4005851C)
+#define GPIO_PORTA_AHB_LOCK_R   HWREG(0x40058520)
+#define GPIO_PORTA_AHB_CR_R     HWREG(0x40058524)
+#define GPIO_PORTA_AHB_AMSEL_R  HWREG(0x40058528)
+#define GPIO_PORTA_AHB_PCTL_R   HWREG(0x4005852C)
+#define GPIO_PORTA_AHB_ADCCTL_R HWREG(0x40058530)
+#define GPIO_PORTA_AHB_DMACTL_R HWREG(0x40058534)
 
 //*****************************************************************************
 //
@@ -1792,30 +1807,30 @@
 //*****************************************************************************
 #define GPIO_PORTB_AHB_DATA_BITS_R                                            \
                                 ((volatile unsigned long *)0x40059000)
-#define GPIO_PORTB_AHB_DATA_R   (*((volatile unsigned long *)0x400593FC))
-#define GPIO_PORTB_AHB_DIR_R    (*((volatile unsigned long *)0x40059400))
-#define GPIO_PORTB_AHB_IS_R     (*((volatile unsigned long *)0x40059404))
-#define GPIO_PORTB_AHB_IBE_R    (*((volatile unsigned long *)0x40059408))
-#define GPIO_PORTB_AHB_IEV_R    (*((volatile unsigned long *)0x4005940C))
-#define GPIO_PORTB_AHB_IM_R     (*((volatile unsigned long *)0x40059410))
-#define GPIO_PORTB_AHB_RIS_R    (*((volatile unsigned long *)0x40059414))
-#define GPIO_PORTB_AHB_MIS_R    (*((volatile unsigned long *)0x40059418))
-#define GPIO_PORTB_AHB_ICR_R    (*((volatile unsigned long *)0x4005941C))
-#define GPIO_PORTB_AHB_AFSEL_R  (*((volatile unsigned long *)0x40059420))
-#define GPIO_PORTB_AHB_DR2R_R   (*((volatile unsigned long *)0x40059500))
-#define GPIO_PORTB_AHB_DR4R_R   (*((volatile unsigned long *)0x40059504))
-#define GPIO_PORTB_AHB_DR8R_R   (*((volatile unsigned long *)0x40059508))
-#define GPIO_PORTB_AHB_ODR_R    (*((volatile unsigned long *)0x4005950C))
-#define GPIO_PORTB_AHB_PUR_R    (*((volatile unsigned long *)0x40059510))
-#define GPIO_PORTB_AHB_PDR_R    (*((volatile unsigned long *)0x40059514))
-#define GPIO_PORTB_AHB_SLR_R    (*((volatile unsigned long *)0x40059518))
-#define GPIO_PORTB_AHB_DEN_R    (*((volatile unsigned long *)0x4005951C))
-#define GPIO_PORTB_AHB_LOCK_R   (*((volatile unsigned long *)0x40059520))
-#define GPIO_PORTB_AHB_CR_R     (*((volatile unsigned long *)0x40059524))
-#define GPIO_PORTB_AHB_AMSEL_R  (*((volatile unsigned long *)0x40059528))
-#define GPIO_PORTB_AHB_PCTL_R   (*((volatile unsigned long *)0x4005952C))
-#define GPIO_PORTB_AHB_ADCCTL_R (*((volatile unsigned long *)0x40059530))
-#define GPIO_PORTB_AHB_DMACTL_R (*((volatile unsigned long *)0x40059534))
+#define GPIO_PORTB_AHB_DATA_R   HWREG(0x400593FC)
+#define GPIO_PORTB_AHB_DIR_R    HWREG(0x40059400)
+#define GPIO_PORTB_AHB_IS_R     HWREG(0x40059404)
+#define GPIO_PORTB_AHB_IBE_R    HWREG(0x40059408)
+#define GPIO_PORTB_AHB_IEV_R    HWREG(0x4005940C)
+#define GPIO_PORTB_AHB_IM_R     HWREG(0x40059410)
+#define GPIO_PORTB_AHB_RIS_R    HWREG(0x40059414)
+#define GPIO_PORTB_AHB_MIS_R    HWREG(0x40059418)
+#define GPIO_PORTB_AHB_ICR_R    HWREG(0x4005941C)
+#define GPIO_PORTB_AHB_AFSEL_R  HWREG(0x40059420)
+#define GPIO_PORTB_AHB_DR2R_R   HWREG(0x40059500)
+#define GPIO_PORTB_AHB_DR4R_R   HWREG(0x40059504)
+#define GPIO_PORTB_AHB_DR8R_R   HWREG(0x40059508)
+#define GPIO_PORTB_AHB_ODR_R    HWREG(0x4005950C)
+#define GPIO_PORTB_AHB_PUR_R    HWREG(0x40059510)
+#define GPIO_PORTB_AHB_PDR_R    HWREG(0x40059514)
+#define GPIO_PORTB_AHB_SLR_R    HWREG(0x40059518)
+#define GPIO_PORTB_AHB_DEN_R    HWREG(0x4005951C)
+#define GPIO_PORTB_AHB_LOCK_R   HWREG(0x40059520)
+#define GPIO_PORTB_AHB_CR_R     HWREG(0x40059524)
+#define GPIO_PORTB_AHB_AMSEL_R  HWREG(0x40059528)
+#define GPIO_PORTB_AHB_PCTL_R   HWREG(0x4005952C)
+#define GPIO_PORTB_AHB_ADCCTL_R HWREG(0x40059530)
+#define GPIO_PORTB_AHB_DMACTL_R HWREG(0x40059534)
 
 //*****************************************************************************
 //
@@ -1824,30 +1839,30 @@
 //*****************************************************************************
 #define GPIO_PORTC_AHB_DATA_BITS_R                                            \
                                 ((volatile unsigned long *)0x4005A000)
-#define GPIO_PORTC_AHB_DATA_R   (*((volatile unsigned long *)0x4005A3FC))
-#define GPIO_PORTC_AHB_DIR_R    (*((volatile unsigned long *)0x4005A400))
-#define GPIO_PORTC_AHB_IS_R     (*((volatile unsigned long *)0x4005A404))
-#define GPIO_PORTC_AHB_IBE_R    (*((volatile unsigned long *)0x4005A408))
-#define GPIO_PORTC_AHB_IEV_R    (*((volatile unsigned long *)0x4005A40C))
-#define GPIO_PORTC_AHB_IM_R     (*((volatile unsigned long *)0x4005A410))
-#define GPIO_PORTC_AHB_RIS_R    (*((volatile unsigned long *)0x4005A414))
-#define GPIO_PORTC_AHB_MIS_R    (*((volatile unsigned long *)0x4005A418))
-#define GPIO_PORTC_AHB_ICR_R    (*((volatile unsigned long *)0x4005A41C))
-#define GPIO_PORTC_AHB_AFSEL_R  (*((volatile unsigned long *)0x4005A420))
-#define GPIO_PORTC_AHB_DR2R_R   (*((volatile unsigned long *)0x4005A500))
-#define GPIO_PORTC_AHB_DR4R_R   (*((volatile unsigned long *)0x4005A504))
-#define GPIO_PORTC_AHB_DR8R_R   (*((volatile unsigned long *)0x4005A508))
-#define GPIO_PORTC_AHB_ODR_R    (*((volatile unsigned long *)0x4005A50C))
-#define GPIO_PORTC_AHB_PUR_R    (*((volatile unsigned long *)0x4005A510))
-#define GPIO_PORTC_AHB_PDR_R    (*((volatile unsigned long *)0x4005A514))
-#define GPIO_PORTC_AHB_SLR_R    (*((volatile unsigned long *)0x4005A518))
-#define GPIO_PORTC_AHB_DEN_R    (*((volatile unsigned long *)0x4005A51C))
-#define GPIO_PORTC_AHB_LOCK_R   (*((volatile unsigned long *)0x4005A520))
-#define GPIO_PORTC_AHB_CR_R     (*((volatile unsigned long *)0x4005A524))
-#define GPIO_PORTC_AHB_AMSEL_R  (*((volatile unsigned long *)0x4005A528))
-#define GPIO_PORTC_AHB_PCTL_R   (*((volatile unsigned long *)0x4005A52C))
-#define GPIO_PORTC_AHB_ADCCTL_R (*((volatile unsigned long *)0x4005A530))
-#define GPIO_PORTC_AHB_DMACTL_R (*((volatile unsigned long *)0x4005A534))
+#define GPIO_PORTC_AHB_DATA_R   HWREG(0x4005A3FC)
+#define GPIO_PORTC_AHB_DIR_R    HWREG(0x4005A400)
+#define GPIO_PORTC_AHB_IS_R     HWREG(0x4005A404)
+#define GPIO_PORTC_AHB_IBE_R    HWREG(0x4005A408)
+#define GPIO_PORTC_AHB_IEV_R    HWREG(0x4005A40C)
+#define GPIO_PORTC_AHB_IM_R     HWREG(0x4005A410)
+#define GPIO_PORTC_AHB_RIS_R    HWREG(0x4005A414)
+#define GPIO_PORTC_AHB_MIS_R    HWREG(0x4005A418)
+#define GPIO_PORTC_AHB_ICR_R    HWREG(0x4005A41C)
+#define GPIO_PORTC_AHB_AFSEL_R  HWREG(0x4005A420)
+#define GPIO_PORTC_AHB_DR2R_R   HWREG(0x4005A500)
+#define GPIO_PORTC_AHB_DR4R_R   HWREG(0x4005A504)
+#define GPIO_PORTC_AHB_DR8R_R   HWREG(0x4005A508)
+#define GPIO_PORTC_AHB_ODR_R    HWREG(0x4005A50C)
+#define GPIO_PORTC_AHB_PUR_R    HWREG(0x4005A510)
+#define GPIO_PORTC_AHB_PDR_R    HWREG(0x4005A514)
+#define GPIO_PORTC_AHB_SLR_R    HWREG(0x4005A518)
+#define GPIO_PORTC_AHB_DEN_R    HWREG(0x4005A51C)
+#define GPIO_PORTC_AHB_LOCK_R   HWREG(0x4005A520)
+#define GPIO_PORTC_AHB_CR_R     HWREG(0x4005A524)
+#define GPIO_PORTC_AHB_AMSEL_R  HWREG(0x4005A528)
+#define GPIO_PORTC_AHB_PCTL_R   HWREG(0x4005A52C)
+#define GPIO_PORTC_AHB_ADCCTL_R HWREG(0x4005A530)
+#define GPIO_PORTC_AHB_DMACTL_R HWREG(0x4005A534)
 
 //*****************************************************************************
 //
@@ -1856,30 +1871,30 @@
 //*****************************************************************************
 #define GPIO_PORTD_AHB_DATA_BITS_R                                            \
                                 ((volatile unsigned long *)0x4005B000)
-#define GPIO_PORTD_AHB_DATA_R   (*((volatile unsigned long *)0x4005B3FC))
-#define GPIO_PORTD_AHB_DIR_R    (*((volatile unsigned long *)0x4005B400))
-#define GPIO_PORTD_AHB_IS_R     (*((volatile unsigned long *)0x4005B404))
-#define GPIO_PORTD_AHB_IBE_R    (*((volatile unsigned long *)0x4005B408))
-#define GPIO_PORTD_AHB_IEV_R    (*((volatile unsigned long *)0x4005B40C))
-#define GPIO_PORTD_AHB_IM_R     (*((volatile unsigned long *)0x4005B410))
-#define GPIO_PORTD_AHB_RIS_R    (*((volatile unsigned long *)0x4005B414))
-#define GPIO_PORTD_AHB_MIS_R    (*((volatile unsigned long *)0x4005B418))
-#define GPIO_PORTD_AHB_ICR_R    (*((volatile unsigned long *)0x4005B41C))
-#define GPIO_PORTD_AHB_AFSEL_R  (*((volatile unsigned long *)0x4005B420))
-#define GPIO_PORTD_AHB_DR2R_R   (*((volatile unsigned long *)0x4005B500))
-#define GPIO_PORTD_AHB_DR4R_R   (*((volatile unsigned long *)0x4005B504))
-#define GPIO_PORTD_AHB_DR8R_R   (*((volatile unsigned long *)0x4005B508))
-#define GPIO_PORTD_AHB_ODR_R    (*((volatile unsigned long *)0x4005B50C))
-#define GPIO_PORTD_AHB_PUR_R    (*((volatile unsigned long *)0x4005B510))
-#define GPIO_PORTD_AHB_PDR_R    (*((volatile unsigned long *)0x4005B514))
-#define GPIO_PORTD_AHB_SLR_R    (*((volatile unsigned long *)0x4005B518))
-#define GPIO_PORTD_AHB_DEN_R    (*((volatile unsigned long *)0x4005B51C))
-#define GPIO_PORTD_AHB_LOCK_R   (*((volatile unsigned long *)0x4005B520))
-#define GPIO_PORTD_AHB_CR_R     (*((volatile unsigned long *)0x4005B524))
-#define GPIO_PORTD_AHB_AMSEL_R  (*((volatile unsigned long *)0x4005B528))
-#define GPIO_PORTD_AHB_PCTL_R   (*((volatile unsigned long *)0x4005B52C))
-#define GPIO_PORTD_AHB_ADCCTL_R (*((volatile unsigned long *)0x4005B530))
-#define GPIO_PORTD_AHB_DMACTL_R (*((volatile unsigned long *)0x4005B534))
+#define GPIO_PORTD_AHB_DATA_R   HWREG(0x4005B3FC)
+#define GPIO_PORTD_AHB_DIR_R    HWREG(0x4005B400)
+#define GPIO_PORTD_AHB_IS_R     HWREG(0x4005B404)
+#define GPIO_PORTD_AHB_IBE_R    HWREG(0x4005B408)
+#define GPIO_PORTD_AHB_IEV_R    HWREG(0x4005B40C)
+#define GPIO_PORTD_AHB_IM_R     HWREG(0x4005B410)
+#define GPIO_PORTD_AHB_RIS_R    HWREG(0x4005B414)
+#define GPIO_PORTD_AHB_MIS_R    HWREG(0x4005B418)
+#define GPIO_PORTD_AHB_ICR_R    HWREG(0x4005B41C)
+#define GPIO_PORTD_AHB_AFSEL_R  HWREG(0x4005B420)
+#define GPIO_PORTD_AHB_DR2R_R   HWREG(0x4005B500)
+#define GPIO_PORTD_AHB_DR4R_R   HWREG(0x4005B504)
+#define GPIO_PORTD_AHB_DR8R_R   HWREG(0x4005B508)
+#define GPIO_PORTD_AHB_ODR_R    HWREG(0x4005B50C)
+#define GPIO_PORTD_AHB_PUR_R    HWREG(0x4005B510)
+#define GPIO_PORTD_AHB_PDR_R    HWREG(0x4005B514)
+#define GPIO_PORTD_AHB_SLR_R    HWREG(0x4005B518)
+#define GPIO_PORTD_AHB_DEN_R    HWREG(0x4005B51C)
+#define GPIO_PORTD_AHB_LOCK_R   HWREG(0x4005B520)
+#define GPIO_PORTD_AHB_CR_R     HWREG(0x4005B524)
+#define GPIO_PORTD_AHB_AMSEL_R  HWREG(0x4005B528)
+#define GPIO_PORTD_AHB_PCTL_R   HWREG(0x4005B52C)
+#define GPIO_PORTD_AHB_ADCCTL_R HWREG(0x4005B530)
+#define GPIO_PORTD_AHB_DMACTL_R HWREG(0x4005B534)
 
 //*****************************************************************************
 //
@@ -1888,30 +1903,30 @@
 //*****************************************************************************
 #define GPIO_PORTE_AHB_DATA_BITS_R                                            \
                                 ((volatile unsigned long *)0x4005C000)
-#define GPIO_PORTE_AHB_DATA_R   (*((volatile unsigned long *)0x4005C3FC))
-#define GPIO_PORTE_AHB_DIR_R    (*((volatile unsigned long *)0x4005C400))
-#define GPIO_PORTE_AHB_IS_R     (*((volatile unsigned long *)0x4005C404))
-#define GPIO_PORTE_AHB_IBE_R    (*((volatile unsigned long *)0x4005C408))
-#define GPIO_PORTE_AHB_IEV_R    (*((volatile unsigned long *)0x4005C40C))
-#define GPIO_PORTE_AHB_IM_R     (*((volatile unsigned long *)0x4005C410))
-#define GPIO_PORTE_AHB_RIS_R    (*((volatile unsigned long *)0x4005C414))
-#define GPIO_PORTE_AHB_MIS_R    (*((volatile unsigned long *)0x4005C418))
-#define GPIO_PORTE_AHB_ICR_R    (*((volatile unsigned long *)0x4005C41C))
-#define GPIO_PORTE_AHB_AFSEL_R  (*((volatile unsigned long *)0x4005C420))
-#define GPIO_PORTE_AHB_DR2R_R   (*((volatile unsigned long *)0x4005C500))
-#define GPIO_PORTE_AHB_DR4R_R   (*((volatile unsigned long *)0x4005C504))
-#define GPIO_PORTE_AHB_DR8R_R   (*((volatile unsigned long *)0x4005C508))
-#define GPIO_PORTE_AHB_ODR_R    (*((volatile unsigned long *)0x4005C50C))
-#define GPIO_PORTE_AHB_PUR_R    (*((volatile unsigned long *)0x4005C510))
-#define GPIO_PORTE_AHB_PDR_R    (*((volatile unsigned long *)0x4005C514))
-#define GPIO_PORTE_AHB_SLR_R    (*((volatile unsigned long *)0x4005C518))
-#define GPIO_PORTE_AHB_DEN_R    (*((volatile unsigned long *)0x4005C51C))
-#define GPIO_PORTE_AHB_LOCK_R   (*((volatile unsigned long *)0x4005C520))
-#define GPIO_PORTE_AHB_CR_R     (*((volatile unsigned long *)0x4005C524))
-#define GPIO_PORTE_AHB_AMSEL_R  (*((volatile unsigned long *)0x4005C528))
-#define GPIO_PORTE_AHB_PCTL_R   (*((volatile unsigned long *)0x4005C52C))
-#define GPIO_PORTE_AHB_ADCCTL_R (*((volatile unsigned long *)0x4005C530))
-#define GPIO_PORTE_AHB_DMACTL_R (*((volatile unsigned long *)0x4005C534))
+#define GPIO_PORTE_AHB_DATA_R   HWREG(0x4005C3FC)
+#define GPIO_PORTE_AHB_DIR_R    HWREG(0x4005C400)
+#define GPIO_PORTE_AHB_IS_R     HWREG(0x4005C404)
+#define GPIO_PORTE_AHB_IBE_R    HWREG(0x4005C408)
+#define GPIO_PORTE_AHB_IEV_R    HWREG(0x4005C40C)
+#define GPIO_PORTE_AHB_IM_R     HWREG(0x4005C410)
+#define GPIO_PORTE_AHB_RIS_R    HWREG(0x4005C414)
+#define GPIO_PORTE_AHB_MIS_R    HWREG(0x4005C418)
+#define GPIO_PORTE_AHB_ICR_R    HWREG(0x4005C41C)
+#define GPIO_PORTE_AHB_AFSEL_R  HWREG(0x4005C420)
+#define GPIO_PORTE_AHB_DR2R_R   HWREG(0x4005C500)
+#define GPIO_PORTE_AHB_DR4R_R   HWREG(0x4005C504)
+#define GPIO_PORTE_AHB_DR8R_R   HWREG(0x4005C508)
+#define GPIO_PORTE_AHB_ODR_R    HWREG(0x4005C50C)
+#define GPIO_PORTE_AHB_PUR_R    HWREG(0x4005C510)
+#define GPIO_PORTE_AHB_PDR_R    HWREG(0x4005C514)
+#define GPIO_PORTE_AHB_SLR_R    HWREG(0x4005C518)
+#define GPIO_PORTE_AHB_DEN_R    HWREG(0x4005C51C)
+#define GPIO_PORTE_AHB_LOCK_R   HWREG(0x4005C520)
+#define GPIO_PORTE_AHB_CR_R     HWREG(0x4005C524)
+#define GPIO_PORTE_AHB_AMSEL_R  HWREG(0x4005C528)
+#define GPIO_PORTE_AHB_PCTL_R   HWREG(0x4005C52C)
+#define GPIO_PORTE_AHB_ADCCTL_R HWREG(0x4005C530)
+#define GPIO_PORTE_AHB_DMACTL_R HWREG(0x4005C534)
 
 //*****************************************************************************
 //
@@ -1920,283 +1935,283 @@
 //*****************************************************************************
 #define GPIO_PORTF_AHB_DATA_BITS_R                                            \
                                 ((volatile unsigned long *)0x4005D000)
-#define GPIO_PORTF_AHB_DATA_R   (*((volatile unsigned long *)0x4005D3FC))
-#define GPIO_PORTF_AHB_DIR_R    (*((volatile unsigned long *)0x4005D400))
-#define GPIO_PORTF_AHB_IS_R     (*((volatile unsigned long *)0x4005D404))
-#define GPIO_PORTF_AHB_IBE_R    (*((volatile unsigned long *)0x4005D408))
-#define GPIO_PORTF_AHB_IEV_R    (*((volatile unsigned long *)0x4005D40C))
-#define GPIO_PORTF_AHB_IM_R     (*((volatile unsigned long *)0x4005D410))
-#define GPIO_PORTF_AHB_RIS_R    (*((volatile unsigned long *)0x4005D414))
-#define GPIO_PORTF_AHB_MIS_R    (*((volatile unsigned long *)0x4005D418))
-#define GPIO_PORTF_AHB_ICR_R    (*((volatile unsigned long *)0x4005D41C))
-#define GPIO_PORTF_AHB_AFSEL_R  (*((volatile unsigned long *)0x4005D420))
-#define GPIO_PORTF_AHB_DR2R_R   (*((volatile unsigned long *)0x4005D500))
-#define GPIO_PORTF_AHB_DR4R_R   (*((volatile unsigned long *)0x4005D504))
-#define GPIO_PORTF_AHB_DR8R_R   (*((volatile unsigned long *)0x4005D508))
-#define GPIO_PORTF_AHB_ODR_R    (*((volatile unsigned long *)0x4005D50C))
-#define GPIO_PORTF_AHB_PUR_R    (*((volatile unsigned long *)0x4005D510))
-#define GPIO_PORTF_AHB_PDR_R    (*((volatile unsigned long *)0x4005D514))
-#define GPIO_PORTF_AHB_SLR_R    (*((volatile unsigned long *)0x4005D518))
-#define GPIO_PORTF_AHB_DEN_R    (*((volatile unsigned long *)0x4005D51C))
-#define GPIO_PORTF_AHB_LOCK_R   (*((volatile unsigned long *)0x4005D520))
-#define GPIO_PORTF_AHB_CR_R     (*((volatile unsigned long *)0x4005D524))
-#define GPIO_PORTF_AHB_AMSEL_R  (*((volatile unsigned long *)0x4005D528))
-#define GPIO_PORTF_AHB_PCTL_R   (*((volatile unsigned long *)0x4005D52C))
-#define GPIO_PORTF_AHB_ADCCTL_R (*((volatile unsigned long *)0x4005D530))
-#define GPIO_PORTF_AHB_DMACTL_R (*((volatile unsigned long *)0x4005D534))
+#define GPIO_PORTF_AHB_DATA_R   HWREG(0x4005D3FC)
+#define GPIO_PORTF_AHB_DIR_R    HWREG(0x4005D400)
+#define GPIO_PORTF_AHB_IS_R     HWREG(0x4005D404)
+#define GPIO_PORTF_AHB_IBE_R    HWREG(0x4005D408)
+#define GPIO_PORTF_AHB_IEV_R    HWREG(0x4005D40C)
+#define GPIO_PORTF_AHB_IM_R     HWREG(0x4005D410)
+#define GPIO_PORTF_AHB_RIS_R    HWREG(0x4005D414)
+#define GPIO_PORTF_AHB_MIS_R    HWREG(0x4005D418)
+#define GPIO_PORTF_AHB_ICR_R    HWREG(0x4005D41C)
+#define GPIO_PORTF_AHB_AFSEL_R  HWREG(0x4005D420)
+#define GPIO_PORTF_AHB_DR2R_R   HWREG(0x4005D500)
+#define GPIO_PORTF_AHB_DR4R_R   HWREG(0x4005D504)
+#define GPIO_PORTF_AHB_DR8R_R   HWREG(0x4005D508)
+#define GPIO_PORTF_AHB_ODR_R    HWREG(0x4005D50C)
+#define GPIO_PORTF_AHB_PUR_R    HWREG(0x4005D510)
+#define GPIO_PORTF_AHB_PDR_R    HWREG(0x4005D514)
+#define GPIO_PORTF_AHB_SLR_R    HWREG(0x4005D518)
+#define GPIO_PORTF_AHB_DEN_R    HWREG(0x4005D51C)
+#define GPIO_PORTF_AHB_LOCK_R   HWREG(0x4005D520)
+#define GPIO_PORTF_AHB_CR_R     HWREG(0x4005D524)
+#define GPIO_PORTF_AHB_AMSEL_R  HWREG(0x4005D528)
+#define GPIO_PORTF_AHB_PCTL_R   HWREG(0x4005D52C)
+#define GPIO_PORTF_AHB_ADCCTL_R HWREG(0x4005D530)
+#define GPIO_PORTF_AHB_DMACTL_R HWREG(0x4005D534)
 
 //*****************************************************************************
 //
 // EEPROM registers (EEPROM)
 //
 //*****************************************************************************
-#define EEPROM_EESIZE_R         (*((volatile unsigned long *)0x400AF000))
-#define EEPROM_EEBLOCK_R        (*((volatile unsigned long *)0x400AF004))
-#define EEPROM_EEOFFSET_R       (*((volatile unsigned long *)0x400AF008))
-#define EEPROM_EERDWR_R         (*((volatile unsigned long *)0x400AF010))
-#define EEPROM_EERDWRINC_R      (*((volatile unsigned long *)0x400AF014))
-#define EEPROM_EEDONE_R         (*((volatile unsigned long *)0x400AF018))
-#define EEPROM_EESUPP_R         (*((volatile unsigned long *)0x400AF01C))
-#define EEPROM_EEUNLOCK_R       (*((volatile unsigned long *)0x400AF020))
-#define EEPROM_EEPROT_R         (*((volatile unsigned long *)0x400AF030))
-#define EEPROM_EEPASS0_R        (*((volatile unsigned long *)0x400AF034))
-#define EEPROM_EEPASS1_R        (*((volatile unsigned long *)0x400AF038))
-#define EEPROM_EEPASS2_R        (*((volatile unsigned long *)0x400AF03C))
-#define EEPROM_EEINT_R          (*((volatile unsigned long *)0x400AF040))
-#define EEPROM_EEHIDE_R         (*((volatile unsigned long *)0x400AF050))
-#define EEPROM_EEDBGME_R        (*((volatile unsigned long *)0x400AF080))
-#define EEPROM_PP_R             (*((volatile unsigned long *)0x400AFFC0))
+#define EEPROM_EESIZE_R         HWREG(0x400AF000)
+#define EEPROM_EEBLOCK_R        HWREG(0x400AF004)
+#define EEPROM_EEOFFSET_R       HWREG(0x400AF008)
+#define EEPROM_EERDWR_R         HWREG(0x400AF010)
+#define EEPROM_EERDWRINC_R      HWREG(0x400AF014)
+#define EEPROM_EEDONE_R         HWREG(0x400AF018)
+#define EEPROM_EESUPP_R         HWREG(0x400AF01C)
+#define EEPROM_EEUNLOCK_R       HWREG(0x400AF020)
+#define EEPROM_EEPROT_R         HWREG(0x400AF030)
+#define EEPROM_EEPASS0_R        HWREG(0x400AF034)
+#define EEPROM_EEPASS1_R        HWREG(0x400AF038)
+#define EEPROM_EEPASS2_R        HWREG(0x400AF03C)
+#define EEPROM_EEINT_R          HWREG(0x400AF040)
+#define EEPROM_EEHIDE_R         HWREG(0x400AF050)
+#define EEPROM_EEDBGME_R        HWREG(0x400AF080)
+#define EEPROM_PP_R             HWREG(0x400AFFC0)
 
 //*****************************************************************************
 //
 // System Exception Module registers (SYSEXC)
 //
 //*****************************************************************************
-#define SYSEXC_RIS_R            (*((volatile unsigned long *)0x400F9000))
-#define SYSEXC_IM_R             (*((volatile unsigned long *)0x400F9004))
-#define SYSEXC_MIS_R            (*((volatile unsigned long *)0x400F9008))
-#define SYSEXC_IC_R             (*((volatile unsigned long *)0x400F900C))
+#define SYSEXC_RIS_R            HWREG(0x400F9000)
+#define SYSEXC_IM_R             HWREG(0x400F9004)
+#define SYSEXC_MIS_R            HWREG(0x400F9008)
+#define SYSEXC_IC_R             HWREG(0x400F900C)
 
 //*****************************************************************************
 //
 // Hibernation module registers (HIB)
 //
 //*****************************************************************************
-#define HIB_RTCC_R              (*((volatile unsigned long *)0x400FC000))
-#define HIB_RTCM0_R             (*((volatile unsigned long *)0x400FC004))
-#define HIB_RTCLD_R             (*((volatile unsigned long *)0x400FC00C))
-#define HIB_CTL_R               (*((volatile unsigned long *)0x400FC010))
-#define HIB_IM_R                (*((volatile unsigned long *)0x400FC014))
-#define HIB_RIS_R               (*((volatile unsigned long *)0x400FC018))
-#define HIB_MIS_R               (*((volatile unsigned long *)0x400FC01C))
-#define HIB_IC_R                (*((volatile unsigned long *)0x400FC020))
-#define HIB_RTCT_R              (*((volatile unsigned long *)0x400FC024))
-#define HIB_RTCSS_R             (*((volatile unsigned long *)0x400FC028))
-#define HIB_DATA_R              (*((volatile unsigned long *)0x400FC030))
+#define HIB_RTCC_R              HWREG(0x400FC000)
+#define HIB_RTCM0_R             HWREG(0x400FC004)
+#define HIB_RTCLD_R             HWREG(0x400FC00C)
+#define HIB_CTL_R               HWREG(0x400FC010)
+#define HIB_IM_R                HWREG(0x400FC014)
+#define HIB_RIS_R               HWREG(0x400FC018)
+#define HIB_MIS_R               HWREG(0x400FC01C)
+#define HIB_IC_R                HWREG(0x400FC020)
+#define HIB_RTCT_R              HWREG(0x400FC024)
+#define HIB_RTCSS_R             HWREG(0x400FC028)
+#define HIB_DATA_R              HWREG(0x400FC030)
 
 //*****************************************************************************
 //
 // FLASH registers (FLASH CTRL)
 //
 //*****************************************************************************
-#define FLASH_FMA_R             (*((volatile unsigned long *)0x400FD000))
-#define FLASH_FMD_R             (*((volatile unsigned long *)0x400FD004))
-#define FLASH_FMC_R             (*((volatile unsigned long *)0x400FD008))
-#define FLASH_FCRIS_R           (*((volatile unsigned long *)0x400FD00C))
-#define FLASH_FCIM_R            (*((volatile unsigned long *)0x400FD010))
-#define FLASH_FCMISC_R          (*((volatile unsigned long *)0x400FD014))
-#define FLASH_FMC2_R            (*((volatile unsigned long *)0x400FD020))
-#define FLASH_FWBVAL_R          (*((volatile unsigned long *)0x400FD030))
-#define FLASH_FWBN_R            (*((volatile unsigned long *)0x400FD100))
-#define FLASH_FSIZE_R           (*((volatile unsigned long *)0x400FDFC0))
-#define FLASH_SSIZE_R           (*((volatile unsigned long *)0x400FDFC4))
-#define FLASH_ROMSWMAP_R        (*((volatile unsigned long *)0x400FDFCC))
-#define FLASH_RMCTL_R           (*((volatile unsigned long *)0x400FE0F0))
-#define FLASH_BOOTCFG_R         (*((volatile unsigned long *)0x400FE1D0))
-#define FLASH_USERREG0_R        (*((volatile unsigned long *)0x400FE1E0))
-#define FLASH_USERREG1_R        (*((volatile unsigned long *)0x400FE1E4))
-#define FLASH_USERREG2_R        (*((volatile unsigned long *)0x400FE1E8))
-#define FLASH_USERREG3_R        (*((volatile unsigned long *)0x400FE1EC))
-#define FLASH_FMPRE0_R          (*((volatile unsigned long *)0x400FE200))
-#define FLASH_FMPRE1_R          (*((volatile unsigned long *)0x400FE204))
-#define FLASH_FMPRE2_R          (*((volatile unsigned long *)0x400FE208))
-#define FLASH_FMPRE3_R          (*((volatile unsigned long *)0x400FE20C))
-#define FLASH_FMPPE0_R          (*((volatile unsigned long *)0x400FE400))
-#define FLASH_FMPPE1_R          (*((volatile unsigned long *)0x400FE404))
-#define FLASH_FMPPE2_R          (*((volatile unsigned long *)0x400FE408))
-#define FLASH_FMPPE3_R          (*((volatile unsigned long *)0x400FE40C))
+#define FLASH_FMA_R             HWREG(0x400FD000)
+#define FLASH_FMD_R             HWREG(0x400FD004)
+#define FLASH_FMC_R             HWREG(0x400FD008)
+#define FLASH_FCRIS_R           HWREG(0x400FD00C)
+#define FLASH_FCIM_R            HWREG(0x400FD010)
+#define FLASH_FCMISC_R          HWREG(0x400FD014)
+#define FLASH_FMC2_R            HWREG(0x400FD020)
+#define FLASH_FWBVAL_R          HWREG(0x400FD030)
+#define FLASH_FWBN_R            HWREG(0x400FD100)
+#define FLASH_FSIZE_R           HWREG(0x400FDFC0)
+#define FLASH_SSIZE_R           HWREG(0x400FDFC4)
+#define FLASH_ROMSWMAP_R        HWREG(0x400FDFCC)
+#define FLASH_RMCTL_R           HWREG(0x400FE0F0)
+#define FLASH_BOOTCFG_R         HWREG(0x400FE1D0)
+#define FLASH_USERREG0_R        HWREG(0x400FE1E0)
+#define FLASH_USERREG1_R        HWREG(0x400FE1E4)
+#define FLASH_USERREG2_R        HWREG(0x400FE1E8)
+#define FLASH_USERREG3_R        HWREG(0x400FE1EC)
+#define FLASH_FMPRE0_R          HWREG(0x400FE200)
+#define FLASH_FMPRE1_R          HWREG(0x400FE204)
+#define FLASH_FMPRE2_R          HWREG(0x400FE208)
+#define FLASH_FMPRE3_R          HWREG(0x400FE20C)
+#define FLASH_FMPPE0_R          HWREG(0x400FE400)
+#define FLASH_FMPPE1_R          HWREG(0x400FE404)
+#define FLASH_FMPPE2_R          HWREG(0x400FE408)
+#define FLASH_FMPPE3_R          HWREG(0x400FE40C)
 
 //*****************************************************************************
 //
 // System Control registers (SYSCTL)
 //
 //*****************************************************************************
-#define SYSCTL_DID0_R           (*((volatile unsigned long *)0x400FE000))
-#define SYSCTL_DID1_R           (*((volatile unsigned long *)0x400FE004))
-#define SYSCTL_DC0_R            (*((volatile unsigned long *)0x400FE008))
-#define SYSCTL_DC1_R            (*((volatile unsigned long *)0x400FE010))
-#define SYSCTL_DC2_R            (*((volatile unsigned long *)0x400FE014))
-#define SYSCTL_DC3_R            (*((volatile unsigned long *)0x400FE018))
-#define SYSCTL_DC4_R            (*((volatile unsigned long *)0x400FE01C))
-#define SYSCTL_DC5_R            (*((volatile unsigned long *)0x400FE020))
-#define SYSCTL_DC6_R            (*((volatile unsigned long *)0x400FE024))
-#define SYSCTL_DC7_R            (*((volatile unsigned long *)0x400FE028))
-#define SYSCTL_DC8_R            (*((volatile unsigned long *)0x400FE02C))
-#define SYSCTL_PBORCTL_R        (*((volatile unsigned long *)0x400FE030))
-#define SYSCTL_SRCR0_R          (*((volatile unsigned long *)0x400FE040))
-#define SYSCTL_SRCR1_R          (*((volatile unsigned long *)0x400FE044))
-#define SYSCTL_SRCR2_R          (*((volatile unsigned long *)0x400FE048))
-#define SYSCTL_RIS_R            (*((volatile unsigned long *)0x400FE050))
-#define SYSCTL_IMC_R            (*((volatile unsigned long *)0x400FE054))
-#define SYSCTL_MISC_R           (*((volatile unsigned long *)0x400FE058))
-#define SYSCTL_RESC_R           (*((volatile unsigned long *)0x400FE05C))
-#define SYSCTL_RCC_R            (*((volatile unsigned long *)0x400FE060))
-#define SYSCTL_GPIOHBCTL_R      (*((volatile unsigned long *)0x400FE06C))
-#define SYSCTL_RCC2_R           (*((volatile unsigned long *)0x400FE070))
-#define SYSCTL_MOSCCTL_R        (*((volatile unsigned long *)0x400FE07C))
-#define SYSCTL_RCGC0_R          (*((volatile unsigned long *)0x400FE100))
-#define SYSCTL_RCGC1_R          (*((volatile unsigned long *)0x400FE104))
-#define SYSCTL_RCGC2_R          (*((volatile unsigned long *)0x400FE108))
-#define SYSCTL_SCGC0_R          (*((volatile unsigned long *)0x400FE110))
-#define SYSCTL_SCGC1_R          (*((volatile unsigned long *)0x400FE114))
-#define SYSCTL_SCGC2_R          (*((volatile unsigned long *)0x400FE118))
-#define SYSCTL_DCGC0_R          (*((volatile unsigned long *)0x400FE120))
-#define SYSCTL_DCGC1_R          (*((volatile unsigned long *)0x400FE124))
-#define SYSCTL_DCGC2_R          (*((volatile unsigned long *)0x400FE128))
-#define SYSCTL_DSLPCLKCFG_R     (*((volatile unsigned long *)0x400FE144))
-#define SYSCTL_SYSPROP_R        (*((volatile unsigned long *)0x400FE14C))
-#define SYSCTL_PIOSCCAL_R       (*((volatile unsigned long *)0x400FE150))
-#define SYSCTL_PIOSCSTAT_R      (*((volatile unsigned long *)0x400FE154))
-#define SYSCTL_PLLFREQ0_R       (*((volatile unsigned long *)0x400FE160))
-#define SYSCTL_PLLFREQ1_R       (*((volatile unsigned long *)0x400FE164))
-#define SYSCTL_PLLSTAT_R        (*((volatile unsigned long *)0x400FE168))
-#define SYSCTL_DC9_R            (*((volatile unsigned long *)0x400FE190))
-#define SYSCTL_NVMSTAT_R        (*((volatile unsigned long *)0x400FE1A0))
-#define SYSCTL_PPWD_R           (*((volatile unsigned long *)0x400FE300))
-#define SYSCTL_PPTIMER_R        (*((volatile unsigned long *)0x400FE304))
-#define SYSCTL_PPGPIO_R         (*((volatile unsigned long *)0x400FE308))
-#define SYSCTL_PPDMA_R          (*((volatile unsigned long *)0x400FE30C))
-#define SYSCTL_PPHIB_R          (*((volatile unsigned long *)0x400FE314))
-#define SYSCTL_PPUART_R         (*((volatile unsigned long *)0x400FE318))
-#define SYSCTL_PPSSI_R          (*((volatile unsigned long *)0x400FE31C))
-#define SYSCTL_PPI2C_R          (*((volatile unsigned long *)0x400FE320))
-#define SYSCTL_PPUSB_R          (*((volatile unsigned long *)0x400FE328))
-#define SYSCTL_PPCAN_R          (*((volatile unsigned long *)0x400FE334))
-#define SYSCTL_PPADC_R          (*((volatile unsigned long *)0x400FE338))
-#define SYSCTL_PPACMP_R         (*((volatile unsigned long *)0x400FE33C))
-#define SYSCTL_PPPWM_R          (*((volatile unsigned long *)0x400FE340))
-#define SYSCTL_PPQEI_R          (*((volatile unsigned long *)0x400FE344))
-#define SYSCTL_PPEEPROM_R       (*((volatile unsigned long *)0x400FE358))
-#define SYSCTL_PPWTIMER_R       (*((volatile unsigned long *)0x400FE35C))
-#define SYSCTL_SRWD_R           (*((volatile unsigned long *)0x400FE500))
-#define SYSCTL_SRTIMER_R        (*((volatile unsigned long *)0x400FE504))
-#define SYSCTL_SRGPIO_R         (*((volatile unsigned long *)0x400FE508))
-#define SYSCTL_SRDMA_R          (*((volatile unsigned long *)0x400FE50C))
-#define SYSCTL_SRHIB_R          (*((volatile unsigned long *)0x400FE514))
-#define SYSCTL_SRUART_R         (*((volatile unsigned long *)0x400FE518))
-#define SYSCTL_SRSSI_R          (*((volatile unsigned long *)0x400FE51C))
-#define SYSCTL_SRI2C_R          (*((volatile unsigned long *)0x400FE520))
-#define SYSCTL_SRUSB_R          (*((volatile unsigned long *)0x400FE528))
-#define SYSCTL_SRCAN_R          (*((volatile unsigned long *)0x400FE534))
-#define SYSCTL_SRADC_R          (*((volatile unsigned long *)0x400FE538))
-#define SYSCTL_SRACMP_R         (*((volatile unsigned long *)0x400FE53C))
-#define SYSCTL_SRPWM_R          (*((volatile unsigned long *)0x400FE540))
-#define SYSCTL_SRQEI_R          (*((volatile unsigned long *)0x400FE544))
-#define SYSCTL_SREEPROM_R       (*((volatile unsigned long *)0x400FE558))
-#define SYSCTL_SRWTIMER_R       (*((volatile unsigned long *)0x400FE55C))
-#define SYSCTL_RCGCWD_R         (*((volatile unsigned long *)0x400FE600))
-#define SYSCTL_RCGCTIMER_R      (*((volatile unsigned long *)0x400FE604))
-#define SYSCTL_RCGCGPIO_R       (*((volatile unsigned long *)0x400FE608))
-#define SYSCTL_RCGCDMA_R        (*((volatile unsigned long *)0x400FE60C))
-#define SYSCTL_RCGCHIB_R        (*((volatile unsigned long *)0x400FE614))
-#define SYSCTL_RCGCUART_R       (*((volatile unsigned long *)0x400FE618))
-#define SYSCTL_RCGCSSI_R        (*((volatile unsigned long *)0x400FE61C))
-#define SYSCTL_RCGCI2C_R        (*((volatile unsigned long *)0x400FE620))
-#define SYSCTL_RCGCUSB_R        (*((volatile unsigned long *)0x400FE628))
-#define SYSCTL_RCGCCAN_R        (*((volatile unsigned long *)0x400FE634))
-#define SYSCTL_RCGCADC_R        (*((volatile unsigned long *)0x400FE638))
-#define SYSCTL_RCGCACMP_R       (*((volatile unsigned long *)0x400FE63C))
-#define SYSCTL_RCGCPWM_R        (*((volatile unsigned long *)0x400FE640))
-#define SYSCTL_RCGCQEI_R        (*((volatile unsigned long *)0x400FE644))
-#define SYSCTL_RCGCEEPROM_R     (*((volatile unsigned long *)0x400FE658))
-#define SYSCTL_RCGCWTIMER_R     (*((volatile unsigned long *)0x400FE65C))
-#define SYSCTL_SCGCWD_R         (*((volatile unsigned long *)0x400FE700))
-#define SYSCTL_SCGCTIMER_R      (*((volatile unsigned long *)0x400FE704))
-#define SYSCTL_SCGCGPIO_R       (*((volatile unsigned long *)0x400FE708))
-#define SYSCTL_SCGCDMA_R        (*((volatile unsigned long *)0x400FE70C))
-#define SYSCTL_SCGCHIB_R        (*((volatile unsigned long *)0x400FE714))
-#define SYSCTL_SCGCUART_R       (*((volatile unsigned long *)0x400FE718))
-#define SYSCTL_SCGCSSI_R        (*((volatile unsigned long *)0x400FE71C))
-#define SYSCTL_SCGCI2C_R        (*((volatile unsigned long *)0x400FE720))
-#define SYSCTL_SCGCUSB_R        (*((volatile unsigned long *)0x400FE728))
-#define SYSCTL_SCGCCAN_R        (*((volatile unsigned long *)0x400FE734))
-#define SYSCTL_SCGCADC_R        (*((volatile unsigned long *)0x400FE738))
-#define SYSCTL_SCGCACMP_R       (*((volatile unsigned long *)0x400FE73C))
-#define SYSCTL_SCGCPWM_R        (*((volatile unsigned long *)0x400FE740))
-#define SYSCTL_SCGCQEI_R        (*((volatile unsigned long *)0x400FE744))
-#define SYSCTL_SCGCEEPROM_R     (*((volatile unsigned long *)0x400FE758))
-#define SYSCTL_SCGCWTIMER_R     (*((volatile unsigned long *)0x400FE75C))
-#define SYSCTL_DCGCWD_R         (*((volatile unsigned long *)0x400FE800))
-#define SYSCTL_DCGCTIMER_R      (*((volatile unsigned long *)0x400FE804))
-#define SYSCTL_DCGCGPIO_R       (*((volatile unsigned long *)0x400FE808))
-#define SYSCTL_DCGCDMA_R        (*((volatile unsigned long *)0x400FE80C))
-#define SYSCTL_DCGCHIB_R        (*((volatile unsigned long *)0x400FE814))
-#define SYSCTL_DCGCUART_R       (*((volatile unsigned long *)0x400FE818))
-#define SYSCTL_DCGCSSI_R        (*((volatile unsigned long *)0x400FE81C))
-#define SYSCTL_DCGCI2C_R        (*((volatile unsigned long *)0x400FE820))
-#define SYSCTL_DCGCUSB_R        (*((volatile unsigned long *)0x400FE828))
-#define SYSCTL_DCGCCAN_R        (*((volatile unsigned long *)0x400FE834))
-#define SYSCTL_DCGCADC_R        (*((volatile unsigned long *)0x400FE838))
-#define SYSCTL_DCGCACMP_R       (*((volatile unsigned long *)0x400FE83C))
-#define SYSCTL_DCGCPWM_R        (*((volatile unsigned long *)0x400FE840))
-#define SYSCTL_DCGCQEI_R        (*((volatile unsigned long *)0x400FE844))
-#define SYSCTL_DCGCEEPROM_R     (*((volatile unsigned long *)0x400FE858))
-#define SYSCTL_DCGCWTIMER_R     (*((volatile unsigned long *)0x400FE85C))
-#define SYSCTL_PRWD_R           (*((volatile unsigned long *)0x400FEA00))
-#define SYSCTL_PRTIMER_R        (*((volatile unsigned long *)0x400FEA04))
-#define SYSCTL_PRGPIO_R         (*((volatile unsigned long *)0x400FEA08))
-#define SYSCTL_PRDMA_R          (*((volatile unsigned long *)0x400FEA0C))
-#define SYSCTL_PRHIB_R          (*((volatile unsigned long *)0x400FEA14))
-#define SYSCTL_PRUART_R         (*((volatile unsigned long *)0x400FEA18))
-#define SYSCTL_PRSSI_R          (*((volatile unsigned long *)0x400FEA1C))
-#define SYSCTL_PRI2C_R          (*((volatile unsigned long *)0x400FEA20))
-#define SYSCTL_PRUSB_R          (*((volatile unsigned long *)0x400FEA28))
-#define SYSCTL_PRCAN_R          (*((volatile unsigned long *)0x400FEA34))
-#define SYSCTL_PRADC_R          (*((volatile unsigned long *)0x400FEA38))
-#define SYSCTL_PRACMP_R         (*((volatile unsigned long *)0x400FEA3C))
-#define SYSCTL_PRPWM_R          (*((volatile unsigned long *)0x400FEA40))
-#define SYSCTL_PRQEI_R          (*((volatile unsigned long *)0x400FEA44))
-#define SYSCTL_PREEPROM_R       (*((volatile unsigned long *)0x400FEA58))
-#define SYSCTL_PRWTIMER_R       (*((volatile unsigned long *)0x400FEA5C))
+#define SYSCTL_DID0_R           HWREG(0x400FE000)
+#define SYSCTL_DID1_R           HWREG(0x400FE004)
+#define SYSCTL_DC0_R            HWREG(0x400FE008)
+#define SYSCTL_DC1_R            HWREG(0x400FE010)
+#define SYSCTL_DC2_R            HWREG(0x400FE014)
+#define SYSCTL_DC3_R            HWREG(0x400FE018)
+#define SYSCTL_DC4_R            HWREG(0x400FE01C)
+#define SYSCTL_DC5_R            HWREG(0x400FE020)
+#define SYSCTL_DC6_R            HWREG(0x400FE024)
+#define SYSCTL_DC7_R            HWREG(0x400FE028)
+#define SYSCTL_DC8_R            HWREG(0x400FE02C)
+#define SYSCTL_PBORCTL_R        HWREG(0x400FE030)
+#define SYSCTL_SRCR0_R          HWREG(0x400FE040)
+#define SYSCTL_SRCR1_R          HWREG(0x400FE044)
+#define SYSCTL_SRCR2_R          HWREG(0x400FE048)
+#define SYSCTL_RIS_R            HWREG(0x400FE050)
+#define SYSCTL_IMC_R            HWREG(0x400FE054)
+#define SYSCTL_MISC_R           HWREG(0x400FE058)
+#define SYSCTL_RESC_R           HWREG(0x400FE05C)
+#define SYSCTL_RCC_R            HWREG(0x400FE060)
+#define SYSCTL_GPIOHBCTL_R      HWREG(0x400FE06C)
+#define SYSCTL_RCC2_R           HWREG(0x400FE070)
+#define SYSCTL_MOSCCTL_R        HWREG(0x400FE07C)
+#define SYSCTL_RCGC0_R          HWREG(0x400FE100)
+#define SYSCTL_RCGC1_R          HWREG(0x400FE104)
+#define SYSCTL_RCGC2_R          HWREG(0x400FE108)
+#define SYSCTL_SCGC0_R          HWREG(0x400FE110)
+#define SYSCTL_SCGC1_R          HWREG(0x400FE114)
+#define SYSCTL_SCGC2_R          HWREG(0x400FE118)
+#define SYSCTL_DCGC0_R          HWREG(0x400FE120)
+#define SYSCTL_DCGC1_R          HWREG(0x400FE124)
+#define SYSCTL_DCGC2_R          HWREG(0x400FE128)
+#define SYSCTL_DSLPCLKCFG_R     HWREG(0x400FE144)
+#define SYSCTL_SYSPROP_R        HWREG(0x400FE14C)
+#define SYSCTL_PIOSCCAL_R       HWREG(0x400FE150)
+#define SYSCTL_PIOSCSTAT_R      HWREG(0x400FE154)
+#define SYSCTL_PLLFREQ0_R       HWREG(0x400FE160)
+#define SYSCTL_PLLFREQ1_R       HWREG(0x400FE164)
+#define SYSCTL_PLLSTAT_R        HWREG(0x400FE168)
+#define SYSCTL_DC9_R            HWREG(0x400FE190)
+#define SYSCTL_NVMSTAT_R        HWREG(0x400FE1A0)
+#define SYSCTL_PPWD_R           HWREG(0x400FE300)
+#define SYSCTL_PPTIMER_R        HWREG(0x400FE304)
+#define SYSCTL_PPGPIO_R         HWREG(0x400FE308)
+#define SYSCTL_PPDMA_R          HWREG(0x400FE30C)
+#define SYSCTL_PPHIB_R          HWREG(0x400FE314)
+#define SYSCTL_PPUART_R         HWREG(0x400FE318)
+#define SYSCTL_PPSSI_R          HWREG(0x400FE31C)
+#define SYSCTL_PPI2C_R          HWREG(0x400FE320)
+#define SYSCTL_PPUSB_R          HWREG(0x400FE328)
+#define SYSCTL_PPCAN_R          HWREG(0x400FE334)
+#define SYSCTL_PPADC_R          HWREG(0x400FE338)
+#define SYSCTL_PPACMP_R         HWREG(0x400FE33C)
+#define SYSCTL_PPPWM_R          HWREG(0x400FE340)
+#define SYSCTL_PPQEI_R          HWREG(0x400FE344)
+#define SYSCTL_PPEEPROM_R       HWREG(0x400FE358)
+#define SYSCTL_PPWTIMER_R       HWREG(0x400FE35C)
+#define SYSCTL_SRWD_R           HWREG(0x400FE500)
+#define SYSCTL_SRTIMER_R        HWREG(0x400FE504)
+#define SYSCTL_SRGPIO_R         HWREG(0x400FE508)
+#define SYSCTL_SRDMA_R          HWREG(0x400FE50C)
+#define SYSCTL_SRHIB_R          HWREG(0x400FE514)
+#define SYSCTL_SRUART_R         HWREG(0x400FE518)
+#define SYSCTL_SRSSI_R          HWREG(0x400FE51C)
+#define SYSCTL_SRI2C_R          HWREG(0x400FE520)
+#define SYSCTL_SRUSB_R          HWREG(0x400FE528)
+#define SYSCTL_SRCAN_R          HWREG(0x400FE534)
+#define SYSCTL_SRADC_R          HWREG(0x400FE538)
+#define SYSCTL_SRACMP_R         HWREG(0x400FE53C)
+#define SYSCTL_SRPWM_R          HWREG(0x400FE540)
+#define SYSCTL_SRQEI_R          HWREG(0x400FE544)
+#define SYSCTL_SREEPROM_R       HWREG(0x400FE558)
+#define SYSCTL_SRWTIMER_R       HWREG(0x400FE55C)
+#define SYSCTL_RCGCWD_R         HWREG(0x400FE600)
+#define SYSCTL_RCGCTIMER_R      HWREG(0x400FE604)
+#define SYSCTL_RCGCGPIO_R       HWREG(0x400FE608)
+#define SYSCTL_RCGCDMA_R        HWREG(0x400FE60C)
+#define SYSCTL_RCGCHIB_R        HWREG(0x400FE614)
+#define SYSCTL_RCGCUART_R       HWREG(0x400FE618)
+#define SYSCTL_RCGCSSI_R        HWREG(0x400FE61C)
+#define SYSCTL_RCGCI2C_R        HWREG(0x400FE620)
+#define SYSCTL_RCGCUSB_R        HWREG(0x400FE628)
+#define SYSCTL_RCGCCAN_R        HWREG(0x400FE634)
+#define SYSCTL_RCGCADC_R        HWREG(0x400FE638)
+#define SYSCTL_RCGCACMP_R       HWREG(0x400FE63C)
+#define SYSCTL_RCGCPWM_R        HWREG(0x400FE640)
+#define SYSCTL_RCGCQEI_R        HWREG(0x400FE644)
+#define SYSCTL_RCGCEEPROM_R     HWREG(0x400FE658)
+#define SYSCTL_RCGCWTIMER_R     HWREG(0x400FE65C)
+#define SYSCTL_SCGCWD_R         HWREG(0x400FE700)
+#define SYSCTL_SCGCTIMER_R      HWREG(0x400FE704)
+#define SYSCTL_SCGCGPIO_R       HWREG(0x400FE708)
+#define SYSCTL_SCGCDMA_R        HWREG(0x400FE70C)
+#define SYSCTL_SCGCHIB_R        HWREG(0x400FE714)
+#define SYSCTL_SCGCUART_R       HWREG(0x400FE718)
+#define SYSCTL_SCGCSSI_R        HWREG(0x400FE71C)
+#define SYSCTL_SCGCI2C_R        HWREG(0x400FE720)
+#define SYSCTL_SCGCUSB_R        HWREG(0x400FE728)
+#define SYSCTL_SCGCCAN_R        HWREG(0x400FE734)
+#define SYSCTL_SCGCADC_R        HWREG(0x400FE738)
+#define SYSCTL_SCGCACMP_R       HWREG(0x400FE73C)
+#define SYSCTL_SCGCPWM_R        HWREG(0x400FE740)
+#define SYSCTL_SCGCQEI_R        HWREG(0x400FE744)
+#define SYSCTL_SCGCEEPROM_R     HWREG(0x400FE758)
+#define SYSCTL_SCGCWTIMER_R     HWREG(0x400FE75C)
+#define SYSCTL_DCGCWD_R         HWREG(0x400FE800)
+#define SYSCTL_DCGCTIMER_R      HWREG(0x400FE804)
+#define SYSCTL_DCGCGPIO_R       HWREG(0x400FE808)
+#define SYSCTL_DCGCDMA_R        HWREG(0x400FE80C)
+#define SYSCTL_DCGCHIB_R        HWREG(0x400FE814)
+#define SYSCTL_DCGCUART_R       HWREG(0x400FE818)
+#define SYSCTL_DCGCSSI_R        HWREG(0x400FE81C)
+#define SYSCTL_DCGCI2C_R        HWREG(0x400FE820)
+#define SYSCTL_DCGCUSB_R        HWREG(0x400FE828)
+#define SYSCTL_DCGCCAN_R        HWREG(0x400FE834)
+#define SYSCTL_DCGCADC_R        HWREG(0x400FE838)
+#define SYSCTL_DCGCACMP_R       HWREG(0x400FE83C)
+#define SYSCTL_DCGCPWM_R        HWREG(0x400FE840)
+#define SYSCTL_DCGCQEI_R        HWREG(0x400FE844)
+#define SYSCTL_DCGCEEPROM_R     HWREG(0x400FE858)
+#define SYSCTL_DCGCWTIMER_R     HWREG(0x400FE85C)
+#define SYSCTL_PRWD_R           HWREG(0x400FEA00)
+#define SYSCTL_PRTIMER_R        HWREG(0x400FEA04)
+#define SYSCTL_PRGPIO_R         HWREG(0x400FEA08)
+#define SYSCTL_PRDMA_R          HWREG(0x400FEA0C)
+#define SYSCTL_PRHIB_R          HWREG(0x400FEA14)
+#define SYSCTL_PRUART_R         HWREG(0x400FEA18)
+#define SYSCTL_PRSSI_R          HWREG(0x400FEA1C)
+#define SYSCTL_PRI2C_R          HWREG(0x400FEA20)
+#define SYSCTL_PRUSB_R          HWREG(0x400FEA28)
+#define SYSCTL_PRCAN_R          HWREG(0x400FEA34)
+#define SYSCTL_PRADC_R          HWREG(0x400FEA38)
+#define SYSCTL_PRACMP_R         HWREG(0x400FEA3C)
+#define SYSCTL_PRPWM_R          HWREG(0x400FEA40)
+#define SYSCTL_PRQEI_R          HWREG(0x400FEA44)
+#define SYSCTL_PREEPROM_R       HWREG(0x400FEA58)
+#define SYSCTL_PRWTIMER_R       HWREG(0x400FEA5C)
 
 //*****************************************************************************
 //
 // Micro Direct Memory Access registers (UDMA)
 //
 //*****************************************************************************
-#define UDMA_STAT_R             (*((volatile unsigned long *)0x400FF000))
-#define UDMA_CFG_R              (*((volatile unsigned long *)0x400FF004))
-#define UDMA_CTLBASE_R          (*((volatile unsigned long *)0x400FF008))
-#define UDMA_ALTBASE_R          (*((volatile unsigned long *)0x400FF00C))
-#define UDMA_WAITSTAT_R         (*((volatile unsigned long *)0x400FF010))
-#define UDMA_SWREQ_R            (*((volatile unsigned long *)0x400FF014))
-#define UDMA_USEBURSTSET_R      (*((volatile unsigned long *)0x400FF018))
-#define UDMA_USEBURSTCLR_R      (*((volatile unsigned long *)0x400FF01C))
-#define UDMA_REQMASKSET_R       (*((volatile unsigned long *)0x400FF020))
-#define UDMA_REQMASKCLR_R       (*((volatile unsigned long *)0x400FF024))
-#define UDMA_ENASET_R           (*((volatile unsigned long *)0x400FF028))
-#define UDMA_ENACLR_R           (*((volatile unsigned long *)0x400FF02C))
-#define UDMA_ALTSET_R           (*((volatile unsigned long *)0x400FF030))
-#define UDMA_ALTCLR_R           (*((volatile unsigned long *)0x400FF034))
-#define UDMA_PRIOSET_R          (*((volatile unsigned long *)0x400FF038))
-#define UDMA_PRIOCLR_R          (*((volatile unsigned long *)0x400FF03C))
-#define UDMA_ERRCLR_R           (*((volatile unsigned long *)0x400FF04C))
-#define UDMA_CHASGN_R           (*((volatile unsigned long *)0x400FF500))
-#define UDMA_CHIS_R             (*((volatile unsigned long *)0x400FF504))
-#define UDMA_CHMAP0_R           (*((volatile unsigned long *)0x400FF510))
-#define UDMA_CHMAP1_R           (*((volatile unsigned long *)0x400FF514))
-#define UDMA_CHMAP2_R           (*((volatile unsigned long *)0x400FF518))
-#define UDMA_CHMAP3_R           (*((volatile unsigned long *)0x400FF51C))
+#define UDMA_STAT_R             HWREG(0x400FF000)
+#define UDMA_CFG_R              HWREG(0x400FF004)
+#define UDMA_CTLBASE_R          HWREG(0x400FF008)
+#define UDMA_ALTBASE_R          HWREG(0x400FF00C)
+#define UDMA_WAITSTAT_R         HWREG(0x400FF010)
+#define UDMA_SWREQ_R            HWREG(0x400FF014)
+#define UDMA_USEBURSTSET_R      HWREG(0x400FF018)
+#define UDMA_USEBURSTCLR_R      HWREG(0x400FF01C)
+#define UDMA_REQMASKSET_R       HWREG(0x400FF020)
+#define UDMA_REQMASKCLR_R       HWREG(0x400FF024)
+#define UDMA_ENASET_R           HWREG(0x400FF028)
+#define UDMA_ENACLR_R           HWREG(0x400FF02C)
+#define UDMA_ALTSET_R           HWREG(0x400FF030)
+#define UDMA_ALTCLR_R           HWREG(0x400FF034)
+#define UDMA_PRIOSET_R          HWREG(0x400FF038)
+#define UDMA_PRIOCLR_R          HWREG(0x400FF03C)
+#define UDMA_ERRCLR_R           HWREG(0x400FF04C)
+#define UDMA_CHASGN_R           HWREG(0x400FF500)
+#define UDMA_CHIS_R             HWREG(0x400FF504)
+#define UDMA_CHMAP0_R           HWREG(0x400FF510)
+#define UDMA_CHMAP1_R           HWREG(0x400FF514)
+#define UDMA_CHMAP2_R           HWREG(0x400FF518)
+#define UDMA_CHMAP3_R           HWREG(0x400FF51C)
 
 //*****************************************************************************
 //
@@ -2214,105 +2229,105 @@
 // NVIC registers (NVIC)
 //
 //*****************************************************************************
-#define NVIC_ACTLR_R            (*((volatile unsigned long *)0xE000E008))
-#define NVIC_ST_CTRL_R          (*((volatile unsigned long *)0xE000E010))
-#define NVIC_ST_RELOAD_R        (*((volatile unsigned long *)0xE000E014))
-#define NVIC_ST_CURRENT_R       (*((volatile unsigned long *)0xE000E018))
-#define NVIC_EN0_R              (*((volatile unsigned long *)0xE000E100))
-#define NVIC_EN1_R              (*((volatile unsigned long *)0xE000E104))
-#define NVIC_EN2_R              (*((volatile unsigned long *)0xE000E108))
-#define NVIC_EN3_R              (*((volatile unsigned long *)0xE000E10C))
-#define NVIC_EN4_R              (*((volatile unsigned long *)0xE000E110))
-#define NVIC_DIS0_R             (*((volatile unsigned long *)0xE000E180))
-#define NVIC_DIS1_R             (*((volatile unsigned long *)0xE000E184))
-#define NVIC_DIS2_R             (*((volatile unsigned long *)0xE000E188))
-#define NVIC_DIS3_R             (*((volatile unsigned long *)0xE000E18C))
-#define NVIC_DIS4_R             (*((volatile unsigned long *)0xE000E190))
-#define NVIC_PEND0_R            (*((volatile unsigned long *)0xE000E200))
-#define NVIC_PEND1_R            (*((volatile unsigned long *)0xE000E204))
-#define NVIC_PEND2_R            (*((volatile unsigned long *)0xE000E208))
-#define NVIC_PEND3_R            (*((volatile unsigned long *)0xE000E20C))
-#define NVIC_PEND4_R            (*((volatile unsigned long *)0xE000E210))
-#define NVIC_UNPEND0_R          (*((volatile unsigned long *)0xE000E280))
-#define NVIC_UNPEND1_R          (*((volatile unsigned long *)0xE000E284))
-#define NVIC_UNPEND2_R          (*((volatile unsigned long *)0xE000E288))
-#define NVIC_UNPEND3_R          (*((volatile unsigned long *)0xE000E28C))
-#define NVIC_UNPEND4_R          (*((volatile unsigned long *)0xE000E290))
-#define NVIC_ACTIVE0_R          (*((volatile unsigned long *)0xE000E300))
-#define NVIC_ACTIVE1_R          (*((volatile unsigned long *)0xE000E304))
-#define NVIC_ACTIVE2_R          (*((volatile unsigned long *)0xE000E308))
-#define NVIC_ACTIVE3_R          (*((volatile unsigned long *)0xE000E30C))
-#define NVIC_ACTIVE4_R          (*((volatile unsigned long *)0xE000E310))
-#define NVIC_PRI0_R             (*((volatile unsigned long *)0xE000E400))
-#define NVIC_PRI1_R             (*((volatile unsigned long *)0xE000E404))
-#define NVIC_PRI2_R             (*((volatile unsigned long *)0xE000E408))
-#define NVIC_PRI3_R             (*((volatile unsigned long *)0xE000E40C))
-#define NVIC_PRI4_R             (*((volatile unsigned long *)0xE000E410))
-#define NVIC_PRI5_R             (*((volatile unsigned long *)0xE000E414))
-#define NVIC_PRI6_R             (*((volatile unsigned long *)0xE000E418))
-#define NVIC_PRI7_R             (*((volatile unsigned long *)0xE000E41C))
-#define NVIC_PRI8_R             (*((volatile unsigned long *)0xE000E420))
-#define NVIC_PRI9_R             (*((volatile unsigned long *)0xE000E424))
-#define NVIC_PRI10_R            (*((volatile unsigned long *)0xE000E428))
-#define NVIC_PRI11_R            (*((volatile unsigned long *)0xE000E42C))
-#define NVIC_PRI12_R            (*((volatile unsigned long *)0xE000E430))
-#define NVIC_PRI13_R            (*((volatile unsigned long *)0xE000E434))
-#define NVIC_PRI14_R            (*((volatile unsigned long *)0xE000E438))
-#define NVIC_PRI15_R            (*((volatile unsigned long *)0xE000E43C))
-#define NVIC_PRI16_R            (*((volatile unsigned long *)0xE000E440))
-#define NVIC_PRI17_R            (*((volatile unsigned long *)0xE000E444))
-#define NVIC_PRI18_R            (*((volatile unsigned long *)0xE000E448))
-#define NVIC_PRI19_R            (*((volatile unsigned long *)0xE000E44C))
-#define NVIC_PRI20_R            (*((volatile unsigned long *)0xE000E450))
-#define NVIC_PRI21_R            (*((volatile unsigned long *)0xE000E454))
-#define NVIC_PRI22_R            (*((volatile unsigned long *)0xE000E458))
-#define NVIC_PRI23_R            (*((volatile unsigned long *)0xE000E45C))
-#define NVIC_PRI24_R            (*((volatile unsigned long *)0xE000E460))
-#define NVIC_PRI25_R            (*((volatile unsigned long *)0xE000E464))
-#define NVIC_PRI26_R            (*((volatile unsigned long *)0xE000E468))
-#define NVIC_PRI27_R            (*((volatile unsigned long *)0xE000E46C))
-#define NVIC_PRI28_R            (*((volatile unsigned long *)0xE000E470))
-#define NVIC_PRI29_R            (*((volatile unsigned long *)0xE000E474))
-#define NVIC_PRI30_R            (*((volatile unsigned long *)0xE000E478))
-#define NVIC_PRI31_R            (*((volatile unsigned long *)0xE000E47C))
-#define NVIC_PRI32_R            (*((volatile unsigned long *)0xE000E480))
-#define NVIC_PRI33_R            (*((volatile unsigned long *)0xE000E484))
-#define NVIC_PRI34_R            (*((volatile unsigned long *)0xE000E488))
-#define NVIC_CPUID_R            (*((volatile unsigned long *)0xE000ED00))
-#define NVIC_INT_CTRL_R         (*((volatile unsigned long *)0xE000ED04))
-#define NVIC_VTABLE_R           (*((volatile unsigned long *)0xE000ED08))
-#define NVIC_APINT_R            (*((volatile unsigned long *)0xE000ED0C))
-#define NVIC_SYS_CTRL_R         (*((volatile unsigned long *)0xE000ED10))
-#define NVIC_CFG_CTRL_R         (*((volatile unsigned long *)0xE000ED14))
-#define NVIC_SYS_PRI1_R         (*((volatile unsigned long *)0xE000ED18))
-#define NVIC_SYS_PRI2_R         (*((volatile unsigned long *)0xE000ED1C))
-#define NVIC_SYS_PRI3_R         (*((volatile unsigned long *)0xE000ED20))
-#define NVIC_SYS_HND_CTRL_R     (*((volatile unsigned long *)0xE000ED24))
-#define NVIC_FAULT_STAT_R       (*((volatile unsigned long *)0xE000ED28))
-#define NVIC_HFAULT_STAT_R      (*((volatile unsigned long *)0xE000ED2C))
-#define NVIC_DEBUG_STAT_R       (*((volatile unsigned long *)0xE000ED30))
-#define NVIC_MM_ADDR_R          (*((volatile unsigned long *)0xE000ED34))
-#define NVIC_FAULT_ADDR_R       (*((volatile unsigned long *)0xE000ED38))
-#define NVIC_CPAC_R             (*((volatile unsigned long *)0xE000ED88))
-#define NVIC_MPU_TYPE_R         (*((volatile unsigned long *)0xE000ED90))
-#define NVIC_MPU_CTRL_R         (*((volatile unsigned long *)0xE000ED94))
-#define NVIC_MPU_NUMBER_R       (*((volatile unsigned long *)0xE000ED98))
-#define NVIC_MPU_BASE_R         (*((volatile unsigned long *)0xE000ED9C))
-#define NVIC_MPU_ATTR_R         (*((volatile unsigned long *)0xE000EDA0))
-#define NVIC_MPU_BASE1_R        (*((volatile unsigned long *)0xE000EDA4))
-#define NVIC_MPU_ATTR1_R        (*((volatile unsigned long *)0xE000EDA8))
-#define NVIC_MPU_BASE2_R        (*((volatile unsigned long *)0xE000EDAC))
-#define NVIC_MPU_ATTR2_R        (*((volatile unsigned long *)0xE000EDB0))
-#define NVIC_MPU_BASE3_R        (*((volatile unsigned long *)0xE000EDB4))
-#define NVIC_MPU_ATTR3_R        (*((volatile unsigned long *)0xE000EDB8))
-#define NVIC_DBG_CTRL_R         (*((volatile unsigned long *)0xE000EDF0))
-#define NVIC_DBG_XFER_R         (*((volatile unsigned long *)0xE000EDF4))
-#define NVIC_DBG_DATA_R         (*((volatile unsigned long *)0xE000EDF8))
-#define NVIC_DBG_INT_R          (*((volatile unsigned long *)0xE000EDFC))
-#define NVIC_SW_TRIG_R          (*((volatile unsigned long *)0xE000EF00))
-#define NVIC_FPCC_R             (*((volatile unsigned long *)0xE000EF34))
-#define NVIC_FPCA_R             (*((volatile unsigned long *)0xE000EF38))
-#define NVIC_FPDSC_R            (*((volatile unsigned long *)0xE000EF3C))
+#define NVIC_ACTLR_R            HWREG(0xE000E008)
+#define NVIC_ST_CTRL_R          HWREG(0xE000E010)
+#define NVIC_ST_RELOAD_R        HWREG(0xE000E014)
+#define NVIC_ST_CURRENT_R       HWREG(0xE000E018)
+#define NVIC_EN0_R              HWREG(0xE000E100)
+#define NVIC_EN1_R              HWREG(0xE000E104)
+#define NVIC_EN2_R              HWREG(0xE000E108)
+#define NVIC_EN3_R              HWREG(0xE000E10C)
+#define NVIC_EN4_R              HWREG(0xE000E110)
+#define NVIC_DIS0_R             HWREG(0xE000E180)
+#define NVIC_DIS1_R             HWREG(0xE000E184)
+#define NVIC_DIS2_R             HWREG(0xE000E188)
+#define NVIC_DIS3_R             HWREG(0xE000E18C)
+#define NVIC_DIS4_R             HWREG(0xE000E190)
+#define NVIC_PEND0_R            HWREG(0xE000E200)
+#define NVIC_PEND1_R            HWREG(0xE000E204)
+#define NVIC_PEND2_R            HWREG(0xE000E208)
+#define NVIC_PEND3_R            HWREG(0xE000E20C)
+#define NVIC_PEND4_R            HWREG(0xE000E210)
+#define NVIC_UNPEND0_R          HWREG(0xE000E280)
+#define NVIC_UNPEND1_R          HWREG(0xE000E284)
+#define NVIC_UNPEND2_R          HWREG(0xE000E288)
+#define NVIC_UNPEND3_R          HWREG(0xE000E28C)
+#define NVIC_UNPEND4_R          HWREG(0xE000E290)
+#define NVIC_ACTIVE0_R          HWREG(0xE000E300)
+#define NVIC_ACTIVE1_R          HWREG(0xE000E304)
+#define NVIC_ACTIVE2_R          HWREG(0xE000E308)
+#define NVIC_ACTIVE3_R          HWREG(0xE000E30C)
+#define NVIC_ACTIVE4_R          HWREG(0xE000E310)
+#define NVIC_PRI0_R             HWREG(0xE000E400)
+#define NVIC_PRI1_R             HWREG(0xE000E404)
+#define NVIC_PRI2_R             HWREG(0xE000E408)
+#define NVIC_PRI3_R             HWREG(0xE000E40C)
+#define NVIC_PRI4_R             HWREG(0xE000E410)
+#define NVIC_PRI5_R             HWREG(0xE000E414)
+#define NVIC_PRI6_R             HWREG(0xE000E418)
+#define NVIC_PRI7_R             HWREG(0xE000E41C)
+#define NVIC_PRI8_R             HWREG(0xE000E420)
+#define NVIC_PRI9_R             HWREG(0xE000E424)
+#define NVIC_PRI10_R            HWREG(0xE000E428)
+#define NVIC_PRI11_R            HWREG(0xE000E42C)
+#define NVIC_PRI12_R            HWREG(0xE000E430)
+#define NVIC_PRI13_R            HWREG(0xE000E434)
+#define NVIC_PRI14_R            HWREG(0xE000E438)
+#define NVIC_PRI15_R            HWREG(0xE000E43C)
+#define NVIC_PRI16_R            HWREG(0xE000E440)
+#define NVIC_PRI17_R            HWREG(0xE000E444)
+#define NVIC_PRI18_R            HWREG(0xE000E448)
+#define NVIC_PRI19_R            HWREG(0xE000E44C)
+#define NVIC_PRI20_R            HWREG(0xE000E450)
+#define NVIC_PRI21_R            HWREG(0xE000E454)
+#define NVIC_PRI22_R            HWREG(0xE000E458)
+#define NVIC_PRI23_R            HWREG(0xE000E45C)
+#define NVIC_PRI24_R            HWREG(0xE000E460)
+#define NVIC_PRI25_R            HWREG(0xE000E464)
+#define NVIC_PRI26_R            HWREG(0xE000E468)
+#define NVIC_PRI27_R            HWREG(0xE000E46C)
+#define NVIC_PRI28_R            HWREG(0xE000E470)
+#define NVIC_PRI29_R            HWREG(0xE000E474)
+#define NVIC_PRI30_R            HWREG(0xE000E478)
+#define NVIC_PRI31_R            HWREG(0xE000E47C)
+#define NVIC_PRI32_R            HWREG(0xE000E480)
+#define NVIC_PRI33_R            HWREG(0xE000E484)
+#define NVIC_PRI34_R            HWREG(0xE000E488)
+#define NVIC_CPUID_R            HWREG(0xE000ED00)
+#define NVIC_INT_CTRL_R         HWREG(0xE000ED04)
+#define NVIC_VTABLE_R           HWREG(0xE000ED08)
+#define NVIC_APINT_R            HWREG(0xE000ED0C)
+#define NVIC_SYS_CTRL_R         HWREG(0xE000ED10)
+#define NVIC_CFG_CTRL_R         HWREG(0xE000ED14)
+#define NVIC_SYS_PRI1_R         HWREG(0xE000ED18)
+#define NVIC_SYS_PRI2_R         HWREG(0xE000ED1C)
+#define NVIC_SYS_PRI3_R         HWREG(0xE000ED20)
+#define NVIC_SYS_HND_CTRL_R     HWREG(0xE000ED24)
+#define NVIC_FAULT_STAT_R       HWREG(0xE000ED28)
+#define NVIC_HFAULT_STAT_R      HWREG(0xE000ED2C)
+#define NVIC_DEBUG_STAT_R       HWREG(0xE000ED30)
+#define NVIC_MM_ADDR_R          HWREG(0xE000ED34)
+#define NVIC_FAULT_ADDR_R       HWREG(0xE000ED38)
+#define NVIC_CPAC_R             HWREG(0xE000ED88)
+#define NVIC_MPU_TYPE_R         HWREG(0xE000ED90)
+#define NVIC_MPU_CTRL_R         HWREG(0xE000ED94)
+#define NVIC_MPU_NUMBER_R       HWREG(0xE000ED98)
+#define NVIC_MPU_BASE_R         HWREG(0xE000ED9C)
+#define NVIC_MPU_ATTR_R         HWREG(0xE000EDA0)
+#define NVIC_MPU_BASE1_R        HWREG(0xE000EDA4)
+#define NVIC_MPU_ATTR1_R        HWREG(0xE000EDA8)
+#define NVIC_MPU_BASE2_R        HWREG(0xE000EDAC)
+#define NVIC_MPU_ATTR2_R        HWREG(0xE000EDB0)
+#define NVIC_MPU_BASE3_R        HWREG(0xE000EDB4)
+#define NVIC_MPU_ATTR3_R        HWREG(0xE000EDB8)
+#define NVIC_DBG_CTRL_R         HWREG(0xE000EDF0)
+#define NVIC_DBG_XFER_R         HWREG(0xE000EDF4)
+#define NVIC_DBG_DATA_R         HWREG(0xE000EDF8)
+#define NVIC_DBG_INT_R          HWREG(0xE000EDFC)
+#define NVIC_SW_TRIG_R          HWREG(0xE000EF00)
+#define NVIC_FPCC_R             HWREG(0xE000EF34)
+#define NVIC_FPCA_R             HWREG(0xE000EF38)
+#define NVIC_FPDSC_R            HWREG(0xE000EF3C)
 
 //*****************************************************************************
 //